@@ -0,0 +1,82 @@
+#include <cstdio>
+#include <cstring>
+
+#include <wups.h>
+#include <wups/storage.h>
+
+#include "cache.h"
+#include "utils/logger.h"
+
+static void cache_key(char *key, size_t size, const char *prefix,
+                      uint64_t title_id, uint32_t title_version)
+{
+  snprintf(key, size, "%s_%016llX_%u", prefix, title_id, title_version);
+}
+
+static bool cache_get(const char *key, void *value, uint32_t size)
+{
+  uint32_t stored_size = 0;
+
+  if (WUPSStorageAPI_GetBinary(nullptr, key, value, size, &stored_size) != WUPS_STORAGE_ERROR_SUCCESS ||
+      stored_size != size)
+  {
+    memset(value, 0, size);
+    return false;
+  }
+
+  return true;
+}
+
+static void cache_set(const char *key, const void *value, uint32_t size)
+{
+  uint8_t stored[32];
+  WUPSStorageError res;
+
+  if (size <= sizeof(stored) && cache_get(key, stored, size) &&
+      !memcmp(stored, value, size))
+    return;
+
+  if ((res = WUPSStorageAPI_StoreBinary(nullptr, key, value, size)) != WUPS_STORAGE_ERROR_SUCCESS)
+    DEBUG_FUNCTION_LINE_ERR("Failed to store %s (%d)", WUPSStorageAPI::GetStatusStr(res).data(), res);
+  else if ((res = WUPSStorageAPI::SaveStorage()) != WUPS_STORAGE_ERROR_SUCCESS)
+    DEBUG_FUNCTION_LINE_ERR("Failed to save storage %s (%d)", WUPSStorageAPI::GetStatusStr(res).data(), res);
+}
+
+bool cache_get_rom(uint64_t title_id, uint32_t title_version,
+                   cl_wups_rom_cache_t *rom)
+{
+  char key[32];
+
+  cache_key(key, sizeof(key), "rom", title_id, title_version);
+
+  return cache_get(key, rom, sizeof(*rom)) && rom->rom_data && rom->rom_size;
+}
+
+void cache_set_rom(uint64_t title_id, uint32_t title_version,
+                   const cl_wups_rom_cache_t *rom)
+{
+  char key[32];
+
+  cache_key(key, sizeof(key), "rom", title_id, title_version);
+  cache_set(key, rom, sizeof(*rom));
+}
+
+bool cache_get_ram(uint64_t title_id, uint32_t title_version,
+                   cl_wups_ram_cache_t *ram)
+{
+  char key[32];
+
+  cache_key(key, sizeof(key), "ram", title_id, title_version);
+
+  return cache_get(key, ram, sizeof(*ram)) &&
+         (ram->ram_base || ram->iram_base || ram->sram_base);
+}
+
+void cache_set_ram(uint64_t title_id, uint32_t title_version,
+                   const cl_wups_ram_cache_t *ram)
+{
+  char key[32];
+
+  cache_key(key, sizeof(key), "ram", title_id, title_version);
+  cache_set(key, ram, sizeof(*ram));
+}
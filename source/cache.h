@@ -0,0 +1,55 @@
+#ifndef CL_WUPS_CACHE_H
+#define CL_WUPS_CACHE_H
+
+#include <cstdint>
+
+/**
+ * Location of a title's ROM image as found by a previous scan. Emulators
+ * usually allocate the ROM at the same address every time a title runs.
+ */
+typedef struct
+{
+  uint32_t rom_data;
+  uint32_t rom_size;
+} cl_wups_rom_cache_t;
+
+/**
+ * Locations of a title's emulated RAM as found by a previous session. Fields
+ * mirror those of cl_wups_title_hint_t, and are 0 if not found.
+ */
+typedef struct
+{
+  uint32_t ram_base;
+  uint32_t iram_base;
+  uint32_t sram_base;
+} cl_wups_ram_cache_t;
+
+/**
+ * Retrieves the ROM location stored for a title and version.
+ * @return Whether a location was stored.
+ */
+bool cache_get_rom(uint64_t title_id, uint32_t title_version,
+                   cl_wups_rom_cache_t *rom);
+
+/**
+ * Stores the ROM location for a title and version, if it differs from the one
+ * already stored.
+ */
+void cache_set_rom(uint64_t title_id, uint32_t title_version,
+                   const cl_wups_rom_cache_t *rom);
+
+/**
+ * Retrieves the RAM locations stored for a title and version.
+ * @return Whether any location was stored.
+ */
+bool cache_get_ram(uint64_t title_id, uint32_t title_version,
+                   cl_wups_ram_cache_t *ram);
+
+/**
+ * Stores the RAM locations for a title and version, if they differ from the
+ * ones already stored.
+ */
+void cache_set_ram(uint64_t title_id, uint32_t title_version,
+                   const cl_wups_ram_cache_t *ram);
+
+#endif
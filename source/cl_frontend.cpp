@@ -1,15 +1,19 @@
+#include <atomic>
 #include <cstring>
 
 #include <coreinit/cache.h>
 #include <coreinit/memory.h>
 #include <coreinit/memorymap.h>
+#include <coreinit/mutex.h>
 #include <coreinit/thread.h>
+#include <coreinit/time.h>
 
 #include <curl/curl.h>
 #include <notifications/notifications.h>
 #include <wups.h>
 
 #include "config.h"
+#include "guest.h"
 #include "main.h"
 #include "title.h"
 
@@ -39,9 +43,33 @@ void cl_fe_display_message(unsigned level, const char *msg)
   }
 }
 
+/**
+ * Appends a readable and writable region to memory.regions, which must have
+ * room for it. Regions whose host address is unknown, or that are not mapped
+ * in full, are left out.
+ */
+static void cl_fe_add_region(uint32_t base_host, uint32_t base_guest,
+                             uint32_t size, unsigned endianness,
+                             const char *title)
+{
+  cl_memory_region_t *region;
+  const uint8_t *data;
+
+  if (!base_host || !size || !(data = guest_range(base_host, size)))
+    return;
+
+  region = &memory.regions[memory.region_count++];
+  region->base_host = (void*)data;
+  region->base_guest = base_guest;
+  region->endianness = endianness;
+  region->flags.bits.read = 1;
+  region->flags.bits.write = 1;
+  region->size = size;
+  snprintf(region->title, sizeof(region->title), "%s", title);
+}
+
 bool cl_fe_install_membanks(void)
 {
-  cl_memory_region_t *region = nullptr;
   unsigned int data;
 
   if (memory.regions)
@@ -49,52 +77,84 @@ bool cl_fe_install_membanks(void)
   
   if (wups_state.title_system == CL_WUPS_TITLE_N64)
   {
-    data = CL_WUPS_N64_RAMPTR;
-    memory.regions = (cl_memory_region_t*)malloc(sizeof(cl_memory_region_t));
-    region = &memory.regions[0];
-    region->base_host = (void*)data;
-    region->base_guest = 0x80000000;
-    region->endianness = CL_ENDIAN_BIG;
-    region->flags.bits.read = 1;
-    region->flags.bits.write = 1;
-    region->size = 8 * 1024 * 1024;
-    snprintf(region->title, sizeof(region->title), "%s", "Vessel RDRAM");
-    memory.region_count = 1;
+    memory.regions = (cl_memory_region_t*)calloc(1, sizeof(cl_memory_region_t));
+    memory.region_count = 0;
+    cl_fe_add_region(wups_state.title_hint.ram_base, 0x80000000,
+                     8 * 1024 * 1024, CL_ENDIAN_BIG, "Vessel RDRAM");
+  }
+  else if (wups_state.title_system == CL_WUPS_TITLE_NES)
+  {
+    /* Either region may be missing if its location could not be found */
+    memory.regions = (cl_memory_region_t*)calloc(2, sizeof(cl_memory_region_t));
+    memory.region_count = 0;
+    cl_fe_add_region(wups_state.title_hint.ram_base, 0x0000,
+                     CL_WUPS_NES_WRAM_SIZE, CL_ENDIAN_LITTLE, "NES WRAM");
+    cl_fe_add_region(wups_state.title_hint.sram_base, 0x6000,
+                     wups_state.title_hint.sram_size, CL_ENDIAN_LITTLE,
+                     "NES cartridge RAM");
+  }
+  else if (wups_state.title_system == CL_WUPS_TITLE_SNES)
+  {
+    /* Cartridge RAM is placed where LoROM boards map it */
+    memory.regions = (cl_memory_region_t*)calloc(2, sizeof(cl_memory_region_t));
+    memory.region_count = 0;
+    cl_fe_add_region(wups_state.title_hint.ram_base, 0x7E0000,
+                     CL_WUPS_SNES_WRAM_SIZE, CL_ENDIAN_LITTLE, "SNES WRAM");
+    cl_fe_add_region(wups_state.title_hint.sram_base, 0x700000,
+                     wups_state.title_hint.sram_size, CL_ENDIAN_LITTLE,
+                     "SNES cartridge RAM");
+  }
+  else if (wups_state.title_system == CL_WUPS_TITLE_GBA)
+  {
+    /* On-board RAM first, as it is where most memory notes point */
+    memory.regions = (cl_memory_region_t*)calloc(2, sizeof(cl_memory_region_t));
+    memory.region_count = 0;
+    cl_fe_add_region(wups_state.title_hint.ram_base, 0x02000000,
+                     CL_WUPS_GBA_EWRAM_SIZE, CL_ENDIAN_LITTLE, "GBA EWRAM");
+    cl_fe_add_region(wups_state.title_hint.iram_base, 0x03000000,
+                     CL_WUPS_GBA_IWRAM_SIZE, CL_ENDIAN_LITTLE, "GBA IWRAM");
+  }
+  else if (wups_state.title_system == CL_WUPS_TITLE_TG16)
+  {
+    memory.regions = (cl_memory_region_t*)calloc(1, sizeof(cl_memory_region_t));
+    memory.region_count = 0;
+    cl_fe_add_region(wups_state.title_hint.ram_base, 0x1F0000,
+                     CL_WUPS_TG16_WRAM_SIZE, CL_ENDIAN_LITTLE, "TG16 WRAM");
+  }
+  else if (wups_state.title_system == CL_WUPS_TITLE_MSX)
+  {
+    memory.regions = (cl_memory_region_t*)calloc(1, sizeof(cl_memory_region_t));
+    memory.region_count = 0;
+    cl_fe_add_region(wups_state.title_hint.ram_base, 0x0000,
+                     CL_WUPS_MSX_RAM_SIZE, CL_ENDIAN_LITTLE, "MSX main RAM");
   }
   else if (wups_state.title_system == CL_WUPS_TITLE_NDS)
   {
-    data = *((uint32_t*)(0xf56139d8)) + 0x02000000; // values at beginning of addrspace should be filled with 0xdeadbeef
-    memory.regions = (cl_memory_region_t*)malloc(sizeof(cl_memory_region_t));
-    region = &memory.regions[0];
-    region->base_host = (void*)data;
-    region->base_guest = 0x02000000;
-    region->endianness = CL_ENDIAN_LITTLE;
-    region->flags.bits.read = 1;
-    region->flags.bits.write = 1;
-    region->size = 4 * 1024 * 1024;
-    snprintf(region->title, sizeof(region->title), "%s", "Hachihachi PSRAM");
-    memory.region_count = 1;
+    data = wups_state.title_hint.ram_ptr && guest_valid(wups_state.title_hint.ram_ptr) ?
+      guest_read32(wups_state.title_hint.ram_ptr) : 0; // values at beginning of addrspace should be filled with 0xdeadbeef
+    memory.regions = (cl_memory_region_t*)calloc(1, sizeof(cl_memory_region_t));
+    memory.region_count = 0;
+    if (data)
+      cl_fe_add_region(data + 0x02000000, 0x02000000, 4 * 1024 * 1024,
+                       CL_ENDIAN_LITTLE, "Hachihachi PSRAM");
   }
   else
   {
     data = 0x10000000;
-    memory.regions = (cl_memory_region_t*)malloc(sizeof(cl_memory_region_t));
-    region = &memory.regions[0];
-    region->base_host = (void*)data;
-    region->base_guest = data;
-    region->endianness = CL_ENDIAN_BIG;
-    region->flags.bits.read = 1;
-    region->flags.bits.write = 1;
-    region->size = 1 * 1024 * 1024 * 1024;
-    snprintf(region->title, sizeof(region->title), "%s", "CafeOS Foreground Process");
-    memory.region_count = 1;
-  }
-
-  cl_message(CL_MSG_DEBUG, "%s : %04X at %p is %u MB",
-    region->title,
-    region->base_guest,
-    region->base_host,
-    region->size >> 20);
+    memory.regions = (cl_memory_region_t*)calloc(1, sizeof(cl_memory_region_t));
+    memory.region_count = 0;
+    cl_fe_add_region(data, data, 1 * 1024 * 1024 * 1024, CL_ENDIAN_BIG,
+                     "CafeOS Foreground Process");
+  }
+
+  for (unsigned i = 0; i < memory.region_count; i++)
+    cl_message(CL_MSG_DEBUG, "%s : %04X at %p is %u MB",
+      memory.regions[i].title,
+      memory.regions[i].base_guest,
+      memory.regions[i].base_host,
+      memory.regions[i].size >> 20);
+  if (!memory.region_count)
+    cl_message(CL_MSG_DEBUG, "Emulated memory could not be found.");
 
   return true;
 }
@@ -110,6 +170,167 @@ typedef struct
   size_t size;
 } cl_wups_network_chunk_t;
 
+/**
+ * Caches shared by every request of the running application, so that DNS
+ * lookups, TLS sessions and open connections carry over from one request to
+ * the next. Sockets belong to the process, so the share does not outlive it.
+ */
+static CURLSH *network_share = nullptr;
+static OSMutex network_locks[CURL_LOCK_DATA_LAST];
+static bool network_locks_ready = false;
+
+/* A share that was still in use when it was freed, to be cleaned up later */
+static CURLSH *network_share_stale = nullptr;
+
+/* Makes requests in progress fail, so that the caches can be freed */
+static std::atomic<bool> network_abort = false;
+
+/* Scheme and host of the last request, kept across applications */
+static char network_origin[256] = { 0 };
+static OSMutex network_origin_lock;
+
+/* Thread opening a connection ahead of the next request */
+static OSThread network_warm_thread;
+static uint8_t network_warm_stack[0x20000];
+static bool network_warm_running = false;
+
+/* How often, and for how long, to wait for that thread when freeing */
+#define CL_WUPS_NETWORK_STOP_INTERVAL_MS 10
+#define CL_WUPS_NETWORK_STOP_TIMEOUT_MS 1000
+
+/* How long a request, and opening a connection ahead of one, may take */
+#define CL_WUPS_NETWORK_TIMEOUT_MS 15000
+#define CL_WUPS_NETWORK_WARM_TIMEOUT_MS 5000
+
+static void cl_wups_network_lock(CURL *handle, curl_lock_data data,
+                                 curl_lock_access access, void *userptr)
+{
+  OSLockMutex(&network_locks[data]);
+}
+
+static void cl_wups_network_unlock(CURL *handle, curl_lock_data data,
+                                   void *userptr)
+{
+  OSUnlockMutex(&network_locks[data]);
+}
+
+/* Retries cleaning up a share that was still in use when it was freed */
+static void cl_wups_network_free_stale(void)
+{
+  if (network_share_stale &&
+      curl_share_cleanup(network_share_stale) != CURLSHE_IN_USE)
+    network_share_stale = nullptr;
+}
+
+bool cl_wups_network_init(void)
+{
+  if (!network_locks_ready)
+  {
+    for (unsigned i = 0; i < CURL_LOCK_DATA_LAST; i++)
+      OSInitMutex(&network_locks[i]);
+    OSInitMutex(&network_origin_lock);
+    network_locks_ready = true;
+  }
+  network_abort = false;
+
+  /**
+   * Threads the last application left running were killed with it, so a
+   * warm-up thread never terminates, and a share one of their requests still
+   * used can only be dropped.
+   */
+  network_warm_running = false;
+  cl_wups_network_free_stale();
+  network_share_stale = nullptr;
+  if (network_share)
+    return true;
+  if (!(network_share = curl_share_init()))
+    return false;
+  curl_share_setopt(network_share, CURLSHOPT_LOCKFUNC, cl_wups_network_lock);
+  curl_share_setopt(network_share, CURLSHOPT_UNLOCKFUNC, cl_wups_network_unlock);
+  curl_share_setopt(network_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+  curl_share_setopt(network_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+  curl_share_setopt(network_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+
+  return true;
+}
+
+void cl_wups_network_abort(void)
+{
+  network_abort = true;
+}
+
+void cl_wups_network_free(bool wait)
+{
+  network_abort = true;
+
+  /* The thread was killed with its application and will never terminate */
+  if (!wait)
+    network_warm_running = false;
+  else if (network_warm_running)
+  {
+    OSTime start = OSGetTime();
+    int ret;
+
+    while (!OSIsThreadTerminated(&network_warm_thread) &&
+           OSGetTime() - start < OSMillisecondsToTicks(CL_WUPS_NETWORK_STOP_TIMEOUT_MS))
+      OSSleepTicks(OSMillisecondsToTicks(CL_WUPS_NETWORK_STOP_INTERVAL_MS));
+    if (OSIsThreadTerminated(&network_warm_thread))
+    {
+      OSJoinThread(&network_warm_thread, &ret);
+      network_warm_running = false;
+    }
+  }
+
+  /**
+   * A request that is still running keeps the share in use, to be cleaned up
+   * once it has been aborted. One a killed thread was making never ends, and
+   * the share it used can only be dropped.
+   */
+  cl_wups_network_free_stale();
+  if (network_share)
+  {
+    if (curl_share_cleanup(network_share) == CURLSHE_IN_USE && wait)
+      network_share_stale = network_share;
+    network_share = nullptr;
+  }
+  if (!wait)
+    network_share_stale = nullptr;
+}
+
+/* Fails a request in progress once the application is ending */
+static int cl_wups_network_progress(void *userp, curl_off_t dltotal,
+                                    curl_off_t dlnow, curl_off_t ultotal,
+                                    curl_off_t ulnow)
+{
+  return network_abort ? 1 : 0;
+}
+
+/**
+ * Creates a request handle with the options every request uses.
+ */
+static CURL *cl_wups_network_handle(const char *url)
+{
+  CURL *curl_handle = curl_easy_init();
+  char user_agent[256];
+  auto curl_version = curl_version_info(CURLVERSION_NOW);
+
+  if (!curl_handle)
+    return nullptr;
+  snprintf(user_agent, sizeof(user_agent), "cl_wups " GIT_VERSION " using curl/%s", curl_version->version);
+  curl_easy_setopt(curl_handle, CURLOPT_URL, url);
+  curl_easy_setopt(curl_handle, CURLOPT_USERAGENT, user_agent);
+  if (network_share)
+    curl_easy_setopt(curl_handle, CURLOPT_SHARE, network_share);
+  curl_easy_setopt(curl_handle, CURLOPT_NOPROGRESS, 0L);
+  curl_easy_setopt(curl_handle, CURLOPT_XFERINFOFUNCTION, cl_wups_network_progress);
+#if !CL_HAVE_SSL
+  curl_easy_setopt(curl_handle, CURLOPT_SSL_VERIFYPEER, 0L);
+  curl_easy_setopt(curl_handle, CURLOPT_SSL_VERIFYHOST, 0L);
+#endif
+
+  return curl_handle;
+}
+
 static size_t cl_wups_network_cb(void *contents, size_t size, size_t nmemb, void *userp)
 {
   size_t realsize = size * nmemb;
@@ -127,32 +348,36 @@ void cl_fe_network_post(const char *url, char *data, cl_network_cb_t callback,
                         void *userdata)
 {
   CURL *curl_handle;
-  CURLcode response_code;
+  CURLcode response_code = CURLE_OUT_OF_MEMORY;
   cl_wups_network_chunk_t chunk;
   cl_network_response_t response;
-  char user_agent[256];
-  auto curl_version = curl_version_info(CURLVERSION_NOW);
+  const char *host = strstr(url, "://");
+  const char *path = host ? strchr(host + 3, '/') : nullptr;
 
-  snprintf(user_agent, sizeof(user_agent), "cl_wups " GIT_VERSION " using curl/%s", curl_version->version);
   chunk.size = 0;
 
+  /* Remember where requests go, so the next session can connect early */
+  if (network_locks_ready && path && (size_t)(path - url) < sizeof(network_origin))
+  {
+    OSLockMutex(&network_origin_lock);
+    snprintf(network_origin, sizeof(network_origin), "%.*s/", (int)(path - url), url);
+    OSUnlockMutex(&network_origin_lock);
+  }
+
 #if CL_WUPS_DEBUG
   cl_fe_display_message(CL_MSG_DEBUG, url);
   cl_fe_display_message(CL_MSG_DEBUG, data);
 #endif
 
-  curl_handle = curl_easy_init();
-  curl_easy_setopt(curl_handle, CURLOPT_URL, url);
-  curl_easy_setopt(curl_handle, CURLOPT_POSTFIELDS, data);
-  curl_easy_setopt(curl_handle, CURLOPT_WRITEFUNCTION, cl_wups_network_cb); 
-  curl_easy_setopt(curl_handle, CURLOPT_WRITEDATA, (void*)&chunk);
-  curl_easy_setopt(curl_handle, CURLOPT_USERAGENT, user_agent);
-#if !CL_HAVE_SSL
-  curl_easy_setopt(curl_handle, CURLOPT_SSL_VERIFYPEER, 0L);
-  curl_easy_setopt(curl_handle, CURLOPT_SSL_VERIFYHOST, 0L);
-#endif
-  response_code = curl_easy_perform(curl_handle);
-  curl_easy_cleanup(curl_handle);
+  if ((curl_handle = cl_wups_network_handle(url)))
+  {
+    curl_easy_setopt(curl_handle, CURLOPT_POSTFIELDS, data);
+    curl_easy_setopt(curl_handle, CURLOPT_TIMEOUT_MS, (long)CL_WUPS_NETWORK_TIMEOUT_MS);
+    curl_easy_setopt(curl_handle, CURLOPT_WRITEFUNCTION, cl_wups_network_cb); 
+    curl_easy_setopt(curl_handle, CURLOPT_WRITEDATA, (void*)&chunk);
+    response_code = curl_easy_perform(curl_handle);
+    curl_easy_cleanup(curl_handle);
+  }
 
   if (response_code == CURLE_OK)
   {
@@ -178,6 +403,63 @@ void cl_fe_network_post(const char *url, char *data, cl_network_cb_t callback,
     callback(response, userdata);
 }
 
+static int cl_wups_network_warm_handler(int argc, const char **argv)
+{
+  char origin[sizeof(network_origin)];
+  CURL *curl_handle;
+
+  OSLockMutex(&network_origin_lock);
+  memcpy(origin, network_origin, sizeof(origin));
+  OSUnlockMutex(&network_origin_lock);
+
+  /**
+   * A HEAD request leaves an open connection in the shared cache for the
+   * next request to the same host, along with its DNS entry and TLS session.
+   */
+  if ((curl_handle = cl_wups_network_handle(origin)))
+  {
+    curl_easy_setopt(curl_handle, CURLOPT_NOBODY, 1L);
+    curl_easy_setopt(curl_handle, CURLOPT_TIMEOUT_MS, (long)CL_WUPS_NETWORK_WARM_TIMEOUT_MS);
+    curl_easy_perform(curl_handle);
+    curl_easy_cleanup(curl_handle);
+  }
+
+  return 0;
+}
+
+void cl_wups_network_warm(void)
+{
+  int ret;
+
+  /* The host isn't known until something has been requested from it */
+  if (!network_share || !network_origin[0])
+    return;
+
+  /* One connection being opened is enough; don't wait for it to finish */
+  if (network_warm_running)
+  {
+    if (!OSIsThreadTerminated(&network_warm_thread))
+      return;
+    OSJoinThread(&network_warm_thread, &ret);
+    network_warm_running = false;
+  }
+
+  /* Keep off the calling thread's core, which is busy hashing meanwhile */
+  network_warm_running = OSCreateThread(&network_warm_thread,
+                                        cl_wups_network_warm_handler,
+                                        0,
+                                        nullptr,
+                                        network_warm_stack + sizeof(network_warm_stack),
+                                        sizeof(network_warm_stack),
+                                        16,
+                                        (OS_THREAD_ATTRIB_AFFINITY_CPU0 << ((OSGetCoreId() + 1) % 3)));
+  if (network_warm_running)
+  {
+    OSSetThreadName(&network_warm_thread, "Classics Live network");
+    OSResumeThread(&network_warm_thread);
+  }
+}
+
 typedef struct
 {
   OSThread os_thread;
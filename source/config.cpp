@@ -2,6 +2,7 @@
 #include <string_view>
 
 #include <coreinit/debug.h>
+#include <coreinit/time.h>
 #include <coreinit/title.h>
 #include <sysapp/switch.h>
 
@@ -22,12 +23,11 @@ extern "C"
   #include <classicslive-integration/cl_network.h>
 };
 
-#define DEBUG_FUNCTION_LINE_ERR(fmt, ...) OSReport("Error: %s:%d: " fmt "\n", __FUNCTION__, __LINE__, ##__VA_ARGS__)
-
 #include "config.h"
 #include "main.h"
+#include "utils/logger.h"
 
-cl_wups_settings_t wups_settings = { true, true, CL_WUPS_SYNC_METHOD_TICKS };
+cl_wups_settings_t wups_settings = { true, true, CL_WUPS_SYNC_METHOD_TICKS, CL_WUPS_SCAN_BUDGET_UNLIMITED };
 
 WUPS_USE_STORAGE("classicslive");
 
@@ -93,6 +93,8 @@ void multiple_values_cb(ConfigItemMultipleValues *item, unsigned value)
 
     if (std::string_view(item->identifier) == CL_WUPS_CONFIG_SYNC_METHOD)
       target = &wups_settings.sync_method;
+    else if (std::string_view(item->identifier) == CL_WUPS_CONFIG_SCAN_BUDGET)
+      target = &wups_settings.scan_budget;
     else
       return;
 
@@ -123,6 +125,7 @@ void InitConfig(void)
   WUPSStorageAPI::GetOrStoreDefault(CL_WUPS_CONFIG_ENABLED, wups_settings.enabled, true);
   WUPSStorageAPI::GetOrStoreDefault(CL_WUPS_CONFIG_SYNC_METHOD, wups_settings.sync_method, CL_WUPS_SYNC_METHOD_TICKS);
   WUPSStorageAPI::GetOrStoreDefault(CL_WUPS_CONFIG_NETWORK_NOTIFICATIONS, wups_settings.network_notifications, true);
+  WUPSStorageAPI::GetOrStoreDefault(CL_WUPS_CONFIG_SCAN_BUDGET, wups_settings.scan_budget, CL_WUPS_SCAN_BUDGET_UNLIMITED);
   WUPSStorageAPI_GetString(nullptr, CL_WUPS_CONFIG_USERNAME, wups_settings.user.username, sizeof(wups_settings.user.username), nullptr);
   WUPSStorageAPI_GetString(nullptr, CL_WUPS_CONFIG_PASSWORD, wups_settings.user.password, sizeof(wups_settings.user.password), nullptr);
   WUPSStorageAPI_GetString(nullptr, CL_WUPS_CONFIG_TOKEN, wups_settings.user.token, sizeof(wups_settings.user.token), nullptr);
@@ -198,6 +201,23 @@ WUPSConfigAPICallbackStatus ConfigMenuOpenedCallback(WUPSConfigCategoryHandle ro
       2,
       &multiple_values_cb);
 
+    /* ROM scan budget */
+    ConfigItemMultipleValuesPair budgets[] =
+    {
+      { CL_WUPS_SCAN_BUDGET_UNLIMITED, "unlimited" },
+      { CL_WUPS_SCAN_BUDGET_LOW, "256 KB" },
+      { CL_WUPS_SCAN_BUDGET_MEDIUM, "1 MB" },
+      { CL_WUPS_SCAN_BUDGET_HIGH, "4 MB" },
+    };
+    WUPSConfigItemMultipleValues_AddToCategory(cat_settings,
+      CL_WUPS_CONFIG_SCAN_BUDGET,
+      "ROM search per frame",
+      CL_WUPS_SCAN_BUDGET_UNLIMITED,
+      wups_settings.scan_budget,
+      budgets,
+      4,
+      &multiple_values_cb);
+
     WUPSConfigAPI_Category_AddCategory(root, cat_settings);
 
     /**
@@ -295,6 +315,11 @@ WUPSConfigAPICallbackStatus ConfigMenuOpenedCallback(WUPSConfigCategoryHandle ro
       snprintf(msg, sizeof(msg), "%08X %08X", ((uint32_t*)wups_state.rom_data)[0], ((uint32_t*)wups_state.rom_data)[1]);
       WUPSConfigItemStub_AddToCategory(cat_debug, msg);
     }
+    if (wups_state.scan_bytes)
+    {
+      cl_add_readonly(cat_debug, "ROM search read", "0x%08X (%u MB)", wups_state.scan_bytes, wups_state.scan_bytes >> 20);
+      cl_add_readonly(cat_debug, "ROM search time", "%llu ms", OSTicksToMilliseconds(wups_state.scan_ticks));
+    }
     if (memory.region_count && memory.regions)
     {
       cl_add_readonly(cat_debug, "Memory host base", "0x%08X", memory.regions[0].base_host);
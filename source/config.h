@@ -9,6 +9,7 @@ extern "C"
 #define CL_WUPS_CONFIG_ENABLED "enabled"
 #define CL_WUPS_CONFIG_NETWORK_NOTIFICATIONS "network_notifications"
 #define CL_WUPS_CONFIG_SYNC_METHOD "sync_method"
+#define CL_WUPS_CONFIG_SCAN_BUDGET "scan_budget"
 #define CL_WUPS_CONFIG_USERNAME "username"
 #define CL_WUPS_CONFIG_PASSWORD "password"
 #define CL_WUPS_CONFIG_TOKEN "token"
@@ -17,11 +18,18 @@ extern "C"
 #define CL_WUPS_SYNC_METHOD_TICKS 0
 #define CL_WUPS_SYNC_METHOD_VSYNC 1
 
+/* ROM scan budgets, in kilobytes read per frame by each scanning thread */
+#define CL_WUPS_SCAN_BUDGET_UNLIMITED 0
+#define CL_WUPS_SCAN_BUDGET_LOW 256
+#define CL_WUPS_SCAN_BUDGET_MEDIUM 1024
+#define CL_WUPS_SCAN_BUDGET_HIGH 4096
+
 typedef struct cl_wups_settings_t
 {
   bool enabled;
   bool network_notifications;
   int sync_method;
+  int scan_budget;
   cl_user_t user;
 } cl_wups_settings_t;
 
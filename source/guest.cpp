@@ -0,0 +1,120 @@
+#ifndef __WIIU__
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "guest.h"
+
+#define CL_WUPS_GUEST_MAPPINGS 8
+
+typedef struct
+{
+  uint32_t addr;
+  uint32_t size;
+  const uint8_t *data;
+} cl_wups_guest_mapping_t;
+
+static cl_wups_guest_mapping_t guest_mappings[CL_WUPS_GUEST_MAPPINGS];
+static unsigned guest_mapping_count = 0;
+static uint32_t guest_heap_addr = 0;
+
+static const cl_wups_guest_mapping_t *guest_find(uint32_t addr)
+{
+  for (unsigned i = 0; i < guest_mapping_count; i++)
+    if (addr >= guest_mappings[i].addr &&
+        addr - guest_mappings[i].addr < guest_mappings[i].size)
+      return &guest_mappings[i];
+
+  return nullptr;
+}
+
+const uint8_t *guest_ptr(uint32_t addr)
+{
+  const cl_wups_guest_mapping_t *mapping = guest_find(addr);
+
+  return mapping ? mapping->data + (addr - mapping->addr) : nullptr;
+}
+
+const uint8_t *guest_range(uint32_t addr, uint32_t size)
+{
+  const cl_wups_guest_mapping_t *mapping = guest_find(addr);
+
+  if (!mapping || size > mapping->size - (addr - mapping->addr))
+    return nullptr;
+
+  return mapping->data + (addr - mapping->addr);
+}
+
+uint32_t guest_addr(const void *ptr)
+{
+  for (unsigned i = 0; i < guest_mapping_count; i++)
+    if ((const uint8_t*)ptr >= guest_mappings[i].data &&
+        (const uint8_t*)ptr < guest_mappings[i].data + guest_mappings[i].size)
+      return guest_mappings[i].addr +
+             (uint32_t)((const uint8_t*)ptr - guest_mappings[i].data);
+
+  return 0;
+}
+
+bool guest_valid(uint32_t addr)
+{
+  return guest_find(addr) != nullptr;
+}
+
+uint16_t guest_read16(uint32_t addr)
+{
+  const uint8_t *data = guest_range(addr, 2);
+
+  return data ? (uint16_t)(data[0] << 8 | data[1]) : 0;
+}
+
+uint32_t guest_read32(uint32_t addr)
+{
+  const uint8_t *data = guest_range(addr, 4);
+
+  return data ? guest_load32(data) : 0;
+}
+
+uint32_t guest_heap(void)
+{
+  return guest_heap_addr;
+}
+
+bool guest_map(uint32_t addr, const char *path)
+{
+  cl_wups_guest_mapping_t *mapping;
+  struct stat st;
+  void *data;
+  int fd;
+
+  /* Keep host pointers aligned as the guest addresses they stand for are */
+  if (guest_mapping_count >= CL_WUPS_GUEST_MAPPINGS || addr & 0xFFF)
+    return false;
+  if ((fd = open(path, O_RDONLY)) < 0)
+    return false;
+  if (fstat(fd, &st) || st.st_size <= 0 || st.st_size > UINT32_MAX - addr)
+  {
+    close(fd);
+    return false;
+  }
+  data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED)
+    return false;
+
+  mapping = &guest_mappings[guest_mapping_count++];
+  mapping->addr = addr;
+  mapping->size = (uint32_t)st.st_size;
+  mapping->data = (const uint8_t*)data;
+
+  return true;
+}
+
+void guest_set_heap(uint32_t addr)
+{
+  guest_heap_addr = addr;
+}
+
+#endif
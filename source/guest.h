@@ -0,0 +1,100 @@
+#ifndef CL_WUPS_GUEST_H
+#define CL_WUPS_GUEST_H
+
+#include <cstdint>
+
+/**
+ * Access to the memory of the foreground process by Cafe OS virtual address.
+ * On the console, addresses are used as pointers directly and every function
+ * here compiles down to a cast or a load. Host builds instead map memory
+ * dumps taken from a console at the addresses they were taken from, so ROM
+ * discovery and memory region setup can be run against them. There,
+ * guest_ptr and guest_range return nullptr for addresses no dump covers and
+ * guest_read16 and guest_read32 return 0, so pointers must be checked before
+ * use; on the console, guest_valid is the check for the address.
+ *
+ * Words are big-endian, as on the console, regardless of the host.
+ */
+
+#ifdef __WIIU__
+
+#include <coreinit/memheap.h>
+#include <coreinit/memorymap.h>
+
+/* Returns a pointer to the given address, or nullptr if it isn't mapped */
+static inline const uint8_t *guest_ptr(uint32_t addr)
+{
+  return (const uint8_t*)addr;
+}
+
+/* Returns a pointer to [addr, addr + size), or nullptr if it isn't mapped */
+static inline const uint8_t *guest_range(uint32_t addr, uint32_t size)
+{
+  return (const uint8_t*)addr;
+}
+
+/* Returns the address a pointer from guest_ptr or guest_range refers to */
+static inline uint32_t guest_addr(const void *ptr)
+{
+  return (uint32_t)(uintptr_t)ptr;
+}
+
+static inline bool guest_valid(uint32_t addr)
+{
+  return OSIsAddressValid(addr);
+}
+
+/* Loads a word through a pointer from guest_ptr or guest_range */
+static inline uint32_t guest_load32(const void *ptr)
+{
+  return *((const uint32_t*)ptr);
+}
+
+static inline uint16_t guest_read16(uint32_t addr)
+{
+  return *((const uint16_t*)addr);
+}
+
+static inline uint32_t guest_read32(uint32_t addr)
+{
+  return *((const uint32_t*)addr);
+}
+
+/* Returns the address of the process heap in MEM2, or 0 if there is none */
+static inline uint32_t guest_heap(void)
+{
+  return (uint32_t)(uintptr_t)MEMGetBaseHeapHandle(MEM_BASE_HEAP_MEM2);
+}
+
+#else
+
+const uint8_t *guest_ptr(uint32_t addr);
+const uint8_t *guest_range(uint32_t addr, uint32_t size);
+uint32_t guest_addr(const void *ptr);
+bool guest_valid(uint32_t addr);
+
+static inline uint32_t guest_load32(const void *ptr)
+{
+  auto bytes = (const uint8_t*)ptr;
+
+  return (uint32_t)bytes[0] << 24 | (uint32_t)bytes[1] << 16 |
+         (uint32_t)bytes[2] << 8 | bytes[3];
+}
+
+uint16_t guest_read16(uint32_t addr);
+uint32_t guest_read32(uint32_t addr);
+uint32_t guest_heap(void);
+
+/**
+ * Maps a memory dump file at the address it was taken from, which must be
+ * page-aligned.
+ * @return Whether the file could be mapped.
+ */
+bool guest_map(uint32_t addr, const char *path);
+
+/* Sets the address of the process heap in MEM2 within the mapped dumps */
+void guest_set_heap(uint32_t addr);
+
+#endif
+
+#endif
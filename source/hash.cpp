@@ -0,0 +1,248 @@
+#include <cstdint>
+#include <cstring>
+
+#include "hash.h"
+#include "utils/prefetch.h"
+
+/* Blocks ahead of the one being hashed to start loading into the cache */
+#define CL_WUPS_HASH_PREFETCH 4
+
+/* Bytes hashed between checks of the cancel flag */
+#define CL_WUPS_HASH_CHUNK 0x10000
+
+static const std::atomic<bool> *hash_cancel = nullptr;
+
+/**
+ * Loads a little-endian word. On big-endian targets the byte swap folds into
+ * the load, which becomes a single lwbrx on the Espresso.
+ */
+static inline uint32_t cl_wups_md5_load(const uint8_t *p)
+{
+  uint32_t word;
+
+  memcpy(&word, p, sizeof(word));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  return __builtin_bswap32(word);
+#else
+  return word;
+#endif
+}
+
+static inline uint32_t cl_wups_md5_rotl(uint32_t x, unsigned n)
+{
+  return (x << n) | (x >> (32 - n));
+}
+
+#define CL_WUPS_MD5_F(x, y, z) ((z) ^ ((x) & ((y) ^ (z))))
+#define CL_WUPS_MD5_G(x, y, z) ((y) ^ ((z) & ((x) ^ (y))))
+#define CL_WUPS_MD5_H(x, y, z) ((x) ^ (y) ^ (z))
+#define CL_WUPS_MD5_I(x, y, z) ((y) ^ ((x) | ~(z)))
+
+#define CL_WUPS_MD5_STEP(f, a, b, c, d, x, t, s) \
+  (a) += f((b), (c), (d)) + (x) + (t); \
+  (a) = cl_wups_md5_rotl((a), (s)) + (b);
+
+/**
+ * Runs the compression function over 64-byte blocks. All 64 steps are
+ * written out, so the message words and round constants stay in registers
+ * and the shifts are immediates.
+ */
+static void cl_wups_md5_blocks(MD5_CTX *ctx, const uint8_t *data, size_t blocks)
+{
+  uint32_t a = ctx->a, b = ctx->b, c = ctx->c, d = ctx->d;
+
+  for (; blocks; blocks--, data += 64)
+  {
+    uint32_t x0 = cl_wups_md5_load(data + 0x00);
+    uint32_t x1 = cl_wups_md5_load(data + 0x04);
+    uint32_t x2 = cl_wups_md5_load(data + 0x08);
+    uint32_t x3 = cl_wups_md5_load(data + 0x0C);
+    uint32_t x4 = cl_wups_md5_load(data + 0x10);
+    uint32_t x5 = cl_wups_md5_load(data + 0x14);
+    uint32_t x6 = cl_wups_md5_load(data + 0x18);
+    uint32_t x7 = cl_wups_md5_load(data + 0x1C);
+    uint32_t x8 = cl_wups_md5_load(data + 0x20);
+    uint32_t x9 = cl_wups_md5_load(data + 0x24);
+    uint32_t x10 = cl_wups_md5_load(data + 0x28);
+    uint32_t x11 = cl_wups_md5_load(data + 0x2C);
+    uint32_t x12 = cl_wups_md5_load(data + 0x30);
+    uint32_t x13 = cl_wups_md5_load(data + 0x34);
+    uint32_t x14 = cl_wups_md5_load(data + 0x38);
+    uint32_t x15 = cl_wups_md5_load(data + 0x3C);
+    uint32_t aa = a, bb = b, cc = c, dd = d;
+
+    /* Both 32-byte cache blocks of a later 64-byte block */
+    CL_WUPS_PREFETCH(data + 64 * CL_WUPS_HASH_PREFETCH);
+    CL_WUPS_PREFETCH(data + 64 * CL_WUPS_HASH_PREFETCH + 32);
+
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_F, a, b, c, d, x0, 0xd76aa478, 7)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_F, d, a, b, c, x1, 0xe8c7b756, 12)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_F, c, d, a, b, x2, 0x242070db, 17)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_F, b, c, d, a, x3, 0xc1bdceee, 22)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_F, a, b, c, d, x4, 0xf57c0faf, 7)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_F, d, a, b, c, x5, 0x4787c62a, 12)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_F, c, d, a, b, x6, 0xa8304613, 17)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_F, b, c, d, a, x7, 0xfd469501, 22)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_F, a, b, c, d, x8, 0x698098d8, 7)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_F, d, a, b, c, x9, 0x8b44f7af, 12)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_F, c, d, a, b, x10, 0xffff5bb1, 17)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_F, b, c, d, a, x11, 0x895cd7be, 22)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_F, a, b, c, d, x12, 0x6b901122, 7)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_F, d, a, b, c, x13, 0xfd987193, 12)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_F, c, d, a, b, x14, 0xa679438e, 17)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_F, b, c, d, a, x15, 0x49b40821, 22)
+
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_G, a, b, c, d, x1, 0xf61e2562, 5)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_G, d, a, b, c, x6, 0xc040b340, 9)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_G, c, d, a, b, x11, 0x265e5a51, 14)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_G, b, c, d, a, x0, 0xe9b6c7aa, 20)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_G, a, b, c, d, x5, 0xd62f105d, 5)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_G, d, a, b, c, x10, 0x02441453, 9)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_G, c, d, a, b, x15, 0xd8a1e681, 14)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_G, b, c, d, a, x4, 0xe7d3fbc8, 20)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_G, a, b, c, d, x9, 0x21e1cde6, 5)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_G, d, a, b, c, x14, 0xc33707d6, 9)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_G, c, d, a, b, x3, 0xf4d50d87, 14)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_G, b, c, d, a, x8, 0x455a14ed, 20)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_G, a, b, c, d, x13, 0xa9e3e905, 5)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_G, d, a, b, c, x2, 0xfcefa3f8, 9)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_G, c, d, a, b, x7, 0x676f02d9, 14)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_G, b, c, d, a, x12, 0x8d2a4c8a, 20)
+
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_H, a, b, c, d, x5, 0xfffa3942, 4)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_H, d, a, b, c, x8, 0x8771f681, 11)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_H, c, d, a, b, x11, 0x6d9d6122, 16)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_H, b, c, d, a, x14, 0xfde5380c, 23)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_H, a, b, c, d, x1, 0xa4beea44, 4)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_H, d, a, b, c, x4, 0x4bdecfa9, 11)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_H, c, d, a, b, x7, 0xf6bb4b60, 16)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_H, b, c, d, a, x10, 0xbebfbc70, 23)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_H, a, b, c, d, x13, 0x289b7ec6, 4)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_H, d, a, b, c, x0, 0xeaa127fa, 11)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_H, c, d, a, b, x3, 0xd4ef3085, 16)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_H, b, c, d, a, x6, 0x04881d05, 23)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_H, a, b, c, d, x9, 0xd9d4d039, 4)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_H, d, a, b, c, x12, 0xe6db99e5, 11)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_H, c, d, a, b, x15, 0x1fa27cf8, 16)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_H, b, c, d, a, x2, 0xc4ac5665, 23)
+
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_I, a, b, c, d, x0, 0xf4292244, 6)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_I, d, a, b, c, x7, 0x432aff97, 10)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_I, c, d, a, b, x14, 0xab9423a7, 15)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_I, b, c, d, a, x5, 0xfc93a039, 21)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_I, a, b, c, d, x12, 0x655b59c3, 6)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_I, d, a, b, c, x3, 0x8f0ccc92, 10)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_I, c, d, a, b, x10, 0xffeff47d, 15)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_I, b, c, d, a, x1, 0x85845dd1, 21)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_I, a, b, c, d, x8, 0x6fa87e4f, 6)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_I, d, a, b, c, x15, 0xfe2ce6e0, 10)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_I, c, d, a, b, x6, 0xa3014314, 15)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_I, b, c, d, a, x13, 0x4e0811a1, 21)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_I, a, b, c, d, x4, 0xf7537e82, 6)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_I, d, a, b, c, x11, 0xbd3af235, 10)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_I, c, d, a, b, x2, 0x2ad7d2bb, 15)
+    CL_WUPS_MD5_STEP(CL_WUPS_MD5_I, b, c, d, a, x9, 0xeb86d391, 21)
+
+    a += aa;
+    b += bb;
+    c += cc;
+    d += dd;
+  }
+
+  ctx->a = a;
+  ctx->b = b;
+  ctx->c = c;
+  ctx->d = d;
+}
+
+static inline void cl_wups_md5_store(unsigned char *p, uint32_t word)
+{
+  p[0] = (unsigned char)word;
+  p[1] = (unsigned char)(word >> 8);
+  p[2] = (unsigned char)(word >> 16);
+  p[3] = (unsigned char)(word >> 24);
+}
+
+void hash_set_cancel(const std::atomic<bool> *cancel)
+{
+  hash_cancel = cancel;
+}
+
+extern "C" void MD5_Init(MD5_CTX *ctx)
+{
+  ctx->a = 0x67452301;
+  ctx->b = 0xefcdab89;
+  ctx->c = 0x98badcfe;
+  ctx->d = 0x10325476;
+  ctx->lo = 0;
+  ctx->hi = 0;
+}
+
+extern "C" void MD5_Update(MD5_CTX *ctx, const void *data, unsigned long size)
+{
+  auto bytes = (const uint8_t*)data;
+  uint32_t saved_lo = ctx->lo;
+  uint32_t used = saved_lo & 0x3F;
+
+  /* Bytes so far, kept as in libretro-common: 29 bits in lo, the rest in hi */
+  if ((ctx->lo = (saved_lo + size) & 0x1FFFFFFF) < saved_lo)
+    ctx->hi++;
+  ctx->hi += (MD5_u32plus)(size >> 29);
+
+  /* Complete a block left partly filled by the last call */
+  if (used)
+  {
+    uint32_t available = 64 - used;
+
+    if (size < available)
+    {
+      memcpy(&ctx->buffer[used], bytes, size);
+      return;
+    }
+    memcpy(&ctx->buffer[used], bytes, available);
+    cl_wups_md5_blocks(ctx, ctx->buffer, 1);
+    bytes += available;
+    size -= available;
+  }
+
+  /* Whole blocks are hashed in place */
+  while (size >= 64)
+  {
+    unsigned long chunk = size < CL_WUPS_HASH_CHUNK ?
+      size & ~0x3FUL : CL_WUPS_HASH_CHUNK;
+
+    cl_wups_md5_blocks(ctx, bytes, chunk / 64);
+    bytes += chunk;
+    size -= chunk;
+    if (hash_cancel && hash_cancel->load(std::memory_order_relaxed))
+      return;
+  }
+
+  memcpy(ctx->buffer, bytes, size);
+}
+
+extern "C" void MD5_Final(unsigned char *result, MD5_CTX *ctx)
+{
+  uint32_t used = ctx->lo & 0x3F;
+
+  ctx->buffer[used++] = 0x80;
+  if (used > 56)
+  {
+    memset(&ctx->buffer[used], 0, 64 - used);
+    cl_wups_md5_blocks(ctx, ctx->buffer, 1);
+    used = 0;
+  }
+  memset(&ctx->buffer[used], 0, 56 - used);
+
+  /* Length in bits */
+  cl_wups_md5_store(&ctx->buffer[56], ctx->lo << 3);
+  cl_wups_md5_store(&ctx->buffer[60], ctx->hi);
+  cl_wups_md5_blocks(ctx, ctx->buffer, 1);
+
+  cl_wups_md5_store(&result[0], ctx->a);
+  cl_wups_md5_store(&result[4], ctx->b);
+  cl_wups_md5_store(&result[8], ctx->c);
+  cl_wups_md5_store(&result[12], ctx->d);
+
+  memset(ctx, 0, sizeof(*ctx));
+}
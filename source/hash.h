@@ -0,0 +1,42 @@
+#ifndef CL_WUPS_HASH_H
+#define CL_WUPS_HASH_H
+
+#include <atomic>
+
+/**
+ * MD5, which the integration library identifies ROM images by. hash.cpp
+ * provides MD5_Init, MD5_Update and MD5_Final in place of libretro-common's
+ * utils/md5.c, which the Makefile leaves out, with the same context layout
+ * so either header can be used.
+ */
+extern "C"
+{
+#if __has_include(<utils/md5.h>)
+  #include <utils/md5.h>
+#else
+  typedef unsigned int MD5_u32plus;
+
+  typedef struct
+  {
+    MD5_u32plus lo, hi;
+    MD5_u32plus a, b, c, d;
+    unsigned char buffer[64];
+    MD5_u32plus block[16];
+  } MD5_CTX;
+
+  void MD5_Init(MD5_CTX *ctx);
+  void MD5_Update(MD5_CTX *ctx, const void *data, unsigned long size);
+  void MD5_Final(unsigned char *result, MD5_CTX *ctx);
+#endif
+};
+
+/**
+ * Sets a flag that makes MD5_Update return between chunks of data once it is
+ * set, so that hashing a large ROM image doesn't hold up the thread being
+ * stopped. The digest is meaningless after that. The flag applies to every
+ * MD5 computed while it is set, so only set it around a hash whose result
+ * can be thrown away, and set it back to nullptr after.
+ */
+void hash_set_cancel(const std::atomic<bool> *cancel);
+
+#endif
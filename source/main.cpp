@@ -1,3 +1,5 @@
+#include <atomic>
+
 #include <coreinit/cache.h>
 #include <coreinit/memorymap.h>
 #include <coreinit/thread.h>
@@ -23,8 +25,12 @@ extern "C"
   #include <classicslive-integration/cl_script.h>
 };
 
+#include "cache.h"
 #include "config.h"
+#include "guest.h"
+#include "hash.h"
 #include "main.h"
+#include "scan.h"
 #include "title.h"
 
 WUPS_PLUGIN_NAME("Classics Live");
@@ -33,7 +39,17 @@ WUPS_PLUGIN_VERSION(GIT_VERSION);
 WUPS_PLUGIN_AUTHOR("Keith Bourdon");
 WUPS_PLUGIN_LICENSE("MIT");
 
+/* How often, and for how long, to poll for the game to be ready */
+#define CL_WUPS_READY_INTERVAL_MS 100
+#define CL_WUPS_READY_TIMEOUT_MS 10000
+
+/* How long the application may be held up waiting for the thread to stop */
+#define CL_WUPS_STOP_INTERVAL_MS 10
+#define CL_WUPS_STOP_TIMEOUT_MS 1000
+
 static OSThread thread;
+static bool thread_running = false;
+static std::atomic<bool> stopping = false;
 static bool paused = false;
 static unsigned pause_frames = 0;
 static uint8_t stack[0x30000];
@@ -41,138 +57,402 @@ static int error = 0;
 
 cl_wups_state_t wups_state;
 
-static int cl_wups_main(int argc, const char **argv)
+/**
+ * Fills in an emulated RAM location that is not hinted for this title, if it
+ * has a heap allocation of its own that the probe recognizes. The location
+ * cached from the last session is used if it still passes the probe.
+ */
+static void cl_wups_find_ram(uint32_t *base, uint32_t cached, uint32_t size,
+                             scan_ram_probe_t probe)
 {
-  bool found = false;
+  if (*base || !size)
+    return;
+  if (cached && scan_ram_check(cached, size, probe))
+    *base = cached;
+  else
+    *base = scan_ram(size, probe);
+}
+
+/**
+ * Finds the emulated RAM of this title. This has to be done before the
+ * session installs its memory regions. Only RAM with contents a probe can
+ * recognize is searched for; the rest is left to per-title hints, and not
+ * installed without one.
+ * @param rom The ROM image, for systems that only give the size of cartridge
+ * RAM in the ROM header, or nullptr.
+ */
+static void cl_wups_find_memory(const uint8_t *rom)
+{
+  cl_wups_title_hint_t *hint = &wups_state.title_hint;
+  cl_wups_ram_cache_t cached;
+
+  cache_get_ram(wups_state.title_id, wups_state.title_version, &cached);
+
+  switch (wups_state.title_system)
+  {
+  case CL_WUPS_TITLE_SNES:
+  {
+    const uint8_t *header;
+
+    /* A hinted location may leave the size to the ROM header */
+    if (!rom || !hint->sram_base || hint->sram_size)
+      return;
+    header = rom + (scan_check<scan_system_snes_lorom>(rom) ? 0x7FC0 : 0xFFC0);
+    if (header[0x18])
+      hint->sram_size = 0x400 << header[0x18];
+    return;
+  }
+  case CL_WUPS_TITLE_GBA:
+    cl_wups_find_ram(&hint->iram_base, cached.iram_base, CL_WUPS_GBA_IWRAM_SIZE,
+                     scan_probe_gba_iwram);
+    break;
+  case CL_WUPS_TITLE_MSX:
+    cl_wups_find_ram(&hint->ram_base, cached.ram_base, CL_WUPS_MSX_RAM_SIZE,
+                     scan_probe_msx_ram);
+    break;
+  default:
+    return;
+  }
+
+  cl_wups_ram_cache_t found = { hint->ram_base, hint->iram_base, hint->sram_base };
+  if (found.ram_base || found.iram_base || found.sram_base)
+    cache_set_ram(wups_state.title_id, wups_state.title_version, &found);
+}
+
+/**
+ * Returns whether the emulated RAM of this title can be found, so that a
+ * session started for it has memory to evaluate. NES, SNES and TG16 work
+ * RAM and GBA EWRAM have nothing at a fixed place a probe could recognize,
+ * so they are only known from a per-title hint. GBA IWRAM alone is not
+ * enough, as most memory notes point to EWRAM.
+ */
+static bool cl_wups_has_ram(void)
+{
+  switch (wups_state.title_system)
+  {
+  case CL_WUPS_TITLE_NES:
+  case CL_WUPS_TITLE_SNES:
+  case CL_WUPS_TITLE_GBA:
+  case CL_WUPS_TITLE_TG16:
+    return wups_state.title_hint.ram_base != 0;
+  default:
+    return true;
+  }
+}
+
+/**
+ * Identifies the game from its ROM image and starts a session with it.
+ */
+static bool cl_wups_start_rom(void *data, unsigned size, const char *unknown_name)
+{
+  cl_game_identifier_t ident;
+  bool started;
+
+  if (stopping)
+    return false;
+  cl_wups_find_memory((const uint8_t*)data);
+
+  memset(&ident, 0, sizeof(ident));
+  ident.type = CL_GAMEIDENTIFIER_FILE_HASH;
+  ident.library = "Wii U Virtual Console";
+  snprintf(ident.filename, sizeof(ident.filename), "%s", wups_state.title_name[0] ? wups_state.title_name : unknown_name);
+  ident.data = data;
+  ident.size = size;
 
   /**
-   * Wait for an arbitrary amount for the game to fully start.
-   * This amount of time was tested for Nintendo 64 games to begin emulation.
+   * The library hashes the whole image on every launch, so connect to the
+   * server meanwhile. A checksum cached per title could only skip that if
+   * the library took one in place of the data, which has not been confirmed
+   * for the version this plugin builds with.
    */
-  OSSleepTicks(OSSecondsToTicks(10));
+  cl_wups_network_warm();
 
-  if (wups_state.title_system == CL_WUPS_TITLE_N64)
+  /* Let the application ending cut hashing short, but only for this image */
+  hash_set_cancel(&stopping);
+  started = cl_login_and_start(ident) == CL_OK;
+  hash_set_cancel(nullptr);
+  if (!started)
   {
-    for (auto i = (uint32_t*)0x14000000; i < (uint32_t*)0x20000000; i++)
-    {
-      /* Magic used at the beginning of the N64 ROM header */
-      if (*i == 0x80371240)
-      {
-        /* The ROM size is in memory 0x10 bytes behind the ROM */
-        unsigned size = *(i - 4);
+    if (!stopping)
+      cl_message(CL_MSG_ERROR, "cl_login_and_start error");
+    return false;
+  }
 
-        if (!size)
-          continue;
-        else 
-        {
-          cl_game_identifier_t ident;
-
-          memset(&ident, 0, sizeof(ident));
-          ident.type = CL_GAMEIDENTIFIER_FILE_HASH;
-          ident.library = "Wii U Virtual Console";
-          snprintf(ident.filename, sizeof(ident.filename), "%s", wups_state.title_name[0] ? wups_state.title_name : "Unknown N64 Title");
-          ident.data = i;
-          ident.size = size;
-
-          if (cl_login_and_start(ident) != CL_OK)
-            cl_message(CL_MSG_ERROR, "cl_login_and_start error");
-          else
-          {
-            wups_state.rom_data = i;
-            wups_state.rom_size = size;
-            found = true;
-
-            break;
-          }
-        }
-      }
-    }
+  /* The application has ended during login, leave what it had alone */
+  if (stopping)
+    return false;
+  wups_state.rom_data = data;
+  wups_state.rom_size = size;
+
+  /* Remember where the ROM was, to check there first on the next launch */
+  cl_wups_rom_cache_t rom = { guest_addr(data), size };
+  cache_set_rom(wups_state.title_id, wups_state.title_version, &rom);
+
+  return true;
+}
+
+/**
+ * Starts a session for a title identified by its title ID, for systems
+ * whose ROM images can't be found in memory.
+ */
+static bool cl_wups_start_product(const char *library, const char *unknown_name)
+{
+  cl_game_identifier_t ident;
+
+  memset(&ident, 0, sizeof(ident));
+  ident.type = CL_GAMEIDENTIFIER_PRODUCT_CODE;
+  ident.library = library;
+  snprintf(ident.filename, sizeof(ident.filename), "%s", wups_state.title_name[0] ? wups_state.title_name : unknown_name);
+  snprintf(ident.product, sizeof(ident.product), "%016llX", wups_state.title_id);
+  snprintf(ident.version, sizeof(ident.version), "%u", wups_state.title_version);
+
+  if (cl_login_and_start(ident) != CL_OK)
+  {
+    if (!stopping)
+      cl_message(CL_MSG_ERROR, "cl_login_and_start error");
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Returns the ROM image of the given system at a known location, or nullptr
+ * if there is none there.
+ * @param size Set to the size of the image.
+ */
+template <const scan_system_t &System>
+static const uint8_t *cl_wups_rom_at(uint32_t data, uint32_t *size)
+{
+  const uint8_t *rom;
+
+  if (!data || !guest_valid(data) ||
+      !(rom = guest_range(data, System.min_size)) ||
+      !(*size = scan_check<System>(rom)))
+    return nullptr;
+
+  return rom;
+}
+
+/**
+ * Starts a session with a ROM image at a known location, if one is there.
+ * An image that is there but cannot be started is rejected in the cursor.
+ * @param size The expected size, or 0 to accept any.
+ */
+template <const scan_system_t &System>
+static bool cl_wups_try_rom(uint32_t data, uint32_t size, const char *unknown_name,
+                            scan_cursor_t *cursor)
+{
+  uint32_t found_size;
+  const uint8_t *rom = cl_wups_rom_at<System>(data, &found_size);
+
+  if (!rom || (size && size != found_size))
+    return false;
+
+  if (cl_wups_start_rom((void*)rom, found_size, unknown_name))
+    return true;
+  scan_reject(cursor, rom);
+
+  return false;
+}
+
+/**
+ * Starts a session with a ROM image of the given system at the location
+ * hinted for this title, or failing that the one it was found at last time.
+ */
+template <const scan_system_t &System>
+static bool cl_wups_start_known(const char *unknown_name, scan_cursor_t *cursor)
+{
+  const cl_wups_title_hint_t *hint = &wups_state.title_hint;
+  cl_wups_rom_cache_t rom;
+
+  if (cl_wups_try_rom<System>(hint->rom_data, hint->rom_size, unknown_name, cursor))
+    return true;
+
+  return cache_get_rom(wups_state.title_id, wups_state.title_version, &rom) &&
+         rom.rom_data != hint->rom_data &&
+         cl_wups_try_rom<System>(rom.rom_data, rom.rom_size, unknown_name, cursor);
+}
+
+/**
+ * Scans memory for ROM images of the given system and starts a session with
+ * the first one that can be identified. Images that could not be started are
+ * remembered in the cursor, which can be shared between the systems of one
+ * console so that each is only tried once.
+ */
+template <const scan_system_t &System>
+static bool cl_wups_scan_and_start(const char *unknown_name, scan_cursor_t *cursor)
+{
+  bool found = false;
+
+  cursor->phase = 0;
+  cursor->rom = nullptr;
+  cursor->slice_bytes = wups_settings.scan_budget * 1024;
+  cursor->cancel = &stopping;
+  while (!found && !stopping && scan_rom<System>(cursor))
+  {
+    found = cl_wups_start_rom((void*)cursor->rom, cursor->size, unknown_name);
     if (!found)
-      cl_message(CL_MSG_ERROR, "Could not initialize N64 game.");
+      scan_reject(cursor, cursor->rom);
+  }
+  if (stopping)
+    return false;
+  wups_state.scan_bytes = cursor->scanned;
+  wups_state.scan_ticks = cursor->ticks;
+
+  return found;
+}
+
+/**
+ * Finds a ROM image of the given system and starts a session with the first
+ * one that can be identified. Memory is only scanned if neither the hinted
+ * nor the last known location holds a usable image.
+ */
+template <const scan_system_t &System>
+static bool cl_wups_find_and_start(const char *unknown_name, scan_cursor_t *cursor)
+{
+  return cl_wups_start_known<System>(unknown_name, cursor) ||
+         cl_wups_scan_and_start<System>(unknown_name, cursor);
+}
+
+/**
+ * Returns whether the game has started far enough for its ROM and RAM to be
+ * found. Native Wii U titles, and systems whose memory is only known from
+ * hints, are always ready.
+ */
+static bool cl_wups_ready(void)
+{
+  switch (wups_state.title_system)
+  {
+  case CL_WUPS_TITLE_NES:
+  {
+    cl_wups_rom_cache_t rom;
+    uint32_t size;
+
+    /**
+     * Wait for the image to appear where it is usually loaded, where it was
+     * found last time, or in the heap.
+     */
+    return cl_wups_rom_at<scan_system_nes>(wups_state.title_hint.rom_data, &size) ||
+           (cache_get_rom(wups_state.title_id, wups_state.title_version, &rom) &&
+            cl_wups_rom_at<scan_system_nes>(rom.rom_data, &size)) ||
+           scan_rom_loaded<scan_system_nes>();
   }
-#if 0
+  case CL_WUPS_TITLE_SNES:
+    /* Wait for the image to be loaded into the heap */
+    return scan_rom_loaded<scan_system_snes_lorom>() ||
+           scan_rom_loaded<scan_system_snes_hirom>();
+  case CL_WUPS_TITLE_GBA:
+    return scan_rom_loaded<scan_system_gba>();
+  case CL_WUPS_TITLE_MSX:
+    /* Wait for the BIOS to have set up its work area */
+    return wups_state.title_hint.ram_base ||
+           scan_ram(CL_WUPS_MSX_RAM_SIZE, scan_probe_msx_ram);
+  case CL_WUPS_TITLE_N64:
+    return title_is_n64();
+  case CL_WUPS_TITLE_NDS:
+  {
+    /**
+     * Wait for the pointer to the emulated address space to be set, and for
+     * PSRAM to no longer hold the 0xdeadbeef fill pattern.
+     */
+    uint32_t ptr = wups_state.title_hint.ram_ptr;
+    uint32_t as = ptr && guest_valid(ptr) ? guest_read32(ptr) : 0;
+
+    return as && as != 0xDEADBEEF && guest_valid(as + 0x02000000) &&
+           guest_read32(as + 0x02000000) != 0xDEADBEEF;
+  }
+  default:
+    return true;
+  }
+}
+
+static int cl_wups_main(int argc, const char **argv)
+{
+  scan_cursor_t cursor = {};
+  bool found = false;
+  OSTime start = OSGetTime();
+
   /**
-   * Hashing can be easily done for NES here by checking for this header
+   * Wait for the emulator to start running the game. If it never looks ready,
+   * carry on after the amount of time that was originally tested for Nintendo
+   * 64 games to begin emulation.
    */
-  else if (wups_state.title_system == CL_WUPS_TITLE_NES)
+  while (!cl_wups_ready())
   {
-    if (*((uint32_t*)0x10000050) == 0x4e455300)
+    if (stopping)
+      return 0;
+    if (OSGetTime() - start >= OSMillisecondsToTicks(CL_WUPS_READY_TIMEOUT_MS))
     {
-      // figure total rom size from iNES header
-      wups_state.rom = (uint32_t*)0x10000050;
+      cl_message(CL_MSG_DEBUG, "Timed out waiting for the game to start.");
+      break;
     }
+    OSSleepTicks(OSMillisecondsToTicks(CL_WUPS_READY_INTERVAL_MS));
+  }
+
+  if (wups_state.title_system == CL_WUPS_TITLE_N64)
+  {
+    found = cl_wups_find_and_start<scan_system_n64>("Unknown N64 Title", &cursor);
+    if (!found && !stopping)
+      cl_message(CL_MSG_ERROR, "Could not initialize N64 game.");
+  }
+  else if (wups_state.title_system == CL_WUPS_TITLE_NES)
+  {
+    found = cl_wups_find_and_start<scan_system_nes>("Unknown NES Title", &cursor);
+    if (!found && !stopping)
+      cl_message(CL_MSG_ERROR, "Could not initialize NES game.");
+  }
+  else if (wups_state.title_system == CL_WUPS_TITLE_SNES)
+  {
+    /**
+     * Check the known locations with both memory maps before scanning, as a
+     * scan is slow, then scan for the memory map the image in the heap has
+     * first.
+     */
+    found = cl_wups_start_known<scan_system_snes_lorom>("Unknown SNES Title", &cursor) ||
+            cl_wups_start_known<scan_system_snes_hirom>("Unknown SNES Title", &cursor);
+    if (!found && scan_rom_loaded<scan_system_snes_hirom>())
+      found = cl_wups_scan_and_start<scan_system_snes_hirom>("Unknown SNES Title", &cursor) ||
+              cl_wups_scan_and_start<scan_system_snes_lorom>("Unknown SNES Title", &cursor);
+    else if (!found)
+      found = cl_wups_scan_and_start<scan_system_snes_lorom>("Unknown SNES Title", &cursor) ||
+              cl_wups_scan_and_start<scan_system_snes_hirom>("Unknown SNES Title", &cursor);
+    if (!found && !stopping)
+      cl_message(CL_MSG_ERROR, "Could not initialize SNES game.");
+  }
+  else if (wups_state.title_system == CL_WUPS_TITLE_GBA)
+  {
+    found = cl_wups_find_and_start<scan_system_gba>("Unknown GBA Title", &cursor);
+    if (!found && !stopping)
+      cl_message(CL_MSG_ERROR, "Could not initialize GBA game.");
   }
-#endif
   else if (wups_state.title_system == CL_WUPS_TITLE_NDS)
   {
-    for (auto i = (uint32_t*)0x2a800000; i < (uint32_t*)0x2b400000; i++)
-    {
-      /**
-       * Find the first 4 bytes of encoded Nintendo logo, then confirm by
-       * checking the 2-byte logo checksum.
-       */
-      if (*i == 0x24FFAE51) // && (*(i + 0x9c) & 0xFFFF0000) == 0xCF560000)
-      {
-        /* The ROM size is in memory 0x10 bytes behind the ROM */
-        void *data = i - 0x30;
-        uint32_t size = *(i - 0x34);
-
-        if (!data || !size || size > 0x20000000)
-          continue;
-        else
-        {
-          cl_game_identifier_t ident;
-
-          memset(&ident, 0, sizeof(ident));
-          ident.type = CL_GAMEIDENTIFIER_FILE_HASH;
-          ident.library = "Wii U Virtual Console";
-          snprintf(ident.filename, sizeof(ident.filename), "%s", wups_state.title_name[0] ? wups_state.title_name : "Unknown NDS Title");
-          ident.data = data;
-          ident.size = size;
-
-          if (cl_login_and_start(ident) != CL_OK)
-            cl_message(CL_MSG_ERROR, "cl_login_and_start error");
-          else
-          {
-            wups_state.rom_data = data;
-            wups_state.rom_size = size;
-            found = true;
-
-            break;
-          }
-        }
-      }
-    }
-    if (!found)
+    found = cl_wups_find_and_start<scan_system_nds>("Unknown NDS Title", &cursor);
+    if (!found && !stopping)
       cl_message(CL_MSG_ERROR, "Could not initialize NDS game.");
   }
-  else if (wups_state.title_system == CL_WUPS_TITLE_WII_U)
+  else if (wups_state.title_system == CL_WUPS_TITLE_TG16 ||
+           wups_state.title_system == CL_WUPS_TITLE_MSX)
   {
-    cl_game_identifier_t ident;
-
-    memset(&ident, 0, sizeof(ident));
-    ident.type = CL_GAMEIDENTIFIER_PRODUCT_CODE;
-    ident.library = "Wii U";
-    snprintf(ident.filename, sizeof(ident.filename), "%s", wups_state.title_name[0] ? wups_state.title_name : "Unknown Wii U Title");
-    snprintf(ident.product, sizeof(ident.product), "%016llX", wups_state.title_id);
-    snprintf(ident.version, sizeof(ident.version), "%u", wups_state.title_version);
-
-    if (cl_login_and_start(ident) != CL_OK)
-      cl_message(CL_MSG_ERROR, "cl_login_and_start error");
-    else
-      found = true;
+    cl_wups_find_memory(nullptr);
+    found = cl_wups_start_product("Wii U Virtual Console",
+                                  wups_state.title_system == CL_WUPS_TITLE_TG16 ?
+                                    "Unknown TG16 Title" : "Unknown MSX Title");
   }
+  else if (wups_state.title_system == CL_WUPS_TITLE_WII_U)
+    found = cl_wups_start_product("Wii U", "Unknown Wii U Title");
 
   if (found)
   {
-    while (true)
+    while (!stopping)
     {
       if (wups_settings.sync_method == CL_WUPS_SYNC_METHOD_TICKS)
         OSSleepTicks(OSNanosecondsToTicks(16666667));
       else
         GX2WaitForVsync();
 
-      if (paused || error)
+      if (paused || error || stopping)
         continue;
 
       if (pause_frames)
@@ -286,6 +566,11 @@ INITIALIZE_PLUGIN()
                                         "Is CURLWrapperModule installed?");
     error = 1;
   }
+  if (!title_init())
+  {
+    cl_fe_display_message(CL_MSG_ERROR, "Could not load the title database.");
+    error = 1;
+  }
   InitConfig();
 }
 
@@ -335,11 +620,61 @@ static void get_title_info(void) {
     free(metaXml);
 }
 
+/**
+ * Frees what the session used, once the main thread is no longer using it.
+ * @param wait Whether to wait for the network warm-up thread, which is only
+ * worth it while the application it was started in is still running.
+ */
+static void cl_wups_free_session(bool wait)
+{
+  cl_free();
+  cl_wups_network_free(wait);
+  wups_state = { 0 };
+}
+
+/**
+ * Waits for the main thread to stop once stopping is set, then frees what
+ * the session used. The wait is bounded, as a thread blocked on a v-sync
+ * that will never come once the game has shut down graphics can't notice;
+ * nothing the thread may still use is freed then.
+ * @return Whether the thread has stopped and the session was freed.
+ */
+static bool cl_wups_stop_thread(void)
+{
+  if (thread_running)
+  {
+    OSTime start = OSGetTime();
+    int ret;
+
+    while (!OSIsThreadTerminated(&thread) &&
+           OSGetTime() - start < OSMillisecondsToTicks(CL_WUPS_STOP_TIMEOUT_MS))
+      OSSleepTicks(OSMillisecondsToTicks(CL_WUPS_STOP_INTERVAL_MS));
+    if (!OSIsThreadTerminated(&thread))
+      return false;
+    OSJoinThread(&thread, &ret);
+    thread_running = false;
+  }
+  cl_wups_free_session(true);
+
+  return true;
+}
+
 ON_APPLICATION_START()
 {
   if (!wups_settings.enabled || error)
     return;
 
+  /**
+   * A thread that didn't stop in time was killed along with the last
+   * application. Its OSThread is never updated after that, so it can't be
+   * waited for or joined; free the session it left behind right away.
+   */
+  if (thread_running)
+  {
+    thread_running = false;
+    cl_wups_free_session(false);
+  }
+
   memset(&memory, 0, sizeof(memory));
   memset(&session, 0, sizeof(session));
   paused = false;
@@ -360,13 +695,33 @@ ON_APPLICATION_START()
     return;
   }
 
+  title_load_overlay();
   wups_state.title_system = title_get_system(wups_state.title_id);
+  if (wups_state.title_system == CL_WUPS_TITLE_UNKNOWN)
+    wups_state.title_system = title_detect_system(wups_state.title_id);
+  title_get_hint(wups_state.title_id, wups_state.title_system, &wups_state.title_hint);
+
+  /* Don't start a session with no memory to evaluate */
+  if (!cl_wups_has_ram())
+  {
+#if CL_WUPS_DEBUG
+    cl_fe_display_message(CL_MSG_ERROR, "Emulated RAM of this title is not known.");
+#endif
+    return;
+  }
   
   if (wups_state.title_system == CL_WUPS_TITLE_WII_U || 
+      wups_state.title_system == CL_WUPS_TITLE_NES ||
+      wups_state.title_system == CL_WUPS_TITLE_SNES ||
+      wups_state.title_system == CL_WUPS_TITLE_GBA ||
+      wups_state.title_system == CL_WUPS_TITLE_TG16 ||
+      wups_state.title_system == CL_WUPS_TITLE_MSX ||
       wups_state.title_system == CL_WUPS_TITLE_N64 ||
       wups_state.title_system == CL_WUPS_TITLE_NDS)
   {
     OSMemoryBarrier();
+    stopping = false;
+    cl_wups_network_init();
     if (!OSCreateThread(&thread,
                         cl_wups_main,
                         0,
@@ -380,6 +735,7 @@ ON_APPLICATION_START()
     {
       OSSetThreadName(&thread, "Classics Live client");
       OSResumeThread(&thread);
+      thread_running = true;
     }
     OSMemoryBarrier();
   }
@@ -391,6 +747,13 @@ ON_APPLICATION_START()
 
 ON_APPLICATION_ENDS()
 {
-  cl_free();
-  wups_state = { 0 };
+  /**
+   * Stop the thread before the session it is using is freed, failing any
+   * request it is waiting on. If it doesn't stop in time, it ends with the
+   * application, and the session is freed when the next one starts.
+   */
+  stopping = true;
+  cl_wups_network_abort();
+  if (!cl_wups_stop_thread())
+    cl_message(CL_MSG_DEBUG, "Timed out waiting for the main thread to stop.");
 }
@@ -3,6 +3,8 @@
 
 #include <stdint.h>
 
+#include "title.h"
+
 typedef struct cl_wups_state_t
 { 
   uint64_t title_id = 0;
@@ -10,10 +12,43 @@ typedef struct cl_wups_state_t
   uint64_t title_system = 0;
   uint32_t title_version = 0;
   char title_name[128] = { 0 };
+  cl_wups_title_hint_t title_hint = { 0 };
   void *rom_data = nullptr;
   unsigned rom_size = 0;
+  uint32_t scan_bytes = 0;
+  uint64_t scan_ticks = 0;
 } cl_wups_state_t;
 
 extern cl_wups_state_t wups_state;
 
+/**
+ * Sets up the network caches shared by the requests of an application.
+ * Requests still work, uncached, if this fails.
+ */
+bool cl_wups_network_init(void);
+
+/**
+ * Makes requests in progress, and any made after, fail right away, so that a
+ * thread waiting on one can stop. Cleared by cl_wups_network_init.
+ */
+void cl_wups_network_abort(void);
+
+/**
+ * Stops cl_wups_network_warm and frees the shared network caches, which must
+ * be done before the application's sockets are closed. Requests still in
+ * progress are aborted, and the wait for them is bounded; caches they still
+ * use are freed by a later call.
+ * @param wait Whether to wait for cl_wups_network_warm to stop. Pass false
+ * once the application it was called in has ended, as its thread ended with
+ * it.
+ */
+void cl_wups_network_free(bool wait);
+
+/**
+ * Starts connecting, on another thread, to the host the last request went
+ * to, so a request made while waiting on something else can reuse the
+ * connection.
+ */
+void cl_wups_network_warm(void);
+
 #endif
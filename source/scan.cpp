@@ -0,0 +1,924 @@
+#include <atomic>
+#include <cstddef>
+
+#include <coreinit/thread.h>
+#include <coreinit/time.h>
+
+#ifdef __WIIU__
+#include <coreinit/memexpheap.h>
+#include <coreinit/memheap.h>
+#endif
+
+#include "guest.h"
+#include "scan.h"
+#include "utils/prefetch.h"
+
+#define CL_WUPS_SCAN_THREADS 3
+
+/* Words scanned between checks for whether a lower worker found a match */
+#define CL_WUPS_SCAN_BLOCK 0x4000
+
+/* Espresso L1 data cache block size, in words */
+#define CL_WUPS_SCAN_LINE (32 / sizeof(uint32_t))
+
+/* How many cache blocks ahead of the scan position to prefetch */
+#define CL_WUPS_SCAN_PREFETCH 4
+
+/**
+ * ROM alignments probed before falling back to scanning every word, coarsest
+ * first. Emulators allocate ROM buffers from the heap, which usually places
+ * them on a page or at least a generously aligned boundary, so the first
+ * phases only touch a fraction of the range. Expanded heap blocks put their
+ * data 0x14 bytes after a header that is itself 0x20 or 0x40-aligned, so
+ * the last phase probes every cache block, which still only compares one
+ * word of each.
+ */
+static constexpr uint32_t cl_wups_scan_phases[] = { 0x1000, 0x100, 0x20 };
+#define CL_WUPS_SCAN_COARSE_PHASES (sizeof(cl_wups_scan_phases) / sizeof(cl_wups_scan_phases[0]))
+
+/* Length of the frame a time-sliced scan reads its slice in, at 60 Hz */
+#define CL_WUPS_SCAN_FRAME_NS 16666667
+
+/* How deeply to follow expanded heaps created inside other heaps */
+#define CL_WUPS_SCAN_HEAP_DEPTH 4
+
+/* Bytes at the start of each heap block probed for a ROM header */
+#define CL_WUPS_SCAN_HEAP_WINDOW 0x40
+
+/**
+ * Layout of the Cafe OS heap structures read by the heap walk. They are read
+ * through guest.h instead of as wut's structs, so that the walk also works on
+ * memory dumps.
+ */
+#define CL_WUPS_HEAP_TAG 0x00
+#define CL_WUPS_HEAP_CHILD_HEAD 0x0C
+#define CL_WUPS_HEAP_CHILD_LINK_OFFSET 0x16
+#define CL_WUPS_HEAP_DATA_START 0x18
+#define CL_WUPS_HEAP_DATA_END 0x1C
+#define CL_WUPS_HEAP_LINK_NEXT 0x04
+#define CL_WUPS_EXP_HEAP_USED_HEAD 0x48
+#define CL_WUPS_EXP_BLOCK_SIZE 0x04
+#define CL_WUPS_EXP_BLOCK_NEXT 0x0C
+#define CL_WUPS_EXP_BLOCK_DATA 0x14
+
+/* 'EXPH' */
+#define CL_WUPS_EXP_HEAP_TAG 0x45585048
+
+#ifdef __WIIU__
+static_assert(CL_WUPS_EXP_HEAP_TAG == MEM_EXPANDED_HEAP_TAG);
+static_assert(offsetof(MEMHeapHeader, tag) == CL_WUPS_HEAP_TAG);
+static_assert(offsetof(MEMHeapHeader, list) + offsetof(MEMMemoryList, head) ==
+              CL_WUPS_HEAP_CHILD_HEAD);
+static_assert(offsetof(MEMHeapHeader, list) +
+              offsetof(MEMMemoryList, offsetToMemoryLink) ==
+              CL_WUPS_HEAP_CHILD_LINK_OFFSET);
+static_assert(offsetof(MEMHeapHeader, dataStart) == CL_WUPS_HEAP_DATA_START);
+static_assert(offsetof(MEMHeapHeader, dataEnd) == CL_WUPS_HEAP_DATA_END);
+static_assert(offsetof(MEMMemoryLink, next) == CL_WUPS_HEAP_LINK_NEXT);
+static_assert(offsetof(MEMExpHeap, usedList) +
+              offsetof(MEMExpHeapBlockList, head) == CL_WUPS_EXP_HEAP_USED_HEAD);
+static_assert(offsetof(MEMExpHeapBlock, blockSize) == CL_WUPS_EXP_BLOCK_SIZE);
+static_assert(offsetof(MEMExpHeapBlock, next) == CL_WUPS_EXP_BLOCK_NEXT);
+static_assert(sizeof(MEMExpHeapBlock) == CL_WUPS_EXP_BLOCK_DATA);
+#endif
+
+typedef struct
+{
+  OSThread thread;
+  uint8_t stack[0x1000];
+  unsigned index;
+  const uint32_t *start;
+  const uint32_t *end;
+  const uint32_t *result;
+  bool running;
+} cl_wups_scan_worker_t;
+
+typedef struct
+{
+  cl_wups_scan_worker_t workers[CL_WUPS_SCAN_THREADS];
+
+  /* ROMs at this alignment were already checked by a coarser phase */
+  uint32_t skip_alignment;
+
+  /* Words each thread reads per frame, or 0 to not yield */
+  uint32_t slice_words;
+
+  /* Bytes read by all threads during the current phase */
+  std::atomic<uint32_t> scanned;
+
+  /* Index of the lowest worker that has found a match so far */
+  std::atomic<unsigned> found;
+
+  /* The cursor's cancellation flag, or nullptr */
+  const std::atomic<bool> *cancel;
+} cl_wups_scan_t;
+
+alignas(16) static cl_wups_scan_t scan;
+
+/**
+ * The match is a predicate on a single word. Passing it as a lambda lets it
+ * be inlined, so a fixed magic number becomes a compare against an immediate.
+ */
+template <typename Match>
+static inline const uint32_t *cl_wups_scan_kernel(const uint32_t *start,
+                                                  const uint32_t *end,
+                                                  Match match)
+{
+  const uint32_t *i = start;
+
+  /* Compare single words up to the first cache block boundary */
+  while (i < end && ((uintptr_t)i & (CL_WUPS_SCAN_LINE * sizeof(uint32_t) - 1)))
+  {
+    if (match(guest_load32(i)))
+      return i;
+    i++;
+  }
+
+  /* Compare whole cache blocks, only branching once per block */
+  while (end - i >= (ptrdiff_t)CL_WUPS_SCAN_LINE)
+  {
+    CL_WUPS_PREFETCH(i + CL_WUPS_SCAN_LINE * CL_WUPS_SCAN_PREFETCH);
+    if (match(guest_load32(&i[0])) | match(guest_load32(&i[1])) |
+        match(guest_load32(&i[2])) | match(guest_load32(&i[3])) |
+        match(guest_load32(&i[4])) | match(guest_load32(&i[5])) |
+        match(guest_load32(&i[6])) | match(guest_load32(&i[7])))
+      break;
+    i += CL_WUPS_SCAN_LINE;
+  }
+
+  /* Find the match within the block, or compare the remaining words */
+  for (; i < end; i++)
+    if (match(guest_load32(i)))
+      return i;
+
+  return end;
+}
+
+const uint32_t *scan_block(const uint32_t *start, const uint32_t *end,
+                           uint32_t magic)
+{
+  return cl_wups_scan_kernel(start, end,
+                             [magic](uint32_t word) { return word == magic; });
+}
+
+/* CRC-16/MODBUS, as used by NDS ROM headers */
+static uint16_t cl_wups_crc16(const uint8_t *data, uint32_t size)
+{
+  uint16_t crc = 0xFFFF;
+
+  while (size--)
+  {
+    crc ^= *data++;
+    for (unsigned i = 0; i < 8; i++)
+      crc = (crc >> 1) ^ ((crc & 1) ? 0xA001 : 0);
+  }
+
+  return crc;
+}
+
+static uint16_t cl_wups_read16le(const uint8_t *data)
+{
+  return data[0] | (data[1] << 8);
+}
+
+bool scan_validate_nds(const uint8_t *rom, uint32_t size)
+{
+  uint8_t unit_code = rom[0x12];
+  uint8_t capacity = rom[0x14];
+
+  /* The header alone is 0x200 bytes */
+  if (size < 0x200)
+    return false;
+
+  /* Nintendo DS, DS and DSi, or DSi only */
+  if (unit_code != 0x00 && unit_code != 0x02 && unit_code != 0x03)
+    return false;
+
+  /* Chip capacity is 128KB << n, and the image can't be larger than the chip */
+  if (capacity > 0x0D || size > (0x20000u << capacity))
+    return false;
+
+  /* The Nintendo logo always has the same checksum */
+  if (cl_wups_read16le(&rom[0x15C]) != 0xCF56)
+    return false;
+
+  return cl_wups_read16le(&rom[0x15E]) == cl_wups_crc16(rom, 0x15E);
+}
+
+bool scan_validate_nes(const uint8_t *rom, uint32_t size)
+{
+  /* Nintendo's images use plain iNES headers, without NES 2.0 extensions */
+  for (unsigned i = 11; i < 16; i++)
+    if (rom[i])
+      return false;
+
+  return true;
+}
+
+uint32_t scan_size_nes(const uint8_t *rom)
+{
+  uint32_t prg_banks = rom[4];
+  uint32_t chr_banks = rom[5];
+
+  if (!prg_banks)
+    return 0;
+
+  return 16 + (rom[6] & 0x04 ? 512 : 0) + prg_banks * 0x4000 + chr_banks * 0x2000;
+}
+
+bool scan_match_snes(uint32_t word)
+{
+  /* The checksum complement and checksum, which always sum to 0xFFFF */
+  return ((word ^ (word >> 16)) & 0xFFFF) == 0xFFFF;
+}
+
+/**
+ * Checks the SNES internal header fields that have a small set of valid
+ * values. The checksum pair was already checked by scan_match_snes.
+ */
+static bool cl_wups_validate_snes(const uint8_t *header, bool hirom,
+                                  uint32_t size)
+{
+  uint8_t map_mode = header[0x15];
+
+  /* The header has to be inside the ROM */
+  if (size < (hirom ? 0x10000u : 0x8000u))
+    return false;
+
+  /* Slow or fast ROM, with a memory map matching the header location */
+  if ((map_mode & 0xE0) != 0x20)
+    return false;
+  switch (map_mode & 0x0F)
+  {
+  case 0x00: /* LoROM */
+  case 0x02: /* LoROM with S-DD1 */
+  case 0x03: /* LoROM with SA-1 */
+    if (hirom)
+      return false;
+    break;
+  case 0x01: /* HiROM */
+  case 0x05: /* ExHiROM */
+    if (!hirom)
+      return false;
+    break;
+  default:
+    return false;
+  }
+
+  /* ROM size from 256KB to 8MB, and at most 256KB of SRAM */
+  if (header[0x17] < 0x08 || header[0x17] > 0x0D || header[0x18] > 0x08)
+    return false;
+
+  /* The title is ASCII, or JIS X 0201 for katakana */
+  for (unsigned i = 0; i < 21; i++)
+    if ((header[i] < 0x20 || header[i] > 0x7E) &&
+        (header[i] < 0xA1 || header[i] > 0xDF))
+      return false;
+
+  return true;
+}
+
+bool scan_validate_snes_lorom(const uint8_t *rom, uint32_t size)
+{
+  return cl_wups_validate_snes(rom + 0x7FC0, false, size);
+}
+
+bool scan_validate_snes_hirom(const uint8_t *rom, uint32_t size)
+{
+  return cl_wups_validate_snes(rom + 0xFFC0, true, size);
+}
+
+uint32_t scan_size_snes_lorom(const uint8_t *rom)
+{
+  return 0x400u << (rom[0x7FD7] & 0x0F);
+}
+
+uint32_t scan_size_snes_hirom(const uint8_t *rom)
+{
+  return 0x400u << (rom[0xFFD7] & 0x0F);
+}
+
+uint32_t scan_trim_snes(const uint8_t *rom, uint32_t size)
+{
+  uint32_t banks = size & ~(uint32_t)0x7FFF;
+
+  return banks ? banks : size;
+}
+
+bool scan_validate_gba(const uint8_t *rom, uint32_t size)
+{
+  uint8_t complement = 0;
+
+  if (rom[0xB2] != 0x96)
+    return false;
+
+  for (unsigned i = 0xA0; i < 0xBD; i++)
+    complement -= rom[i];
+  if ((uint8_t)(complement - 0x19) != rom[0xBD])
+    return false;
+
+  /* The Nintendo logo always has the same checksum */
+  return cl_wups_crc16(&rom[0x04], 0x9C) == 0xCF56;
+}
+
+uint32_t scan_size_gba(const uint8_t *rom)
+{
+  return 32 * 1024 * 1024;
+}
+
+uint32_t scan_trim_gba(const uint8_t *rom, uint32_t size)
+{
+  uint32_t end = size & ~(uint32_t)3;
+  uint32_t rounded = size;
+
+  /* An allocation the size of a ROM dump holds all of one */
+  if (!(size & (size - 1)))
+    return size;
+
+  while (end)
+  {
+    uint32_t word = guest_load32(rom + end - 4);
+
+    if (word != 0x00000000 && word != 0xFFFFFFFF)
+      break;
+    end -= 4;
+  }
+
+  /* Drop what the allocator added past the largest dump size that fits */
+  while (rounded & (rounded - 1))
+    rounded &= rounded - 1;
+  if (rounded >= end)
+    return rounded;
+
+  /* Not a power of two, so only drop what lies past the last 32 KB */
+  rounded = size & ~(uint32_t)0x7FFF;
+
+  return rounded >= end ? rounded : size;
+}
+
+template <const scan_system_t &System>
+static inline bool cl_wups_scan_match(uint32_t word)
+{
+  if constexpr (System.match != nullptr)
+    return System.match(word);
+  else
+    return word == System.magic;
+}
+
+template <const scan_system_t &System>
+static inline uint32_t cl_wups_scan_size(const uint8_t *rom)
+{
+  if constexpr (System.get_size != nullptr)
+    return System.get_size(rom);
+  else
+    return guest_load32(rom + System.size_offset);
+}
+
+template <const scan_system_t &System>
+static inline uint32_t cl_wups_scan_trim(const uint8_t *rom, uint32_t size)
+{
+  if constexpr (System.trim != nullptr)
+    return System.trim(rom, size);
+  else
+    return size;
+}
+
+template <const scan_system_t &System>
+static bool cl_wups_scan_accept(const uint32_t *match, uint32_t skip_alignment)
+{
+  auto rom = (const uint8_t*)match - System.magic_offset;
+  uint32_t size;
+
+  if (System.alignment > sizeof(uint32_t) &&
+      ((uintptr_t)rom & (System.alignment - 1)))
+    return false;
+  if (skip_alignment && !((uintptr_t)rom & (skip_alignment - 1)))
+    return false;
+
+  size = cl_wups_scan_size<System>(rom);
+  if (!size || size > System.max_size)
+    return false;
+
+  if constexpr (System.validate != nullptr)
+    return System.validate(rom, size);
+  else
+    return true;
+}
+
+/**
+ * Calls visit with the data and size of each used block of an expanded heap,
+ * then of any expanded heaps created inside it, until it returns true.
+ * @return Whether visit returned true.
+ */
+template <typename Visit>
+static bool cl_wups_heap_walk(uint32_t heap, unsigned depth, Visit &&visit)
+{
+  uint32_t data_start, data_end;
+  uint32_t block, child;
+  uint16_t child_link;
+
+  if (!heap || guest_read32(heap + CL_WUPS_HEAP_TAG) != CL_WUPS_EXP_HEAP_TAG)
+    return false;
+  data_start = guest_read32(heap + CL_WUPS_HEAP_DATA_START);
+  data_end = guest_read32(heap + CL_WUPS_HEAP_DATA_END);
+
+  for (block = guest_read32(heap + CL_WUPS_EXP_HEAP_USED_HEAD); block;
+       block = guest_read32(block + CL_WUPS_EXP_BLOCK_NEXT))
+  {
+    uint32_t data = block + CL_WUPS_EXP_BLOCK_DATA;
+    uint32_t block_size;
+    const uint8_t *ptr;
+
+    /**
+     * The list is walked without the heap lock; stop if it looks torn, before
+     * reading anything through a pointer that may be garbage.
+     */
+    if (block < data_start || data < block || data > data_end)
+      break;
+    block_size = guest_read32(block + CL_WUPS_EXP_BLOCK_SIZE);
+    if (block_size > data_end - data)
+      break;
+    ptr = guest_range(data, block_size);
+    if (ptr && visit(ptr, block_size))
+      return true;
+  }
+
+  /* Emulators may carve their own heaps out of the base heap */
+  if (depth >= CL_WUPS_SCAN_HEAP_DEPTH)
+    return false;
+  child_link = guest_read16(heap + CL_WUPS_HEAP_CHILD_LINK_OFFSET);
+  for (child = guest_read32(heap + CL_WUPS_HEAP_CHILD_HEAD); child;
+       child = guest_read32(child + child_link + CL_WUPS_HEAP_LINK_NEXT))
+  {
+    if (child < data_start || child >= data_end)
+      break;
+    if (cl_wups_heap_walk(child, depth + 1, visit))
+      return true;
+  }
+
+  return false;
+}
+
+/**
+ * Looks for a ROM image at the start of the used blocks of the process heap.
+ * A ROM loaded into its own allocation starts right after the block header,
+ * whose size field then sits 0x10 bytes before the ROM, so only blocks at
+ * least as large as the smallest plausible ROM need to be looked at, and only
+ * their first few words.
+ * @param after If set, candidates are skipped up to and including this ROM.
+ * @param size Set to the size of the ROM image found.
+ */
+template <const scan_system_t &System>
+static const uint32_t *cl_wups_scan_heap(const uint8_t *after, uint32_t *size)
+{
+  const uint32_t *result = nullptr;
+
+  cl_wups_heap_walk(guest_heap(), 0,
+                    [&](const uint8_t *data, uint32_t block_size)
+  {
+    if (block_size < System.min_size)
+      return false;
+
+    for (uint32_t offset = 0;
+         offset < CL_WUPS_SCAN_HEAP_WINDOW;
+         offset += System.alignment)
+    {
+      auto match = (const uint32_t*)(data + offset + System.magic_offset);
+      uint32_t rom_size;
+
+      if (!cl_wups_scan_match<System>(guest_load32(match)) ||
+          !cl_wups_scan_accept<System>(match, 0))
+        continue;
+
+      /* The ROM must fit inside its allocation, or fill it */
+      rom_size = cl_wups_scan_size<System>(data + offset);
+      if (System.size_from_block && rom_size > block_size - offset)
+        rom_size = block_size - offset;
+      else if (rom_size > block_size - offset)
+        continue;
+
+      if (after)
+      {
+        if (after == data + offset)
+          after = nullptr;
+        continue;
+      }
+
+      result = match;
+      *size = rom_size;
+      return true;
+    }
+
+    return false;
+  });
+
+  return result;
+}
+
+/**
+ * Returns the size of a ROM image found outside of the heap walk. If the
+ * header only gives an upper bound, the image is cut off where the heap
+ * allocation it is in ends, then trimmed to its contents.
+ */
+template <const scan_system_t &System>
+static uint32_t cl_wups_scan_fit(const uint8_t *rom)
+{
+  uint32_t size = cl_wups_scan_size<System>(rom);
+
+  if constexpr (System.size_from_block)
+  {
+    cl_wups_heap_walk(guest_heap(), 0,
+                      [&](const uint8_t *data, uint32_t block_size)
+    {
+      if (rom < data || rom >= data + block_size)
+        return false;
+      if (size > block_size - (rom - data))
+        size = block_size - (rom - data);
+
+      return true;
+    });
+    size = cl_wups_scan_trim<System>(rom, size);
+  }
+
+  return size;
+}
+
+uint32_t scan_ram(uint32_t size, scan_ram_probe_t probe)
+{
+  const uint8_t *result = nullptr;
+  unsigned count = 0;
+
+  cl_wups_heap_walk(guest_heap(), 0,
+                    [&](const uint8_t *data, uint32_t block_size)
+  {
+    if (block_size != size || !probe(data))
+      return false;
+    result = data;
+
+    return ++count > 1;
+  });
+
+  return count == 1 ? guest_addr(result) : 0;
+}
+
+bool scan_ram_check(uint32_t ram, uint32_t size, scan_ram_probe_t probe)
+{
+  return cl_wups_heap_walk(guest_heap(), 0,
+                           [&](const uint8_t *data, uint32_t block_size)
+  {
+    return guest_addr(data) == ram && block_size == size && probe(data);
+  });
+}
+
+bool scan_probe_msx_ram(const uint8_t *ram)
+{
+  unsigned hooks = 0;
+  unsigned valid = 0;
+
+  /* H.KEYI to H.FORM, 5 bytes each */
+  for (uint32_t hook = 0xFD9A; hook <= 0xFFAC; hook += 5, hooks++)
+    if (ram[hook] == 0xC9 || ram[hook] == 0xF7 || ram[hook] == 0xC3)
+      valid++;
+
+  /* Allow for the odd hook a game has overwritten with something else */
+  return valid * 10 >= hooks * 9;
+}
+
+bool scan_probe_gba_iwram(const uint8_t *ram)
+{
+  uint32_t handler = (uint32_t)ram[0x7FFC] | (uint32_t)ram[0x7FFD] << 8 |
+                     (uint32_t)ram[0x7FFE] << 16 | (uint32_t)ram[0x7FFF] << 24;
+
+  return (handler >= 0x02000000 && handler < 0x02000000 + CL_WUPS_GBA_EWRAM_SIZE) ||
+         (handler >= 0x03000000 && handler < 0x03000000 + CL_WUPS_GBA_IWRAM_SIZE) ||
+         (handler >= 0x08000000 && handler < 0x0A000000);
+}
+
+static bool cl_wups_scan_cancelled(void)
+{
+  return scan.cancel && scan.cancel->load(std::memory_order_relaxed);
+}
+
+/* Whether the caller has rejected the ROM image at this location before */
+static bool cl_wups_scan_rejected(const scan_cursor_t *cursor,
+                                  const uint8_t *rom)
+{
+  for (unsigned i = 0; i < cursor->rejected_count; i++)
+    if (cursor->rejected[i] == rom)
+      return true;
+
+  return false;
+}
+
+/**
+ * Ends a slice of a time-sliced scan, sleeping out whatever is left of the
+ * frame it started in.
+ */
+static void cl_wups_scan_yield(OSTime *slice_start)
+{
+  OSTime elapsed = OSGetTime() - *slice_start;
+
+  if (elapsed < (OSTime)OSNanosecondsToTicks(CL_WUPS_SCAN_FRAME_NS))
+    OSSleepTicks(OSNanosecondsToTicks(CL_WUPS_SCAN_FRAME_NS) - elapsed);
+  else
+    OSYieldThread();
+  *slice_start = OSGetTime();
+}
+
+template <const scan_system_t &System>
+static int cl_wups_scan_worker(int argc, const char **argv)
+{
+  auto *worker = (cl_wups_scan_worker_t*)argv;
+  const uint32_t *i = worker->start;
+  const uint32_t *slice = i;
+  OSTime slice_start = OSGetTime();
+
+  while (i < worker->end)
+  {
+    const uint32_t *block_start = i;
+    const uint32_t *block_end = worker->end - i > CL_WUPS_SCAN_BLOCK ?
+      i + CL_WUPS_SCAN_BLOCK : worker->end;
+
+    /* A match in a lower part of the range always wins */
+    if (scan.found.load(std::memory_order_relaxed) < worker->index ||
+        cl_wups_scan_cancelled())
+      return 0;
+
+    for (; (i = cl_wups_scan_kernel(i, block_end, [](uint32_t word)
+                { return cl_wups_scan_match<System>(word); })) < block_end; i++)
+    {
+      if (cl_wups_scan_accept<System>(i, scan.skip_alignment))
+      {
+        unsigned found = scan.found.load(std::memory_order_relaxed);
+
+        worker->result = i;
+        while (worker->index < found &&
+               !scan.found.compare_exchange_weak(found, worker->index));
+
+        return 0;
+      }
+    }
+
+    scan.scanned.fetch_add((block_end - block_start) * sizeof(uint32_t),
+                           std::memory_order_relaxed);
+    if (scan.slice_words && (uint32_t)(i - slice) >= scan.slice_words)
+    {
+      cl_wups_scan_yield(&slice_start);
+      slice = i;
+    }
+  }
+
+  return 0;
+}
+
+/**
+ * Probes only the positions where the magic would be if the ROM started on
+ * the given alignment, on the calling thread.
+ */
+template <const scan_system_t &System>
+static const uint32_t *cl_wups_scan_strided(const uint32_t *start,
+                                            const uint32_t *end,
+                                            uint32_t alignment,
+                                            uint32_t skip_alignment)
+{
+  uintptr_t rom = ((uintptr_t)start - System.magic_offset + alignment - 1) &
+                  ~(uintptr_t)(alignment - 1);
+  OSTime slice_start = OSGetTime();
+  uint32_t probes = 0;
+
+  for (; rom + System.magic_offset < (uintptr_t)end; rom += alignment)
+  {
+    auto match = (const uint32_t*)(rom + System.magic_offset);
+
+    if (cl_wups_scan_cancelled())
+      return nullptr;
+
+    CL_WUPS_PREFETCH((const uint8_t*)match + alignment * CL_WUPS_SCAN_PREFETCH);
+    if (cl_wups_scan_match<System>(guest_load32(match)) &&
+        cl_wups_scan_accept<System>(match, skip_alignment))
+      return match;
+
+    /* Each probe reads in a whole cache block */
+    scan.scanned.fetch_add(CL_WUPS_SCAN_LINE * sizeof(uint32_t),
+                           std::memory_order_relaxed);
+    if (scan.slice_words && ++probes * CL_WUPS_SCAN_LINE >= scan.slice_words)
+    {
+      cl_wups_scan_yield(&slice_start);
+      probes = 0;
+    }
+  }
+
+  return nullptr;
+}
+
+template <const scan_system_t &System>
+static const uint32_t *cl_wups_scan_find(const uint32_t *start,
+                                         const uint32_t *end,
+                                         uint32_t skip_alignment)
+{
+  const uint32_t *result = nullptr;
+  size_t slice;
+  unsigned i;
+
+  if (end <= start)
+    return nullptr;
+  slice = (end - start) / CL_WUPS_SCAN_THREADS;
+  scan.skip_alignment = skip_alignment;
+  scan.found = CL_WUPS_SCAN_THREADS;
+
+  for (i = 0; i < CL_WUPS_SCAN_THREADS; i++)
+  {
+    cl_wups_scan_worker_t *worker = &scan.workers[i];
+
+    worker->index = i;
+    worker->start = start + slice * i;
+    worker->end = i == CL_WUPS_SCAN_THREADS - 1 ? end : worker->start + slice;
+    worker->result = nullptr;
+    worker->running = false;
+
+    /* Pin one worker to each core */
+    if (!OSCreateThread(&worker->thread,
+                        cl_wups_scan_worker<System>,
+                        1,
+                        (char*)worker,
+                        worker->stack + sizeof(worker->stack),
+                        sizeof(worker->stack),
+                        31,
+                        (OS_THREAD_ATTRIB_AFFINITY_CPU0 << i)))
+    {
+      /* Fall back to scanning this slice on the calling thread */
+      cl_wups_scan_worker<System>(1, (const char**)worker);
+    }
+    else
+    {
+      worker->running = true;
+      OSSetThreadName(&worker->thread, "Classics Live scanner");
+      OSResumeThread(&worker->thread);
+    }
+  }
+
+  for (i = 0; i < CL_WUPS_SCAN_THREADS; i++)
+  {
+    cl_wups_scan_worker_t *worker = &scan.workers[i];
+    int ret;
+
+    if (worker->running)
+      OSJoinThread(&worker->thread, &ret);
+    if (!result && worker->result)
+      result = worker->result;
+  }
+
+  return result;
+}
+
+template <const scan_system_t &System>
+bool scan_rom(scan_cursor_t *cursor)
+{
+  static_assert(System.magic_offset % sizeof(uint32_t) == 0,
+                "ROM header magic must be word-aligned");
+  static_assert(System.alignment >= sizeof(uint32_t) &&
+                !(System.alignment & (System.alignment - 1)),
+                "ROM alignment must be a power of two of at least a word");
+
+  /* Phase 0 walks the heap, the following ones search the address range */
+  if (cursor->phase == 0)
+  {
+    OSTime phase_start = OSGetTime();
+    const uint32_t *match;
+
+    do
+    {
+      match = cl_wups_scan_heap<System>(cursor->rom, &cursor->size);
+      if (match)
+        cursor->rom = (const uint8_t*)match - System.magic_offset;
+    } while (match && cl_wups_scan_rejected(cursor, cursor->rom));
+
+    cursor->ticks += OSGetTime() - phase_start;
+    if (match)
+    {
+      /* Left out of the heap walk itself, which is also used for polling */
+      cursor->size = cl_wups_scan_trim<System>(cursor->rom, cursor->size);
+      return true;
+    }
+    cursor->phase++;
+    cursor->rom = nullptr;
+  }
+
+  /* Without a known range, search all of the process heap */
+  uint32_t range_start = System.start;
+  uint32_t range_end = System.end;
+  const uint8_t *range;
+
+  if (!range_end)
+  {
+    uint32_t heap = guest_heap();
+
+    if (!heap)
+      return false;
+    range_start = guest_read32(heap + CL_WUPS_HEAP_DATA_START);
+    range_end = guest_read32(heap + CL_WUPS_HEAP_DATA_END);
+  }
+  if (range_end <= range_start ||
+      !(range = guest_range(range_start, range_end - range_start)))
+    return false;
+
+  scan.slice_words = cursor->slice_bytes / sizeof(uint32_t);
+  scan.cancel = cursor->cancel;
+  while (cursor->phase <= CL_WUPS_SCAN_COARSE_PHASES + 1)
+  {
+    OSTime phase_start = OSGetTime();
+    unsigned range_phase = cursor->phase - 1;
+    auto start = (const uint32_t*)range;
+    auto end = (const uint32_t*)(range + (range_end - range_start));
+    uint32_t skip_alignment = 0;
+    const uint32_t *match;
+
+    /* Continue after the previous result if it came from this phase */
+    if (cursor->rom)
+      start = (const uint32_t*)(cursor->rom + System.magic_offset) + 1;
+
+    /* Candidates at coarser alignments were checked by earlier phases */
+    for (unsigned i = 0; i < range_phase; i++)
+      if (cl_wups_scan_phases[i] > System.alignment)
+        skip_alignment = cl_wups_scan_phases[i];
+
+    if (range_phase < CL_WUPS_SCAN_COARSE_PHASES)
+    {
+      uint32_t alignment = cl_wups_scan_phases[range_phase];
+
+      if (alignment <= System.alignment)
+      {
+        cursor->phase++;
+        continue;
+      }
+      match = cl_wups_scan_strided<System>(start, end, alignment, skip_alignment);
+    }
+    else
+      match = cl_wups_scan_find<System>(start, end, skip_alignment);
+
+    cursor->scanned += scan.scanned.exchange(0);
+    cursor->ticks += OSGetTime() - phase_start;
+    if (cl_wups_scan_cancelled())
+      return false;
+
+    if (match)
+    {
+      cursor->rom = (const uint8_t*)match - System.magic_offset;
+
+      /* Carry on through this phase past images that were already rejected */
+      if (cl_wups_scan_rejected(cursor, cursor->rom))
+        continue;
+      cursor->size = cl_wups_scan_fit<System>(cursor->rom);
+
+      return true;
+    }
+    cursor->phase++;
+    cursor->rom = nullptr;
+  }
+
+  return false;
+}
+
+void scan_reject(scan_cursor_t *cursor, const uint8_t *rom)
+{
+  if (rom && !cl_wups_scan_rejected(cursor, rom) &&
+      cursor->rejected_count < CL_WUPS_SCAN_REJECTED)
+    cursor->rejected[cursor->rejected_count++] = rom;
+}
+
+template <const scan_system_t &System>
+uint32_t scan_check(const uint8_t *rom)
+{
+  auto match = (const uint32_t*)(rom + System.magic_offset);
+
+  if (!cl_wups_scan_match<System>(guest_load32(match)) ||
+      !cl_wups_scan_accept<System>(match, 0))
+    return 0;
+
+  return cl_wups_scan_fit<System>(rom);
+}
+
+template <const scan_system_t &System>
+bool scan_rom_loaded(void)
+{
+  uint32_t size;
+
+  return cl_wups_scan_heap<System>(nullptr, &size) != nullptr;
+}
+
+template bool scan_rom<scan_system_n64>(scan_cursor_t*);
+template bool scan_rom<scan_system_nds>(scan_cursor_t*);
+template bool scan_rom<scan_system_nes>(scan_cursor_t*);
+template bool scan_rom<scan_system_snes_lorom>(scan_cursor_t*);
+template bool scan_rom<scan_system_snes_hirom>(scan_cursor_t*);
+template bool scan_rom<scan_system_gba>(scan_cursor_t*);
+template uint32_t scan_check<scan_system_n64>(const uint8_t*);
+template uint32_t scan_check<scan_system_nds>(const uint8_t*);
+template uint32_t scan_check<scan_system_nes>(const uint8_t*);
+template uint32_t scan_check<scan_system_snes_lorom>(const uint8_t*);
+template uint32_t scan_check<scan_system_snes_hirom>(const uint8_t*);
+template bool scan_rom_loaded<scan_system_nes>(void);
+template bool scan_rom_loaded<scan_system_snes_lorom>(void);
+template bool scan_rom_loaded<scan_system_snes_hirom>(void);
+template uint32_t scan_check<scan_system_gba>(const uint8_t*);
+template bool scan_rom_loaded<scan_system_gba>(void);
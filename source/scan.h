@@ -0,0 +1,314 @@
+#ifndef CL_WUPS_SCAN_H
+#define CL_WUPS_SCAN_H
+
+#include <atomic>
+#include <cstdint>
+
+#include "title.h"
+
+/**
+ * Describes how to find the ROM image of one kind of Virtual Console title by
+ * scanning memory for a magic number in its header. Used as a template
+ * argument, so each system gets a scanner specialized for its values.
+ */
+typedef struct
+{
+  /* Host address range to scan, or 0 for all of the process heap */
+  uint32_t start;
+  uint32_t end;
+
+  /* Alignment of the ROM image in memory, in bytes */
+  uint32_t alignment;
+
+  /* Word in the ROM header to scan for, and its offset from the ROM start */
+  uint32_t magic;
+  uint32_t magic_offset;
+
+  /* Optional test for the word to scan for, if it is not a fixed value */
+  bool (*match)(uint32_t word);
+
+  /* Offset from the ROM start of the word holding the ROM size */
+  int32_t size_offset;
+
+  /* Optional function computing the ROM size from its header instead */
+  uint32_t (*get_size)(const uint8_t *rom);
+
+  /**
+   * Whether that size is only an upper bound, so that the ROM is taken to end
+   * where the heap allocation holding it does.
+   */
+  bool size_from_block;
+
+  /**
+   * Optional function cutting a size that was taken from the allocation down
+   * to the image itself, as allocations can be larger than what was loaded.
+   * Only applied to images being returned, not while polling for them.
+   */
+  uint32_t (*trim)(const uint8_t *rom, uint32_t size);
+
+  /* Smallest and largest plausible ROM sizes */
+  uint32_t min_size;
+  uint32_t max_size;
+
+  /**
+   * Optional further validation of a candidate ROM, run after the magic,
+   * alignment and size checks have passed.
+   */
+  bool (*validate)(const uint8_t *rom, uint32_t size);
+} scan_system_t;
+
+/* Nintendo 64: "vessel" keeps the ROM size 0x10 bytes behind the ROM */
+inline constexpr scan_system_t scan_system_n64 =
+{
+  0x14000000, 0x20000000,
+  4,
+  CL_WUPS_N64_ROM_MAGIC, 0, nullptr,
+  -0x10, nullptr, false, nullptr,
+  1 * 1024 * 1024, 64 * 1024 * 1024,
+  nullptr
+};
+
+/**
+ * Validates an NDS ROM header: the logo checksum, the header checksum, the
+ * unit code and the chip capacity must all agree with the given size.
+ */
+bool scan_validate_nds(const uint8_t *rom, uint32_t size);
+
+/* Nintendo DS: "hachihachi" keeps the ROM size 0x10 bytes behind the ROM */
+inline constexpr scan_system_t scan_system_nds =
+{
+  0x2A800000, 0x2B400000,
+  4,
+  CL_WUPS_NDS_ROM_MAGIC, CL_WUPS_NDS_ROM_MAGIC_OFFSET, nullptr,
+  -0x10, nullptr, false, nullptr,
+  128 * 1024, 512 * 1024 * 1024,
+  scan_validate_nds
+};
+
+/**
+ * Validates an iNES header by checking that its unused bytes are clear, which
+ * rules out matches on the string "NES" elsewhere in memory.
+ */
+bool scan_validate_nes(const uint8_t *rom, uint32_t size);
+
+/* Size of an iNES image from its header, trainer and PRG/CHR bank counts */
+uint32_t scan_size_nes(const uint8_t *rom);
+
+/**
+ * NES: the emulator has been seen to load the iNES image near the start of
+ * MEM2, at CL_WUPS_NES_ROM_HINT
+ */
+inline constexpr scan_system_t scan_system_nes =
+{
+  0x10000000, 0x10800000,
+  4,
+  CL_WUPS_NES_ROM_MAGIC, 0, nullptr,
+  0, scan_size_nes, false, nullptr,
+  16 + 16 * 1024, 8 * 1024 * 1024,
+  scan_validate_nes
+};
+
+/**
+ * Matches the SNES internal header's checksum complement and checksum, which
+ * are the only words it is guaranteed to have, by checking they add up.
+ */
+bool scan_match_snes(uint32_t word);
+
+/* Validates the SNES internal header at 0x7FC0 (LoROM) or 0xFFC0 (HiROM) */
+bool scan_validate_snes_lorom(const uint8_t *rom, uint32_t size);
+bool scan_validate_snes_hirom(const uint8_t *rom, uint32_t size);
+
+/* ROM size from the SNES internal header, rounded up to a power of two */
+uint32_t scan_size_snes_lorom(const uint8_t *rom);
+uint32_t scan_size_snes_hirom(const uint8_t *rom);
+
+/**
+ * Rounds an allocation-bound SNES ROM size down to whole 32 KB banks, as the
+ * emulator may allocate a little more than the image.
+ */
+uint32_t scan_trim_snes(const uint8_t *rom, uint32_t size);
+
+/**
+ * SNES: the emulator's ROM location is not known, so the whole process heap
+ * is searched. Each memory map has its header at a different offset.
+ */
+inline constexpr scan_system_t scan_system_snes_lorom =
+{
+  0, 0,
+  4,
+  0, 0x7FDC, scan_match_snes,
+  0, scan_size_snes_lorom, true, scan_trim_snes,
+  256 * 1024, 8 * 1024 * 1024,
+  scan_validate_snes_lorom
+};
+
+inline constexpr scan_system_t scan_system_snes_hirom =
+{
+  0, 0,
+  4,
+  0, 0xFFDC, scan_match_snes,
+  0, scan_size_snes_hirom, true, scan_trim_snes,
+  256 * 1024, 8 * 1024 * 1024,
+  scan_validate_snes_hirom
+};
+
+/**
+ * Validates a GBA header by its fixed byte, header complement check and
+ * Nintendo logo checksum.
+ */
+bool scan_validate_gba(const uint8_t *rom, uint32_t size);
+
+/* GBA headers have no ROM size, so this is the most the cartridge bus maps */
+uint32_t scan_size_gba(const uint8_t *rom);
+
+/**
+ * Cuts an allocation-bound GBA image size down to the power of two ROM dumps
+ * come in. An allocation that is already a power of two is taken as is, as
+ * dumps can end in long runs of padding. A larger one is cut down to the
+ * largest power of two it holds, unless data other than 0x00 or 0xFF
+ * padding lies past it, in which case only whole 32 KB are kept.
+ */
+uint32_t scan_trim_gba(const uint8_t *rom, uint32_t size);
+
+/**
+ * GBA: the emulator's ROM location is not known, so the whole process heap is
+ * searched, and the ROM size is found from its allocation and contents.
+ */
+inline constexpr scan_system_t scan_system_gba =
+{
+  0, 0,
+  4,
+  CL_WUPS_GBA_ROM_MAGIC, CL_WUPS_GBA_ROM_MAGIC_OFFSET, nullptr,
+  0, scan_size_gba, true, scan_trim_gba,
+  256 * 1024, 32 * 1024 * 1024,
+  scan_validate_gba
+};
+
+/**
+ * Scan kernel used by scan_rom. Finds the first word equal to magic in
+ * [start, end), comparing a full cache line of words per iteration and
+ * prefetching ahead of the current position.
+ * @return A pointer to the match, or end if none was found.
+ */
+const uint32_t *scan_block(const uint32_t *start, const uint32_t *end,
+                           uint32_t magic);
+
+/* ROM images a cursor can remember as rejected */
+#define CL_WUPS_SCAN_REJECTED 8
+
+/**
+ * Position of a ROM scan, so that it can be continued past a candidate that
+ * turned out not to be usable. Zero-initialize before the first scan_rom call.
+ */
+typedef struct
+{
+  /* The ROM image found by the last call, and its size */
+  const uint8_t *rom;
+  uint32_t size;
+
+  /* Heap walk, coarse alignments, then every word of the range */
+  unsigned phase;
+
+  /**
+   * Bytes of memory each scanning thread reads before sleeping out the rest
+   * of the current frame, or 0 to scan without yielding.
+   */
+  uint32_t slice_bytes;
+
+  /* Bytes of the address ranges searched so far, and the ticks it took */
+  uint32_t scanned;
+  uint64_t ticks;
+
+  /**
+   * Optional flag that abandons the search when set, checked between blocks
+   * and probes. A cancelled search returns false, as if nothing was found.
+   */
+  const std::atomic<bool> *cancel;
+
+  /**
+   * Images passed to scan_reject. Later phases find them again, as the heap
+   * lies within the address range; they are skipped instead of returned.
+   */
+  const uint8_t *rejected[CL_WUPS_SCAN_REJECTED];
+  unsigned rejected_count;
+} scan_cursor_t;
+
+/**
+ * Finds a ROM image matching a system description. The allocations of the
+ * foreground process heap are checked first, looking only at the start of
+ * blocks large enough to hold a ROM. If that finds nothing, the address
+ * range is searched: only likely ROM alignments (page boundaries, then 256
+ * and 32 bytes) are probed at first, and every word is only scanned if those
+ * find nothing. The full scan is split across a worker thread on each CPU
+ * core; workers give up as soon as a lower part of the range has produced a
+ * match, so within each phase the lowest-addressed candidate is returned.
+ * Across phases, a candidate at a coarser alignment is returned before one
+ * at a lower address that only a finer phase finds, so the lowest address
+ * overall is not guaranteed. With a slice size set, the search is spread
+ * over as many frames as needed, so the game and emulator threads sharing
+ * the cores keep their frame pacing.
+ * @return Whether a ROM image was found. On success, the cursor holds its
+ * location and size.
+ */
+template <const scan_system_t &System>
+bool scan_rom(scan_cursor_t *cursor);
+
+/**
+ * Marks a ROM image as unusable, for example because it could not be
+ * identified, so that scan_rom doesn't return it again. A cursor can be
+ * reused with another system of the same console to also skip the images
+ * rejected under the first: set its phase and rom back to 0 in between.
+ */
+void scan_reject(scan_cursor_t *cursor, const uint8_t *rom);
+
+/**
+ * Checks a known or previously found location for a ROM image, applying the
+ * same checks as scan_rom.
+ * @return The size of the ROM image, or 0 if there is none at that location.
+ */
+template <const scan_system_t &System>
+uint32_t scan_check(const uint8_t *rom);
+
+/**
+ * Returns whether a ROM image has been loaded into its own heap allocation,
+ * without searching any address range. Cheap enough to poll while waiting
+ * for the emulator to load the game.
+ */
+template <const scan_system_t &System>
+bool scan_rom_loaded(void);
+
+/**
+ * Checks that a heap block holds the emulated RAM being looked for, typically
+ * by data the emulated system's BIOS leaves at a fixed place. The size of a
+ * block alone says little, as the emulator and the OS allocate many others.
+ */
+typedef bool (*scan_ram_probe_t)(const uint8_t *ram);
+
+/**
+ * Checks for the MSX BIOS hook table at 0xFD9A in a 64 KB block of MSX main
+ * RAM. Every hook starts with a RET, or a call or jump if it has been set.
+ */
+bool scan_probe_msx_ram(const uint8_t *ram);
+
+/**
+ * Checks for the interrupt handler address the GBA BIOS calls through at
+ * 0x03007FFC in a 32 KB block of GBA IWRAM. Games point it at code in work
+ * RAM or the cartridge before enabling interrupts.
+ */
+bool scan_probe_gba_iwram(const uint8_t *ram);
+
+/**
+ * Finds emulated RAM that was given its own heap allocation, by looking for
+ * the only used block of exactly the given size that passes the probe.
+ * @return The address of the block, or 0 if there is no such block or
+ * more than one.
+ */
+uint32_t scan_ram(uint32_t size, scan_ram_probe_t probe);
+
+/**
+ * Checks that a previously found RAM location is still the start of a used
+ * heap block of the given size that passes the probe.
+ */
+bool scan_ram_check(uint32_t ram, uint32_t size, scan_ram_probe_t probe);
+
+#endif
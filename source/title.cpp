@@ -1,2889 +1,163 @@
+#include <cctype>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <malloc.h>
+
+#include <coreinit/dynload.h>
+
+#include "guest.h"
 #include "title.h"
+#include "titles_bin.h"
+
+/**
+ * Binary title database layout, as written by tools/titledb.py from
+ * data/titles.tsv and linked in through bin2o. The hash functions below must
+ * match the ones used by the generator.
+ */
+#define CL_WUPS_TITLEDB_MAGIC 0x434C5444 /* 'CLTD' */
+#define CL_WUPS_TITLEDB_VERSION 1
+
+typedef struct
+{
+  uint32_t magic;
+  uint32_t version;
+  uint32_t id_high;
+  uint32_t count;
+  uint32_t bucket_count;
+} cl_wups_titledb_header_t;
+
+typedef struct
+{
+  uint32_t id_high;
+  uint32_t count;
+  uint32_t bucket_count;
+  const uint16_t *disps;
+  const uint32_t *ids;
+  const uint8_t *types;
+} cl_wups_titledb_t;
+
+static cl_wups_titledb_t cl_wups_titledb_builtin;
+static cl_wups_titledb_t cl_wups_titledb_overlay;
+static bool cl_wups_titledb_overlay_tried = false;
+
+/**
+ * Virtual Console emulators, identified by a substring of the name of one of
+ * the modules they load.
+ */
+typedef struct
+{
+  const char *module;
+  unsigned type;
+} cl_wups_emulator_t;
 
-/* http://wiiubrew.org/wiki/Title_database#00050000:_eShop_and_disc_titles */
-static const cl_wups_title_t cl_wups_titles[] =
+static const cl_wups_emulator_t cl_wups_emulators[] =
 {
-  { 0x0005000010013000, CL_WUPS_TITLE_WII_U, /* Nintendo TVii (JPN) */ },
-  { 0x0005000010100600, CL_WUPS_TITLE_WII_U, /* 鉄拳タッグトーナメント2 Wii U EDITION (TEKKEN TAG TOURNAMENT 2 Wii U EDITION) (JPN) */ },
-  { 0x0005000010100D00, CL_WUPS_TITLE_WII_U, /* カラオケJOYSOUND for Wii U (JPN) */ },
-  { 0x0005000010101800, CL_WUPS_TITLE_WII_U, /* SiNG PARTY (USA) */ },
-  { 0x0005000010101900, CL_WUPS_TITLE_WII_U, /* SiNG PARTY (EUR) */ },
-  { 0x0005000010101A00, CL_WUPS_TITLE_WII_U, /* LEGO® CITY UNDERCOVER (USA) */ },
-  { 0x0005000010101B00, CL_WUPS_TITLE_WII_U, /* LEGO® CITY UNDERCOVER (EUR) */ },
-  { 0x0005000010101C00, CL_WUPS_TITLE_WII_U, /* NewスーパーマリオブラザーズU (New SUPER MARIO BROS. U) (JPN) */ },
-  { 0x0005000010101D00, CL_WUPS_TITLE_WII_U, /* New SUPER MARIO BROS. U (USA) */ },
-  { 0x0005000010101E00, CL_WUPS_TITLE_WII_U, /* New SUPER MARIO BROS. U (EUR) */ },
-  { 0x0005000010101F00, CL_WUPS_TITLE_WII_U, /* Nintendo Land (JPN) */ },
-  { 0x0005000010102000, CL_WUPS_TITLE_WII_U, /* Nintendo Land (USA) */ },
-  { 0x0005000010102100, CL_WUPS_TITLE_WII_U, /* Nintendo Land (EUR) */ },
-  { 0x0005000010102200, CL_WUPS_TITLE_WII_U, /* Wii Fit U (JPN) */ },
-  { 0x0005000010102300, CL_WUPS_TITLE_WII_U, /* Wii Fit U (USA) */ },
-  { 0x0005000010102400, CL_WUPS_TITLE_WII_U, /* Wii Fit U (EUR) */ },
-  { 0x0005000010102500, CL_WUPS_TITLE_WII_U, /* Nintendo×JOYSOUND Wii カラオケ U (JPN) */ },
-  { 0x0005000010102900, CL_WUPS_TITLE_WII_U, /* 出前館 (Demaecan) (JPN) */ },
-  { 0x0005000010102A00, CL_WUPS_TITLE_WII_U, /* YNN (JPN) */ },
-  { 0x0005000010102D00, CL_WUPS_TITLE_WII_U, /* Hulu (USA) */ },
-  { 0x0005000010102E00, CL_WUPS_TITLE_WII_U, /* Amazon Instant Video (USA) */ },
-  { 0x0005000010102F00, CL_WUPS_TITLE_WII_U, /* Amazon / LOVEFiLM (EUR) */ },
-  { 0x0005000010104C00, CL_WUPS_TITLE_WII_U, /* Hulu (JPN) */ },
-  { 0x0005000010104D00, CL_WUPS_TITLE_WII_U, /* モンスターハンター 3（トライ）G HD Ver. (MONSTER HUNTER 3(tri-)G HD Ver.) (JPN) */ },
-  { 0x0005000010105700, CL_WUPS_TITLE_WII_U, /* YouTube (ALL) */ },
-  { 0x0005000010105A00, CL_WUPS_TITLE_WII_U, /* Netflix (EUR/JAP/USA) */ },
-  { 0x0005000010106100, CL_WUPS_TITLE_WII_U, /* スーパーマリオ ３Ｄワールド (SUPER MARIO 3D WORLD) (JPN) */ },
-  { 0x0005000010106900, CL_WUPS_TITLE_WII_U, /* マリオ＆ソニック AT ソチオリンピック (Mario & Sonic at the Sochi 2014 Olympic Winter Games) (JPN) */ },
-  { 0x0005000010106B00, CL_WUPS_TITLE_WII_U, /* Assassin's Creed® III (USA) */ },
-  { 0x0005000010106C00, CL_WUPS_TITLE_NES, /* スーパーマリオブラザーズ (Super Mario Bros.) (JPN) */ },
-  { 0x0005000010106D00, CL_WUPS_TITLE_NES, /* Super Mario Bros. (USA) */ },
-  { 0x0005000010106E00, CL_WUPS_TITLE_NES, /* Super Mario Bros. (EUR) */ },
-  { 0x0005000010106F00, CL_WUPS_TITLE_NES, /* スーパーマリオブラザーズ３ (Super Mario Bros. 3) (JPN) */ },
-  { 0x0005000010107000, CL_WUPS_TITLE_NES, /* Super Mario Bros. 3 (USA) */ },
-  { 0x0005000010107100, CL_WUPS_TITLE_NES, /* Super Mario Bros. 3 (EUR) */ },
-  { 0x0005000010107200, CL_WUPS_TITLE_NES, /* アイスクライマー (Ice Climber) (JPN) */ },
-  { 0x0005000010107500, CL_WUPS_TITLE_NES, /* Ice Climber (USA) */ },
-  { 0x0005000010107600, CL_WUPS_TITLE_NES, /* Ice Climber (EUR) */ },
-  { 0x0005000010107700, CL_WUPS_TITLE_NES, /* 星のカービィ　夢の泉の物語 (Kirby's Adventure) (JPN) */ },
-  { 0x0005000010107800, CL_WUPS_TITLE_NES, /* Kirby's Adventure (USA) */ },
-  { 0x0005000010107900, CL_WUPS_TITLE_NES, /* Kirby's Adventure (EUR) */ },
-  { 0x0005000010107A00, CL_WUPS_TITLE_NES, /* Kirby's Adventure (EUR) */ },
-  { 0x0005000010107B00, CL_WUPS_TITLE_NES, /* マリオブラザーズ (Mario Bros.) (JPN) */ },
-  { 0x0005000010107C00, CL_WUPS_TITLE_NES, /* Mario Bros. (USA) */ },
-  { 0x0005000010107D00, CL_WUPS_TITLE_NES, /* Mario Bros. (EUR) */ },
-  { 0x0005000010107E00, CL_WUPS_TITLE_NES, /* ドンキーコング (Donkey Kong) (JPN) */ },
-  { 0x0005000010107F00, CL_WUPS_TITLE_NES, /* Donkey Kong (USA) */ },
-  { 0x0005000010108000, CL_WUPS_TITLE_NES, /* Donkey Kong (EUR) */ },
-  { 0x0005000010108100, CL_WUPS_TITLE_NES, /* エキサイトバイク (Excitebike) (JPN) */ },
-  { 0x0005000010108200, CL_WUPS_TITLE_NES, /* Excitebike (USA) */ },
-  { 0x0005000010108300, CL_WUPS_TITLE_NES, /* Excitebike (EUR) */ },
-  { 0x0005000010108400, CL_WUPS_TITLE_NES, /* スーパーマリオＵＳＡ (Super Mario USA) (JPN) */ },
-  { 0x0005000010108500, CL_WUPS_TITLE_NES, /* Super Mario Bros. 2 (USA) */ },
-  { 0x0005000010108600, CL_WUPS_TITLE_NES, /* Super Mario Bros. 2 (EUR) */ },
-  { 0x0005000010108700, CL_WUPS_TITLE_NES, /* バルーンファイト (Balloon Fight) (JPN) */ },
-  { 0x0005000010108800, CL_WUPS_TITLE_NES, /* Balloon Fight (USA) */ },
-  { 0x0005000010108900, CL_WUPS_TITLE_NES, /* Balloon Fight (EUR) */ },
-  { 0x0005000010108A00, CL_WUPS_TITLE_NES, /* パンチアウト (Punch Out!!) (JPN) */ },
-  { 0x0005000010108B00, CL_WUPS_TITLE_NES, /* Punch-Out!! Featuring Mr. Dream (USA) */ },
-  { 0x0005000010108C00, CL_WUPS_TITLE_NES, /* Punch-Out!! (EUR) */ },
-  { 0x0005000010108E00, CL_WUPS_TITLE_SNES, /* スーパーマリオワールド (Super Mario World) (JPN) */ },
-  { 0x0005000010108F00, CL_WUPS_TITLE_SNES, /* Super Mario World (USA) */ },
-  { 0x0005000010109000, CL_WUPS_TITLE_SNES, /* Super Mario World (EUR) */ },
-  { 0x0005000010109100, CL_WUPS_TITLE_SNES, /* スーパーマリオRPG (Super Mario RPG) (JPN) */ },
-  { 0x0005000010109200, CL_WUPS_TITLE_SNES, /* Super Mario RPG: Legend of the Seven Stars (USA) */ },
-  { 0x0005000010109300, CL_WUPS_TITLE_SNES, /* Super Mario RPG: Legend of the Seven Stars (EUR) */ },
-  { 0x0005000010109400, CL_WUPS_TITLE_SNES, /* スーパードンキーコング (Donkey Kong Country) (JPN) */ },
-  { 0x0005000010109500, CL_WUPS_TITLE_SNES, /* Donkey Kong Country (USA) */ },
-  { 0x0005000010109600, CL_WUPS_TITLE_SNES, /* Donkey Kong Country (EUR) */ },
-  { 0x0005000010109700, CL_WUPS_TITLE_SNES, /* ゼルダの伝説 神々のトライフォース (The Legend of Zelda: A Link to the Past) (JPN) */ },
-  { 0x0005000010109800, CL_WUPS_TITLE_SNES, /* The Legend of Zelda: A Link to the Past (USA) */ },
-  { 0x0005000010109900, CL_WUPS_TITLE_SNES, /* The Legend of Zelda: A Link to the Past (EUR) */ },
-  { 0x0005000010109A00, CL_WUPS_TITLE_SNES, /* The Legend of Zelda: A Link to the Past (EUR) */ },
-  { 0x0005000010109B00, CL_WUPS_TITLE_SNES, /* The Legend of Zelda: A Link to the Past (EUR) */ },
-  { 0x0005000010109C00, CL_WUPS_TITLE_SNES, /* 星のカービィ スーパーデラックス (Kirby Super Star) (JPN) */ },
-  { 0x0005000010109D00, CL_WUPS_TITLE_SNES, /* Kirby Super Star (USA) */ },
-  { 0x0005000010109E00, CL_WUPS_TITLE_SNES, /* Kirby Super Star (EUR) */ },
-  { 0x0005000010109F00, CL_WUPS_TITLE_SNES, /* ファイアーエムブレム　聖戦の系譜 (Fire Emblem: Genealogy of the Holy War) (JPN) */ },
-  { 0x000500001010A000, CL_WUPS_TITLE_SNES, /* スーパードンキーコング2 ディクシー&ディディー (Donkey Kong Country 2 Diddy's Kong Quest) (JPN) */ },
-  { 0x000500001010A100, CL_WUPS_TITLE_SNES, /* Donkey Kong Country 2: Diddy's Kong Quest (USA) */ },
-  { 0x000500001010A200, CL_WUPS_TITLE_SNES, /* Donkey Kong Country 2™: Diddy's Kong Quest (EUR) */ },
-  { 0x000500001010A300, CL_WUPS_TITLE_SNES, /* Donkey Kong Country 2: Diddy's Kong Quest (EUR) */ },
-  { 0x000500001010A400, CL_WUPS_TITLE_SNES, /* ファイアーエムブレム　紋章の謎 (Fire Emblem: Mystery of the Emblem) (JPN) */ },
-  { 0x000500001010A500, CL_WUPS_TITLE_SNES, /* スーパーメトロイド (Super Metroid) (JPN) */ },
-  { 0x000500001010A600, CL_WUPS_TITLE_SNES, /* Super Metroid (USA) */ },
-  { 0x000500001010A700, CL_WUPS_TITLE_SNES, /* Super Metroid (EUR) */ },
-  { 0x000500001010A800, CL_WUPS_TITLE_SNES, /* スーパーマリオカート (Super Mario Kart) (JPN) */ },
-  { 0x000500001010A900, CL_WUPS_TITLE_SNES, /* Super Mario Kart (USA) */ },
-  { 0x000500001010AA00, CL_WUPS_TITLE_SNES, /* Super Mario Kart (EUR) */ },
-  { 0x000500001010AB00, CL_WUPS_TITLE_WII_U, /* Batman: Arkham City Armored Edition (USA) */ },
-  { 0x000500001010AC00, CL_WUPS_TITLE_WII_U, /* BEN 10 OMNIVERSE™ (USA) */ },
-  { 0x000500001010AD00, CL_WUPS_TITLE_WII_U, /* Darksiders II (USA) */ },
-  { 0x000500001010AE00, CL_WUPS_TITLE_WII_U, /* JUST DANCE 4 (USA) */ },
-  { 0x000500001010AF00, CL_WUPS_TITLE_WII_U, /* Marvel Avengers™: Battle for Earth (USA) */ },
-  { 0x000500001010B000, CL_WUPS_TITLE_WII_U, /* Rabbids Land (USA) */ },
-  { 0x000500001010B100, CL_WUPS_TITLE_WII_U, /* Rayman Legends (USA) */ },
-  { 0x000500001010B200, CL_WUPS_TITLE_WII_U, /* Scribblenauts Unlimited (USA) */ },
-  { 0x000500001010B300, CL_WUPS_TITLE_WII_U, /* Sonic & All-Stars Racing Transformed (USA) */ },
-  { 0x000500001010B400, CL_WUPS_TITLE_WII_U, /* ESPN Sports Connection (USA) */ },
-  { 0x000500001010B500, CL_WUPS_TITLE_WII_U, /* TRANSFORMERS PRIME (USA) */ },
-  { 0x000500001010B600, CL_WUPS_TITLE_WII_U, /* Your Shape®: Fitness Evolved 2013 (USA) */ },
-  { 0x000500001010B800, CL_WUPS_TITLE_WII_U, /* Wii カラオケ U トライアルディスク (JPN) */ },
-  { 0x000500001010C700, CL_WUPS_TITLE_WII_U, /* Mario & Sonic at the Sochi 2014 Olympic Winter Games (USA) */ },
-  { 0x000500001010C800, CL_WUPS_TITLE_WII_U, /* Mario & Sonic at the Sochi 2014 Olympic Winter Games (EUR) */ },
-  { 0x000500001010CF00, CL_WUPS_TITLE_WII_U, /* Call of Duty: Black Ops II (USA) */ },
-  { 0x000500001010D700, CL_WUPS_TITLE_WII_U, /* Skylanders Giants (USA) */ },
-  { 0x000500001010D800, CL_WUPS_TITLE_WII_U, /* Madden NFL 13 (USA) */ },
-  { 0x000500001010D900, CL_WUPS_TITLE_WII_U, /* FIFA Soccer 13 (USA) */ },
-  { 0x000500001010DA00, CL_WUPS_TITLE_WII_U, /* NBA 2K13 (USA) */ },
-  { 0x000500001010DB00, CL_WUPS_TITLE_WII_U, /* Disney Epic Mickey 2 (USA) */ },
-  { 0x000500001010DC00, CL_WUPS_TITLE_WII_U, /* Mass Effect™ 3 Special Edition (USA) */ },
-  { 0x000500001010DD00, CL_WUPS_TITLE_WII_U, /* ZombiU (USA) */ },
-  { 0x000500001010E300, CL_WUPS_TITLE_WII_U, /* Splinter Cell Blacklist (USA) */ },
-  { 0x000500001010E400, CL_WUPS_TITLE_WII_U, /* Game Party Champions (USA) */ },
-  { 0x000500001010E600, CL_WUPS_TITLE_WII_U, /* 007™ Legends (USA) */ },
-  { 0x000500001010E700, CL_WUPS_TITLE_WII_U, /* Dangerous Hunts 2013 (USA) */ },
-  { 0x000500001010E800, CL_WUPS_TITLE_WII_U, /* Wipeout 3 (USA) */ },
-  { 0x000500001010EA00, CL_WUPS_TITLE_WII_U, /* 無双OROCHI２ Hyper (WARRIORS OROCHI 3 Hyper(JP)) (JPN) */ },
-  { 0x000500001010EB00, CL_WUPS_TITLE_WII_U, /* MARIO KART 8 (JPN) */ },
-  { 0x000500001010EC00, CL_WUPS_TITLE_WII_U, /* MARIO KART 8 (USA) */ },
-  { 0x000500001010ED00, CL_WUPS_TITLE_WII_U, /* MARIO KART 8 (EUR) */ },
-  { 0x000500001010EE00, CL_WUPS_TITLE_WII_U, /* FIFA 13 (EUR) */ },
-  { 0x000500001010EF00, CL_WUPS_TITLE_WII_U, /* ZombiU (EUR) */ },
-  { 0x000500001010F000, CL_WUPS_TITLE_WII_U, /* JUST DANCE 4 (EUR) */ },
-  { 0x000500001010F100, CL_WUPS_TITLE_WII_U, /* RISE OF THE GUARDIANS (EUR) */ },
-  { 0x000500001010F200, CL_WUPS_TITLE_WII_U, /* RISE OF THE GUARDIANS (USA) */ },
-  { 0x000500001010F300, CL_WUPS_TITLE_WII_U, /* Family Party 30 Great Games Obstacle Arcade (USA) */ },
-  { 0x000500001010F400, CL_WUPS_TITLE_WII_U, /* TRANSFORMERS PRIME (EUR) */ },
-  { 0x000500001010F500, CL_WUPS_TITLE_WII_U, /* Mass Effect 3 Special Edition (EUR) */ },
-  { 0x000500001010F600, CL_WUPS_TITLE_WII_U, /* Assassin's Creed® III (EUR) */ },
-  { 0x000500001010F700, CL_WUPS_TITLE_WII_U, /* Your Shape® Fitness Evolved 2013 (EUR) */ },
-  { 0x000500001010F800, CL_WUPS_TITLE_WII_U, /* TEKKEN TAG TOURNAMENT 2 Wii U EDITION (EUR) */ },
-  { 0x000500001010F900, CL_WUPS_TITLE_WII_U, /* Scribblenauts Unlimited (EUR) */ },
-  { 0x000500001010FA00, CL_WUPS_TITLE_WII_U, /* The Cave (USA) */ },
-  { 0x000500001010FB00, CL_WUPS_TITLE_WII_U, /* Puddle (EUR) */ },
-  { 0x000500001010FC00, CL_WUPS_TITLE_WII_U, /* Rabbids Land (EUR) */ },
-  { 0x000500001010FD00, CL_WUPS_TITLE_WII_U, /* TANK! TANK! TANK! (USA) */ },
-  { 0x000500001010FE00, CL_WUPS_TITLE_WII_U, /* TANK! TANK! TANK! (EUR) */ },
-  { 0x000500001010FF00, CL_WUPS_TITLE_WII_U, /* Game Party Champions (EUR) */ },
-  { 0x0005000010110000, CL_WUPS_TITLE_WII_U, /* TEKKEN TAG TOURNAMENT 2 Wii U EDITION (USA) */ },
-  { 0x0005000010110100, CL_WUPS_TITLE_WII_U, /* Nano Assault Neo (USA) */ },
-  { 0x0005000010110200, CL_WUPS_TITLE_WII_U, /* WARRIORS OROCHI 3 Hyper(NA) (USA) */ },
-  { 0x0005000010110500, CL_WUPS_TITLE_WII_U, /* Puddle (USA) */ },
-  { 0x0005000010110600, CL_WUPS_TITLE_WII_U, /* Nano Assault Neo (EUR) */ },
-  { 0x0005000010110700, CL_WUPS_TITLE_WII_U, /* 007™ Legends (EUR) */ },
-  { 0x0005000010110800, CL_WUPS_TITLE_WII_U, /* Marvel Avengers™: Battle for Earth (EUR) */ },
-  { 0x0005000010110900, CL_WUPS_TITLE_WII_U, /* NINJA GAIDEN 3: Razor's Edge (JPN) */ },
-  { 0x0005000010110A00, CL_WUPS_TITLE_WII_U, /* NINJA GAIDEN 3: Razor's Edge (USA) */ },
-  { 0x0005000010110B00, CL_WUPS_TITLE_WII_U, /* Ninja Gaiden 3: Razor's Edge (EUR) */ },
-  { 0x0005000010110C00, CL_WUPS_TITLE_WII_U, /* FIFA 13 ワールドクラスサッカー (FIFA 13 World Class Soccer) (JPN) */ },
-  { 0x0005000010110E00, CL_WUPS_TITLE_WII_U, /* 大乱闘スマッシュブラザーズ for Wii U (Super Smash Bros. for Wii U) (JPN) */ },
-  { 0x0005000010110F00, CL_WUPS_TITLE_WII_U, /* Darksiders II (EUR) */ },
-  { 0x0005000010111000, CL_WUPS_TITLE_WII_U, /* BEN 10 OMNIVERSE™ (EUR) */ },
-  { 0x0005000010111100, CL_WUPS_TITLE_WII_U, /* Jeopardy! (USA) */ },
-  { 0x0005000010111200, CL_WUPS_TITLE_WII_U, /* Wheel of Fortune (USA) */ },
-  { 0x0005000010111300, CL_WUPS_TITLE_WII_U, /* Batman Arkham City: Armoured Edition (EUR) */ },
-  { 0x0005000010111400, CL_WUPS_TITLE_WII_U, /* Rayman Legends (EUR) */ },
-  { 0x0005000010111600, CL_WUPS_TITLE_WII_U, /* Fast & Furious™: Showdown (USA) */ },
-  { 0x0005000010111700, CL_WUPS_TITLE_WII_U, /* Injustice: Gods Among Us (USA) */ },
-  { 0x0005000010111A00, CL_WUPS_TITLE_WII_U, /* Injustice: Gods Among Us (EUR) */ },
-  { 0x0005000010111B00, CL_WUPS_TITLE_WII_U, /* 3DS版モンスターハンター3G・ パケットリレーツール (MONSTER HUNTER 3 ULTIMATE Packet Relay...for Nintendo 3DS) (JPN) */ },
-  { 0x0005000010111C00, CL_WUPS_TITLE_WII_U, /* 三國志12 (Romance of the Three Kingdoms 12) (JPN) */ },
-  { 0x0005000010111D00, CL_WUPS_TITLE_WII_U, /* Sports Connection (EUR) */ },
-  { 0x0005000010111E00, CL_WUPS_TITLE_WII_U, /* Scribblenauts Unlimited (EUR) */ },
-  { 0x0005000010111F00, CL_WUPS_TITLE_WII_U, /* Sonic & All-Stars Racing Transformed (EUR) */ },
-  { 0x0005000010112000, CL_WUPS_TITLE_WII_U, /* THE CROODS (USA) */ },
-  { 0x0005000010112100, CL_WUPS_TITLE_WII_U, /* Know Your Friends (EUR) */ },
-  { 0x0005000010112200, CL_WUPS_TITLE_WII_U, /* Trine 2 Director's Cut (EUR) */ },
-  { 0x0005000010112300, CL_WUPS_TITLE_WII_U, /* ゾンビU (ZombiU) (JPN) */ },
-  { 0x0005000010112400, CL_WUPS_TITLE_WII_U, /* アサシン クリード III (Assassin's Creed® III) (JPN) */ },
-  { 0x0005000010112500, CL_WUPS_TITLE_WII_U, /* スポーツコネクション (Sports Connection) (JPN) */ },
-  { 0x0005000010112600, CL_WUPS_TITLE_WII_U, /* レイマン レジェンド (Rayman Legends) (JPN) */ },
-  { 0x0005000010112700, CL_WUPS_TITLE_WII_U, /* ラビッツランド (Rabbids Land) (JPN) */ },
-  { 0x0005000010112800, CL_WUPS_TITLE_WII_U, /* Splinter Cell Blacklist (JPN) */ },
-  { 0x0005000010112900, CL_WUPS_TITLE_WII_U, /* Batman Arkham City: Armoured Edition (JPN) */ },
-  { 0x0005000010112B00, CL_WUPS_TITLE_WII_U, /* WARRIORS OROCHI 3 Hyper(EU) (EUR) */ },
-  { 0x0005000010112D00, CL_WUPS_TITLE_WII_U, /* ゲーム＆ワリオ (Game & Wario) (JPN) */ },
-  { 0x0005000010112E00, CL_WUPS_TITLE_WII_U, /* Disney Epic Mickey 2 (EUR) */ },
-  { 0x0005000010112F00, CL_WUPS_TITLE_WII_U, /* NBA 2K13 (EUR) */ },
-  { 0x0005000010113000, CL_WUPS_TITLE_WII_U, /* マスエフェクト3 - 特別版 - (Mass Effect™ 3 Special Edition) (JPN) */ },
-  { 0x0005000010113100, CL_WUPS_TITLE_WII_U, /* BIOHAZARD REVELATIONS Unveiled Edition (JPN) */ },
-  { 0x0005000010113200, CL_WUPS_TITLE_WII_U, /* Family Party 30 Great Games Obstacle Arcade (EUR) */ },
-  { 0x0005000010113300, CL_WUPS_TITLE_WII_U, /* The Smurfs™ 2 (USA) */ },
-  { 0x0005000010113400, CL_WUPS_TITLE_WII_U, /* Call of Duty: Black Ops II (EUR) */ },
-  { 0x0005000010113500, CL_WUPS_TITLE_WII_U, /* Call of Duty: Black Ops II (EUR) */ },
-  { 0x0005000010113600, CL_WUPS_TITLE_WII_U, /* タンク！タンク！タンク！ (TANK! TANK! TANK!) (JPN) */ },
-  { 0x0005000010113700, CL_WUPS_TITLE_WII_U, /* Call of Duty: Black Ops II (EUR) */ },
-  { 0x0005000010113800, CL_WUPS_TITLE_WII_U, /* Zen Pinball 2 (EUR) */ },
-  { 0x0005000010113A00, CL_WUPS_TITLE_WII_U, /* CastleStorm (EUR) */ },
-  { 0x0005000010113B00, CL_WUPS_TITLE_WII_U, /* KickBeat Special Edition (EUR) */ },
-  { 0x0005000010113C00, CL_WUPS_TITLE_WII_U, /* Funky Barn (USA) */ },
-  { 0x0005000010113D00, CL_WUPS_TITLE_WII_U, /* Rapala® Pro Bass Fishing (USA) */ },
-  { 0x0005000010113E00, CL_WUPS_TITLE_NES, /* ゼビウス (Xevious) (JPN) */ },
-  { 0x0005000010113F00, CL_WUPS_TITLE_NES, /* Xevious (USA) */ },
-  { 0x0005000010114000, CL_WUPS_TITLE_NES, /* Xevious (EUR) */ },
-  { 0x0005000010114100, CL_WUPS_TITLE_NES, /* ヨッシーのたまご (Yoshi's Egg) (JPN) */ },
-  { 0x0005000010114200, CL_WUPS_TITLE_NES, /* Yoshi (USA) */ },
-  { 0x0005000010114300, CL_WUPS_TITLE_NES, /* Mario&Yoshi (EUR) */ },
-  { 0x0005000010114400, CL_WUPS_TITLE_NES, /* ロックマン (Rockman) (JPN) */ },
-  { 0x0005000010114500, CL_WUPS_TITLE_NES, /* MEGA MAN (USA) */ },
-  { 0x0005000010114600, CL_WUPS_TITLE_NES, /* MEGA MAN (EUR) */ },
-  { 0x0005000010114700, CL_WUPS_TITLE_NES, /* ロックマン2 Dr.ワイリーの謎 (Rockman 2) (JPN) */ },
-  { 0x0005000010114800, CL_WUPS_TITLE_NES, /* MEGA MAN 2 (USA) */ },
-  { 0x0005000010114900, CL_WUPS_TITLE_NES, /* MEGA MAN 2 (EUR) */ },
-  { 0x0005000010114A00, CL_WUPS_TITLE_NES, /* ダウンタウン熱血行進曲 それゆけ大運動会 (Downtown Nekketsu March Super-Awesome Field Day!) (JPN) */ },
-  { 0x0005000010114B00, CL_WUPS_TITLE_NES, /* がんばれゴエモン ゆき姫救出絵巻 (The Legend of The Mystical Ninja) (JPN) */ },
-  { 0x0005000010114C00, CL_WUPS_TITLE_NES, /* The Legend of The Mystical Ninja (USA) */ },
-  { 0x0005000010114D00, CL_WUPS_TITLE_NES, /* The Legend of The Mystical Ninja (EUR) */ },
-  { 0x0005000010114E00, CL_WUPS_TITLE_NES, /* The Legend of The Mystical Ninja (EUR) */ },
-  { 0x0005000010114F00, CL_WUPS_TITLE_SNES, /* ストリートファイターⅡ ザ ワールド ウォーリアー (Street Fighter Ⅱ The World Warrior) (JPN) */ },
-  { 0x0005000010115000, CL_WUPS_TITLE_SNES, /* Street Fighter II The World Warrior (USA) */ },
-  { 0x0005000010115100, CL_WUPS_TITLE_SNES, /* Street Fighter II The World Warrior (EUR) */ },
-  { 0x0005000010115200, CL_WUPS_TITLE_SNES, /* 星のカービィ3 (Kirby's Dream Land 3) (JPN) */ },
-  { 0x0005000010115300, CL_WUPS_TITLE_SNES, /* Kirby's Dream Land 3 (USA) */ },
-  { 0x0005000010115400, CL_WUPS_TITLE_SNES, /* Kirby's Dream Land 3 (EUR) */ },
-  { 0x0005000010115A00, CL_WUPS_TITLE_SNES, /* マリオのスーパーピクロス (Mario's Super Picross) (JPN) */ },
-  { 0x0005000010115B00, CL_WUPS_TITLE_SNES, /* Mario's Super Picross (EUR) */ },
-  { 0x0005000010115D00, CL_WUPS_TITLE_WII_U, /* The Smurfs™ 2 (EUR) */ },
-  { 0x0005000010115E00, CL_WUPS_TITLE_WII_U, /* ドラゴンクエストⅩ 目覚めし五つの種族 オンライン (Dragon Quest X Awakening of the Five Tribes) (JPN) */ },
-  { 0x0005000010115E00, CL_WUPS_TITLE_WII_U, /* Dragon Quest X: All In One Package (JPN) */ },
-  { 0x0005000010115E00, CL_WUPS_TITLE_WII_U, /* Dragon Quest X: All In One Package (JPN) */ },
-  { 0x0005000010115E00, CL_WUPS_TITLE_WII_U, /* Dragon Quest X: All In One Package - Version1-Version4 (JPN) */ },
-  { 0x0005000010115F00, CL_WUPS_TITLE_WII_U, /* Zen Pinball 2 (USA) */ },
-  { 0x0005000010116000, CL_WUPS_TITLE_WII_U, /* Skylanders Giants (EUR) */ },
-  { 0x0005000010116100, CL_WUPS_TITLE_WII_U, /* XenobladeX (JPN) */ },
-  { 0x0005000010116300, CL_WUPS_TITLE_WII_U, /* The Wonderful 101 (JPN) */ },
-  { 0x0005000010116400, CL_WUPS_TITLE_WII_U, /* ニコニコ (niconico) (JPN) */ },
-  { 0x0005000010116500, CL_WUPS_TITLE_WII_U, /* Toki Tori 2 (EUR) */ },
-  { 0x0005000010116600, CL_WUPS_TITLE_WII_U, /* 真・北斗無双 (Fist of the North Star: Ken's Rage 2) (JPN) */ },
-  { 0x0005000010116700, CL_WUPS_TITLE_WII_U, /* KickBeat Special Edition (USA) */ },
-  { 0x0005000010117200, CL_WUPS_TITLE_WII_U, /* MONSTER HUNTER 3 ULTIMATE (EUR) */ },
-  { 0x0005000010117700, CL_WUPS_TITLE_WII_U, /* Chasing Aurora (EUR) */ },
-  { 0x0005000010117800, CL_WUPS_TITLE_WII_U, /* Kung Fu Rabbit (EUR) */ },
-  { 0x0005000010118000, CL_WUPS_TITLE_WII_U, /* SIMPLEシリーズ for Wii U Vol.1 THE ファミリーパーティー  (SIMPLE Series for Wii U Vol.1 THE FamilyParty) (JPN) */ },
-  { 0x0005000010118100, CL_WUPS_TITLE_WII_U, /* Barbie Dreamhouse Party (USA) */ },
-  { 0x0005000010118200, CL_WUPS_TITLE_WII_U, /* Monster High 13 Wishes (USA) */ },
-  { 0x0005000010118300, CL_WUPS_TITLE_WII_U, /* MONSTER HUNTER 3 ULTIMATE (USA) */ },
-  { 0x0005000010118400, CL_WUPS_TITLE_WII_U, /* Funky Barn (EUR) */ },
-  { 0x0005000010119100, CL_WUPS_TITLE_NES, /* パックマン (PAC-MAN) (JPN) */ },
-  { 0x0005000010119200, CL_WUPS_TITLE_NES, /* PAC-MAN (USA) */ },
-  { 0x0005000010119300, CL_WUPS_TITLE_NES, /* PAC-MAN (EUR) */ },
-  { 0x0005000010119400, CL_WUPS_TITLE_NES, /* スペランカー (Spelunker) (JPN) */ },
-  { 0x0005000010119500, CL_WUPS_TITLE_NES, /* グラディウス (Gradius) (JPN) */ },
-  { 0x0005000010119700, CL_WUPS_TITLE_NES, /* GRADIUS (EUR) */ },
-  { 0x0005000010119800, CL_WUPS_TITLE_NES, /* ツインビー (TwinBee) (JPN) */ },
-  { 0x0005000010119900, CL_WUPS_TITLE_SNES, /* Ｆ－ＺＥＲＯ (JPN) */ },
-  { 0x0005000010119A00, CL_WUPS_TITLE_SNES, /* F-Zero (USA) */ },
-  { 0x0005000010119B00, CL_WUPS_TITLE_SNES, /* F-Zero (EUR) */ },
-  { 0x0005000010119C00, CL_WUPS_TITLE_SNES, /* カービィボウル (Kirby's Dream Course) (JPN) */ },
-  { 0x0005000010119D00, CL_WUPS_TITLE_SNES, /* Kirby's Dream Course (USA) */ },
-  { 0x0005000010119E00, CL_WUPS_TITLE_SNES, /* Kirby's Dream Course (EUR) */ },
-  { 0x0005000010119F00, CL_WUPS_TITLE_SNES, /* 超魔界村 (Super Ghouls'n Ghosts) (JPN) */ },
-  { 0x000500001011A000, CL_WUPS_TITLE_SNES, /* Super Ghouls'n Ghosts (USA) */ },
-  { 0x000500001011A100, CL_WUPS_TITLE_SNES, /* Super Ghouls'n Ghosts (EUR) */ },
-  { 0x000500001011A200, CL_WUPS_TITLE_SNES, /* がんばれゴエモン2 奇天烈将軍マッギネス (Ganbare Goemon 2 Kiteretsu Shōgun Magginesu) (JPN) */ },
-  { 0x000500001011A300, CL_WUPS_TITLE_SNES, /* スーパーストリートファイターⅡ ザ ニューチャレンジャーズ (Super Street Fighter Ⅱ The New Challengers) (JPN) */ },
-  { 0x000500001011A400, CL_WUPS_TITLE_SNES, /* Super Street Fighter Ⅱ The New Challengers (USA) */ },
-  { 0x000500001011A500, CL_WUPS_TITLE_SNES, /* Super Street Fighter Ⅱ The New Challengers (EUR) */ },
-  { 0x000500001011A600, CL_WUPS_TITLE_WII_U, /* Dangerous Hunts 2013 (EUR) */ },
-  { 0x000500001011A700, CL_WUPS_TITLE_WII_U, /* ZombiU (EUR) */ },
-  { 0x000500001011A800, CL_WUPS_TITLE_WII_U, /* Wii Party U (JPN) */ },
-  { 0x000500001011A900, CL_WUPS_TITLE_NES, /* Spelunker (USA) */ },
-  { 0x000500001011AA00, CL_WUPS_TITLE_NES, /* Spelunker (EUR) */ },
-  { 0x000500001011AB00, CL_WUPS_TITLE_NES, /* ロードランナー (Lode Runner) (JPN) */ },
-  { 0x000500001011AC00, CL_WUPS_TITLE_NES, /* Lode Runner (USA) */ },
-  { 0x000500001011AD00, CL_WUPS_TITLE_NES, /* Lode Runner (EUR) */ },
-  { 0x000500001011AE00, CL_WUPS_TITLE_NES, /* GRADIUS (USA) */ },
-  { 0x000500001011AF00, CL_WUPS_TITLE_WII_U, /* BIT.TRIP Presents... Runner2: Future Legend of Rhythm Alien (USA) */ },
-  { 0x000500001011B000, CL_WUPS_TITLE_WII_U, /* Disney Epic Mickey 2 (EUR) */ },
-  { 0x000500001011B100, CL_WUPS_TITLE_WII_U, /* Mighty Switch Force!™ Hyper Drive Edition (USA) */ },
-  { 0x000500001011B200, CL_WUPS_TITLE_WII_U, /* Little Inferno (USA) */ },
-  { 0x000500001011B300, CL_WUPS_TITLE_WII_U, /* Funky Barn (Download Version) (EUR) */ },
-  { 0x000500001011B400, CL_WUPS_TITLE_WII_U, /* Call of Duty: Black Ops II (JPN) */ },
-  { 0x000500001011B600, CL_WUPS_TITLE_WII_U, /* ドラゴンクエストⅩ ベータテスト版 (Dragon Quest X Beta test) (JPN) */ },
-  { 0x000500001011B700, CL_WUPS_TITLE_WII_U, /* UPLAY (EUR) */ },
-  { 0x000500001011B900, CL_WUPS_TITLE_WII_U, /* BAYONETTA 2 (JPN) */ },
-  { 0x000500001011BA00, CL_WUPS_TITLE_WII_U, /* Uplay (USA) */ },
-  { 0x000500001011C000, CL_WUPS_TITLE_WII_U, /* Chasing Aurora (USA) */ },
-  { 0x000500001011C100, CL_WUPS_TITLE_WII_U, /* Mutant Mudds Deluxe (USA) */ },
-  { 0x000500001011C300, CL_WUPS_TITLE_WII_U, /* The Amazing Spider-Man (USA) */ },
-  { 0x000500001011C500, CL_WUPS_TITLE_WII_U, /* Disney Planes (USA) */ },
-  { 0x000500001011C600, CL_WUPS_TITLE_WII_U, /* Cloudberry Kingdom (USA) */ },
-  { 0x000500001011F200, CL_WUPS_TITLE_WII_U, /* Game & Wario (USA) */ },
-  { 0x000500001011F300, CL_WUPS_TITLE_WII_U, /* The Walking Dead: Survival Instinct (USA) */ },
-  { 0x0005000010128200, CL_WUPS_TITLE_WII_U, /* Mighty Switch Force!™ Hyper Drive Edition (EUR) */ },
-  { 0x0005000010128300, CL_WUPS_TITLE_WII_U, /* The Amazing Spider-Man (EUR) */ },
-  { 0x0005000010128400, CL_WUPS_TITLE_WII_U, /* Need for Speed™ Most Wanted U (EUR) */ },
-  { 0x0005000010128600, CL_WUPS_TITLE_WII_U, /* Little Inferno (EUR) */ },
-  { 0x0005000010128700, CL_WUPS_TITLE_WII_U, /* Toki Tori 2 (USA) */ },
-  { 0x0005000010128800, CL_WUPS_TITLE_WII_U, /* Need for Speed™ Most Wanted U (USA) */ },
-  { 0x0005000010128900, CL_WUPS_TITLE_WII_U, /* GAME & WARIO (EUR) */ },
-  { 0x0005000010128A00, CL_WUPS_TITLE_WII_U, /* Trine 2 Director's Cut (USA) */ },
-  { 0x0005000010128C00, CL_WUPS_TITLE_WII_U, /* TANK! TANK! TANK! (DL) (EUR) */ },
-  { 0x0005000010128F00, CL_WUPS_TITLE_WII_U, /* SONIC LOST WORLD (USA) */ },
-  { 0x0005000010129000, CL_WUPS_TITLE_WII_U, /* DuckTales Remastered (USA) */ },
-  { 0x0005000010129200, CL_WUPS_TITLE_WII_U, /* DuckTales Remastered (EUR) */ },
-  { 0x0005000010129400, CL_WUPS_TITLE_WII_U, /* The Walking Dead: Survival Instinct (EUR) */ },
-  { 0x0005000010129500, CL_WUPS_TITLE_WII_U, /* Funky Barn (Download Version) (USA) */ },
-  { 0x0005000010129600, CL_WUPS_TITLE_WII_U, /* Wii U Panorama View 予告編 (Trailer) (JPN) */ },
-  { 0x0005000010129700, CL_WUPS_TITLE_NES, /* ドンキーコングJR. (Donkey Kong Jr.) (JPN) */ },
-  { 0x0005000010129800, CL_WUPS_TITLE_NES, /* Donkey Kong Jr. (USA) */ },
-  { 0x0005000010129900, CL_WUPS_TITLE_NES, /* Donkey Kong Jr. (EUR) */ },
-  { 0x0005000010129A00, CL_WUPS_TITLE_NES, /* 忍者じゃじゃ丸くん (Ninja JaJaMaru-kun) (JPN) */ },
-  { 0x0005000010129B00, CL_WUPS_TITLE_NES, /* ソロモンの鍵 (Solomon's Key) (JPN) */ },
-  { 0x0005000010129C00, CL_WUPS_TITLE_NES, /* Solomon's Key (USA) */ },
-  { 0x0005000010129D00, CL_WUPS_TITLE_NES, /* Solomon's Key (EUR) */ },
-  { 0x0005000010129E00, CL_WUPS_TITLE_NES, /* ロックマン3 Dr.ワイリーの最期! (Mega Man 3) (JPN) */ },
-  { 0x0005000010129F00, CL_WUPS_TITLE_NES, /* MEGA MAN 3 (USA) */ },
-  { 0x000500001012A000, CL_WUPS_TITLE_NES, /* MEGA MAN 3 (EUR) */ },
-  { 0x000500001012A100, CL_WUPS_TITLE_NES, /* マッピー (Mappy) (JPN) */ },
-  { 0x000500001012A200, CL_WUPS_TITLE_SNES, /* カービィのきらきらきっず (Kirby's Star Stacker) (JPN) */ },
-  { 0x000500001012A300, CL_WUPS_TITLE_NES, /* がんばれゴエモン3 獅子重禄兵衛のからくり卍固め (Ganbare Goemon 3: Shishijūrokubē no Karakuri Manji Gatame) (JPN) */ },
-  { 0x000500001012A500, CL_WUPS_TITLE_SNES, /* ストリートファイターⅡ ターボ ハイパー ファイティング (Street Fighter II Turbo Hyper Fighting) (JPN) */ },
-  { 0x000500001012A600, CL_WUPS_TITLE_SNES, /* Street Fighter II Turbo Hyper Fighting (USA) */ },
-  { 0x000500001012A700, CL_WUPS_TITLE_SNES, /* かまいたちの夜 (Banshee's Last Cry) (JPN) */ },
-  { 0x000500001012A800, CL_WUPS_TITLE_SNES, /* ヘラクレスの栄光Ⅲ 神々の沈黙 (Heracles no Eikō III: Kamigami no Chinmoku) (JPN) */ },
-  { 0x000500001012AC00, CL_WUPS_TITLE_WII_U, /* Tom Clancy's Splinter Cell Blacklist (EUR) */ },
-  { 0x000500001012AD00, CL_WUPS_TITLE_SNES, /* Street Fighter II Turbo Hyper Fighting (EUR) */ },
-  { 0x000500001012B100, CL_WUPS_TITLE_WII_U, /* SONIC LOST WORLD (EUR) */ },
-  { 0x000500001012B200, CL_WUPS_TITLE_WII_U, /* DEUS EX HUMAN REV. DIRECTOR'S CUT (EUR) */ },
-  { 0x000500001012B400, CL_WUPS_TITLE_WII_U, /* RESIDENT EVIL REVELATIONS (EUR) */ },
-  { 0x000500001012B500, CL_WUPS_TITLE_WII_U, /* The Cave (EUR) */ },
-  { 0x000500001012B700, CL_WUPS_TITLE_WII_U, /* Need for Speed™ Most Wanted U (JPN) */ },
-  { 0x000500001012B800, CL_WUPS_TITLE_WII_U, /* Fist of the North Star: Ken's Rage 2 (EUR) */ },
-  { 0x000500001012B900, CL_WUPS_TITLE_WII_U, /* Fist of the North Star: Ken's Rage 2 (USA) */ },
-  { 0x000500001012BA00, CL_WUPS_TITLE_WII_U, /* DEUS EX HUMAN REV. DIRECTOR'S CUT (USA) */ },
-  { 0x000500001012BC00, CL_WUPS_TITLE_WII_U, /* ピクミン３ (PIKMIN 3) (JPN) */ },
-  { 0x000500001012BD00, CL_WUPS_TITLE_WII_U, /* PIKMIN 3 (USA) */ },
-  { 0x000500001012BE00, CL_WUPS_TITLE_WII_U, /* PIKMIN 3 (EUR) */ },
-  { 0x000500001012BF00, CL_WUPS_TITLE_WII_U, /* Dungeons & Dragons: Chronicles of Mystara (EUR) */ },
-  { 0x000500001012C000, CL_WUPS_TITLE_WII_U, /* Dungeons & Dragons®: Chronicles of Mystara™ (USA) */ },
-  { 0x000500001012C400, CL_WUPS_TITLE_WII_U, /* Disney Epic Mickey 2 (EUR) */ },
-  { 0x000500001012C500, CL_WUPS_TITLE_WII_U, /* THE CROODS (EUR) */ },
-  { 0x000500001012CB00, CL_WUPS_TITLE_WII_U, /* 2.1.0U System Update Disc (USA) */ },
-  { 0x000500001012CC00, CL_WUPS_TITLE_WII_U, /* 2.1.0E System Update Disc (EUR) */ },
-  { 0x000500001012CD00, CL_WUPS_TITLE_WII_U, /* Jett Tailfin (USA) */ },
-  { 0x000500001012CF00, CL_WUPS_TITLE_WII_U, /* RESIDENT EVIL REVELATIONS (USA) */ },
-  { 0x000500001012D000, CL_WUPS_TITLE_WII_U, /* Cocoto Magic Circus 2 (EUR) */ },
-  { 0x000500001012D300, CL_WUPS_TITLE_WII_U, /* Wii Street U powered by Google (JPN) */ },
-  { 0x000500001012D400, CL_WUPS_TITLE_WII_U, /* Wii U Panorama View ロンドンバスでいこう (Double-Decker Tour) (JPN) */ },
-  { 0x000500001012D500, CL_WUPS_TITLE_WII_U, /* Wii U Panorama View 鳥の飛行隊 (Bird's-Eye View) (JPN) */ },
-  { 0x000500001012D600, CL_WUPS_TITLE_WII_U, /* Wii U Panorama View リオでカーニバル! (Carnival in Rio) (JPN) */ },
-  { 0x000500001012D700, CL_WUPS_TITLE_WII_U, /* Wii U Panorama View 京の町ゆく人力車 (Kyoto Sightseeing) (JPN) */ },
-  { 0x000500001012D800, CL_WUPS_TITLE_WII_U, /* Kung Fu Rabbit (USA) */ },
-  { 0x000500001012DA00, CL_WUPS_TITLE_WII_U, /* Fast & Furious™: Showdown (EUR) */ },
-  { 0x000500001012DC00, CL_WUPS_TITLE_WII_U, /* The Wonderful 101 (USA) */ },
-  { 0x000500001012DE00, CL_WUPS_TITLE_NES, /* レッキングクルー (Wrecking Crew) (JPN) */ },
-  { 0x000500001012DF00, CL_WUPS_TITLE_NES, /* Wrecking Crew (USA) */ },
-  { 0x000500001012E000, CL_WUPS_TITLE_NES, /* Wrecking Crew (EUR) */ },
-  { 0x000500001012E100, CL_WUPS_TITLE_NES, /* ふぁみこんむかし話 新･鬼ヶ島（前後編） (Famicom Mukashibanashi: Shin Onigashima) (JPN) */ },
-  { 0x000500001012E200, CL_WUPS_TITLE_NES, /* ギャラガ (Galaga) (JPN) */ },
-  { 0x000500001012E300, CL_WUPS_TITLE_NES, /* Galaga (USA) */ },
-  { 0x000500001012E400, CL_WUPS_TITLE_NES, /* Galaga (EUR) */ },
-  { 0x000500001012E600, CL_WUPS_TITLE_NES, /* ロックマン4 新たなる野望!! (Mega Man 4) (JPN) */ },
-  { 0x000500001012E700, CL_WUPS_TITLE_NES, /* MEGA MAN 4 (USA) */ },
-  { 0x000500001012E800, CL_WUPS_TITLE_NES, /* MEGA MAN 4 (EUR) */ },
-  { 0x000500001012E900, CL_WUPS_TITLE_SNES, /* パネルでポン (Panel de Pon) (JPN) */ },
-  { 0x000500001012EC00, CL_WUPS_TITLE_SNES, /* 真･女神転生 (Shin Megami Tensei) (JPN) */ },
-  { 0x000500001012ED00, CL_WUPS_TITLE_NES, /* 魂斗羅スピリッツ (Contra Spirits) (JPN) */ },
-  { 0x000500001012EE00, CL_WUPS_TITLE_SNES, /* CONTRA III THE ALIEN WARS (USA) */ },
-  { 0x000500001012EF00, CL_WUPS_TITLE_SNES, /* CONTRA III THE ALIEN WARS (EUR) */ },
-  { 0x000500001012F000, CL_WUPS_TITLE_WII_U, /* FAST Racing NEO (USA) */ },
-  { 0x000500001012F100, CL_WUPS_TITLE_WII_U, /* Wii Sports Club (JPN) */ },
-  { 0x000500001012F200, CL_WUPS_TITLE_WII_U, /* タンク！タンク！タンク！ (DL) (TANK! TANK! TANK! (DL)) (JPN) */ },
-  { 0x000500001012F300, CL_WUPS_TITLE_NES, /* メトロイド (Metroid) (JPN) */ },
-  { 0x000500001012F400, CL_WUPS_TITLE_NES, /* Metroid (USA) */ },
-  { 0x000500001012F500, CL_WUPS_TITLE_NES, /* Metroid (EUR) */ },
-  { 0x000500001012F600, CL_WUPS_TITLE_NES, /* スーパーマリオブラザーズ２ (Super Mario Bros. 2) (JPN) */ },
-  { 0x000500001012F700, CL_WUPS_TITLE_NES, /* Super Mario Bros.: The Lost Levels (USA) */ },
-  { 0x000500001012F800, CL_WUPS_TITLE_NES, /* Super Mario Bros.: The Lost Levels (EUR) */ },
-  { 0x000500001012F900, CL_WUPS_TITLE_NES, /* ゼルダの伝説 (The Legend of Zelda) (JPN) */ },
-  { 0x000500001012FA00, CL_WUPS_TITLE_NES, /* The Legend of Zelda (USA) */ },
-  { 0x000500001012FB00, CL_WUPS_TITLE_NES, /* The Legend of Zelda (EUR) */ },
-  { 0x000500001012FC00, CL_WUPS_TITLE_NES, /* 光神話　パルテナの鏡 (Kid Icarus) (JPN) */ },
-  { 0x000500001012FD00, CL_WUPS_TITLE_NES, /* Kid Icarus (USA) */ },
-  { 0x000500001012FE00, CL_WUPS_TITLE_NES, /* Kid Icarus (EUR) */ },
-  { 0x000500001012FF00, CL_WUPS_TITLE_NES, /* リンクの冒険 (Zelda II - The Adventure of Link) (JPN) */ },
-  { 0x0005000010130000, CL_WUPS_TITLE_NES, /* Zelda II - The Adventure of Link (USA) */ },
-  { 0x0005000010130100, CL_WUPS_TITLE_NES, /* Zelda II - The Adventure of Link (EUR) */ },
-  { 0x0005000010130200, CL_WUPS_TITLE_NES, /* ファミコン探偵倶楽部 PARTⅡ うしろに立つ少女 (Famicom Detective Club Part II: The Girl Who Stands Behind) (JPN) */ },
-  { 0x0005000010130300, CL_WUPS_TITLE_SNES, /* パイロットウイングス (Pilotwings) (JPN) */ },
-  { 0x0005000010130400, CL_WUPS_TITLE_SNES, /* Pilotwings (USA) */ },
-  { 0x0005000010130500, CL_WUPS_TITLE_SNES, /* Pilotwings (EUR) */ },
-  { 0x0005000010130600, CL_WUPS_TITLE_SNES, /* ファイナルファイト (Final Fight) (JPN) */ },
-  { 0x0005000010130700, CL_WUPS_TITLE_SNES, /* Final Fight (USA) */ },
-  { 0x0005000010130800, CL_WUPS_TITLE_SNES, /* Final Fight (EUR) */ },
-  { 0x0005000010130900, CL_WUPS_TITLE_SNES, /* 悪魔城ドラキュラ (Vampire Killer) (JPN) */ },
-  { 0x0005000010130A00, CL_WUPS_TITLE_SNES, /* Super Castlevania IV (USA) */ },
-  { 0x0005000010130B00, CL_WUPS_TITLE_SNES, /* Super Castlevania IV (EUR) */ },
-  { 0x0005000010130C00, CL_WUPS_TITLE_SNES, /* ロックマンX (Mega Man X) (JPN) */ },
-  { 0x0005000010130D00, CL_WUPS_TITLE_SNES, /* Mega Man X (USA) */ },
-  { 0x0005000010130E00, CL_WUPS_TITLE_SNES, /* Mega Man X (EUR) */ },
-  { 0x0005000010131000, CL_WUPS_TITLE_WII_U, /* Wii U Panorama View Double-Decker Tour (USA) */ },
-  { 0x0005000010131100, CL_WUPS_TITLE_WII_U, /* Wii U Panorama View Bird's-Eye View (USA) */ },
-  { 0x0005000010131200, CL_WUPS_TITLE_WII_U, /* Wii U Panorama View Carnival in Rio (USA) */ },
-  { 0x0005000010131300, CL_WUPS_TITLE_WII_U, /* Wii U Panorama View Kyoto Sightseeing (USA) */ },
-  { 0x0005000010131400, CL_WUPS_TITLE_WII_U, /* Wii U Panorama View Double-Decker Tour (EUR) */ },
-  { 0x0005000010131500, CL_WUPS_TITLE_WII_U, /* Wii U Panorama View Birds in Flight (EUR) */ },
-  { 0x0005000010131600, CL_WUPS_TITLE_WII_U, /* Wii U Panorama View Carnival! (EUR) */ },
-  { 0x0005000010131700, CL_WUPS_TITLE_WII_U, /* Wii U Panorama View Rickshaw Around Kyoto (EUR) */ },
-  { 0x0005000010131900, CL_WUPS_TITLE_WII_U, /* F1 RACE STARS POWERED UP EDITION (EUR) */ },
-  { 0x0005000010131A00, CL_WUPS_TITLE_WII_U, /* Cloudberry Kingdom (EUR) */ },
-  { 0x0005000010131B00, CL_WUPS_TITLE_WII_U, /* Wii U Panorama View Trailer (USA) */ },
-  { 0x0005000010131C00, CL_WUPS_TITLE_WII_U, /* Wii U Panorama View Trailer (EUR) */ },
-  { 0x0005000010131D00, CL_WUPS_TITLE_WII_U, /* 幻影異聞録♯ＦＥ (Tokyo Mirage Sessions #FE) (JPN) */ },
-  { 0x0005000010131E00, CL_WUPS_TITLE_WII_U, /* ポケモンスクランブル Ｕ (Pokémon Rumble U) (JPN) */ },
-  { 0x0005000010131F00, CL_WUPS_TITLE_WII_U, /* ヨッシー ウールワールド (Yoshi's Woolly World) (JPN) */ },
-  { 0x0005000010132000, CL_WUPS_TITLE_WII_U, /* Wii Street U powered by Google (USA) */ },
-  { 0x0005000010132100, CL_WUPS_TITLE_WII_U, /* Wii Street U powered by Google (EUR) */ },
-  { 0x0005000010132200, CL_WUPS_TITLE_WII_U, /* 太鼓の達人 Ｗｉｉ Ｕば～じょん！ (Taiko no Tatsujin Wii U version!) (JPN) */ },
-  { 0x0005000010132400, CL_WUPS_TITLE_WII_U, /* LEGO® Marvel Super Heroes (EUR) */ },
-  { 0x0005000010132500, CL_WUPS_TITLE_WII_U, /* Wii Fit U デイリーチェック (Wii Fit U Quick Check) (JPN) */ },
-  { 0x0005000010132600, CL_WUPS_TITLE_WII_U, /* Wii Fit U Quick Check (USA) */ },
-  { 0x0005000010132700, CL_WUPS_TITLE_WII_U, /* Wii Fit U Quick Check (EUR) */ },
-  { 0x0005000010132800, CL_WUPS_TITLE_WII_U, /* Unepic EnjoyUp Games (USA) */ },
-  { 0x0005000010132900, CL_WUPS_TITLE_WII_U, /* Disney INFINITY (USA) */ },
-  { 0x0005000010132A00, CL_WUPS_TITLE_WII_U, /* Star Wars Pinball (EUR) */ },
-  { 0x0005000010132B00, CL_WUPS_TITLE_WII_U, /* LEGO® Marvel Super Heroes (USA) */ },
-  { 0x0005000010132C00, CL_WUPS_TITLE_WII_U, /* Scribblenauts Unmasked A DC Comics Adventure (USA) */ },
-  { 0x0005000010132D00, CL_WUPS_TITLE_WII_U, /* Scribblenauts Unmasked A DC Comics Adventure (EUR) */ },
-  { 0x0005000010132F00, CL_WUPS_TITLE_WII_U, /* MONSTER HUNTER 3 ULTIMATE Packet Relay...for Nintendo 3DS (EUR) */ },
-  { 0x0005000010133000, CL_WUPS_TITLE_NES, /* MOTHER (JPN) */ },
-  { 0x0005000010133100, CL_WUPS_TITLE_NES, /* EarthBound Beginnings (USA) */ },
-  { 0x0005000010133200, CL_WUPS_TITLE_NES, /* EarthBound Beginnings (EUR) */ },
-  { 0x0005000010133300, CL_WUPS_TITLE_SNES, /* MOTHER2 ギーグの逆襲 (JPN) */ },
-  { 0x0005000010133400, CL_WUPS_TITLE_SNES, /* EarthBound (USA) */ },
-  { 0x0005000010133500, CL_WUPS_TITLE_SNES, /* EarthBound (EUR) */ },
-  { 0x0005000010133600, CL_WUPS_TITLE_WII_U, /* MONSTER HUNTER 3 ULTIMATE Packet Relay...for Nintendo 3DS (USA) */ },
-  { 0x0005000010133700, CL_WUPS_TITLE_WII_U, /* CastleStorm (USA) */ },
-  { 0x0005000010133800, CL_WUPS_TITLE_WII_U, /* TANK! TANK! TANK! (DL) (USA) */ },
-  { 0x0005000010133900, CL_WUPS_TITLE_WII_U, /* Turbo: Super Stunt Squad (USA) */ },
-  { 0x0005000010133A00, CL_WUPS_TITLE_WII_U, /* F1 RACE STARS POWERED UP EDITION (JPN) */ },
-  { 0x0005000010133B00, CL_WUPS_TITLE_WII_U, /* Sniper Elite V2 (EUR) */ },
-  { 0x0005000010133C00, CL_WUPS_TITLE_NES, /* いっき (Ikki) (JPN) */ },
-  { 0x0005000010134000, CL_WUPS_TITLE_NES, /* 高橋名人の冒険島 (Adventure Island) (JPN) */ },
-  { 0x0005000010134100, CL_WUPS_TITLE_NES, /* Adventure Island (USA) */ },
-  { 0x0005000010134200, CL_WUPS_TITLE_NES, /* Adventure Island (EUR) */ },
-  { 0x0005000010134300, CL_WUPS_TITLE_NES, /* 魔界村 (Ghosts'n Goblins) (JPN) */ },
-  { 0x0005000010134400, CL_WUPS_TITLE_NES, /* Ghosts'n Goblins (USA) */ },
-  { 0x0005000010134500, CL_WUPS_TITLE_NES, /* Ghosts'n Goblins (EUR) */ },
-  { 0x0005000010134600, CL_WUPS_TITLE_SNES, /* 三國志Ⅳ (Romance of The 3 Kingdoms IV Wall of Fire) (JPN) */ },
-  { 0x0005000010134700, CL_WUPS_TITLE_SNES, /* Romance of The 3 Kingdoms Ⅳ Wall of Fire (USA) */ },
-  { 0x0005000010134A00, CL_WUPS_TITLE_SNES, /* ブレス オブ ファイアⅡ 使命の子 (Breath of Fire II) (JPN) */ },
-  { 0x0005000010134B00, CL_WUPS_TITLE_SNES, /* Breath of Fire II (USA) */ },
-  { 0x0005000010134C00, CL_WUPS_TITLE_SNES, /* Breath of Fire II (EUR) */ },
-  { 0x0005000010134D00, CL_WUPS_TITLE_SNES, /* ファイアーエムブレム  トラキア776 (Fire Emblem Thracia 776) (JPN) */ },
-  { 0x0005000010134E00, CL_WUPS_TITLE_WII_U, /* Sniper Elite V2 (USA) */ },
-  { 0x0005000010135000, CL_WUPS_TITLE_WII_U, /* Art of Balance (USA) */ },
-  { 0x0005000010135100, CL_WUPS_TITLE_WII_U, /* Darts Up (USA) */ },
-  { 0x0005000010135200, CL_WUPS_TITLE_WII_U, /* Star Wars Pinball (USA) */ },
-  { 0x0005000010135300, CL_WUPS_TITLE_WII_U, /* The Wonderful 101 (EUR) */ },
-  { 0x0005000010135500, CL_WUPS_TITLE_WII_U, /* LEGO® Batman™ 2 (EUR) */ },
-  { 0x0005000010135600, CL_WUPS_TITLE_WII_U, /* 運命の洞窟 THE CAVE (JPN) */ },
-  { 0x0005000010135700, CL_WUPS_TITLE_WII_U, /* ソニック ロストワールド (SONIC LOST WORLD) (JPN) */ },
-  { 0x0005000010135C00, CL_WUPS_TITLE_SNES, /* スーパーファミコンウォーズ (Super Famicom Wars) (JPN) */ },
-  { 0x0005000010135E00, CL_WUPS_TITLE_WII_U, /* LEGO® Batman™ 2 (USA) */ },
-  { 0x0005000010136000, CL_WUPS_TITLE_SNES, /* Romance of The 3 Kingdoms Ⅳ Wall of Fire (EUR) */ },
-  { 0x0005000010136100, CL_WUPS_TITLE_WII_U, /* バンダイチャンネル (BANDAI CHANNEL) (JPN) */ },
-  { 0x0005000010136300, CL_WUPS_TITLE_WII_U, /* BIT.TRIP Presents... Runner2: Future Legend of Rhythm Alien (EUR) */ },
-  { 0x0005000010136400, CL_WUPS_TITLE_WII_U, /* ナノアサルト ネオ (NANO ASSAULT NEO) (JPN) */ },
-  { 0x0005000010136500, CL_WUPS_TITLE_WII_U, /* 龍が如く １＆２ ＨＤ for Wii U (Ryu-ga gotoku 1&2 HD for Wii U) (JPN) */ },
-  { 0x0005000010136700, CL_WUPS_TITLE_WII_U, /* Turbo: Super Stunt Squad (EUR) */ },
-  { 0x0005000010136900, CL_WUPS_TITLE_WII_U, /* Disney Planes (EUR) */ },
-  { 0x0005000010136A00, CL_WUPS_TITLE_WII_U, /* Disney Planes (EUR) */ },
-  { 0x0005000010136B00, CL_WUPS_TITLE_WII_U, /* Disney Planes (EUR) */ },
-  { 0x0005000010136C00, CL_WUPS_TITLE_WII_U, /* Batman™: Arkham Origins (EUR) */ },
-  { 0x0005000010136D00, CL_WUPS_TITLE_WII_U, /* Disney Epic Mickey 2 (JPN) */ },
-  { 0x0005000010136F00, CL_WUPS_TITLE_WII_U, /* Disney Infinity (USA) */ },
-  { 0x0005000010137000, CL_WUPS_TITLE_WII_U, /* Disney Infinity (USA) */ },
-  { 0x0005000010137200, CL_WUPS_TITLE_WII_U, /* Fit Music for Wii U (EUR) */ },
-  { 0x0005000010137300, CL_WUPS_TITLE_SNES, /* はじまりの森 (Famicom Bunko: Hajimari no Mori) (JPN) */ },
-  { 0x0005000010137400, CL_WUPS_TITLE_SNES, /* Vegas Stakes (USA) */ },
-  { 0x0005000010137500, CL_WUPS_TITLE_SNES, /* Vegas Stakes (EUR) */ },
-  { 0x0005000010137600, CL_WUPS_TITLE_SNES, /* Harvest Moon (USA) */ },
-  { 0x0005000010137700, CL_WUPS_TITLE_SNES, /* Harvest Moon (EUR) */ },
-  { 0x0005000010137800, CL_WUPS_TITLE_SNES, /* Harvest Moon (EUR) */ },
-  { 0x0005000010137A00, CL_WUPS_TITLE_SNES, /* Final Fight 2 (USA) */ },
-  { 0x0005000010137B00, CL_WUPS_TITLE_SNES, /* Final Fight 2 (EUR) */ },
-  { 0x0005000010137C00, CL_WUPS_TITLE_WII_U, /* Batman™: Arkham Origins (USA) */ },
-  { 0x0005000010137D00, CL_WUPS_TITLE_WII_U, /* Wii Party U (USA) */ },
-  { 0x0005000010137E00, CL_WUPS_TITLE_WII_U, /* Wii Party U (EUR) */ },
-  { 0x0005000010137F00, CL_WUPS_TITLE_WII_U, /* Donkey Kong Country Tropical Freeze (USA) */ },
-  { 0x0005000010138000, CL_WUPS_TITLE_SNES, /* ファイナルファイト2 (Final Fight 2) (JPN) */ },
-  { 0x0005000010138300, CL_WUPS_TITLE_WII_U, /* Donkey Kong Country Tropical Freeze (EUR) */ },
-  { 0x0005000010138500, CL_WUPS_TITLE_WII_U, /* Pinball Arcade (USA) */ },
-  { 0x0005000010138600, CL_WUPS_TITLE_WII_U, /* Falling Skies: The Game (USA) */ },
-  { 0x0005000010138700, CL_WUPS_TITLE_WII_U, /* Spin the Bottle: Bumpie's Party (EUR) */ },
-  { 0x0005000010138800, CL_WUPS_TITLE_WII_U, /* Assassin's Creed® IV Black Flag (EUR) */ },
-  { 0x0005000010138900, CL_WUPS_TITLE_WII_U, /* How To Survive (EUR) */ },
-  { 0x0005000010138A00, CL_WUPS_TITLE_WII_U, /* Angry Birds Trilogy (USA) */ },
-  { 0x0005000010138B00, CL_WUPS_TITLE_WII_U, /* Assassin's Creed® IV Black Flag (USA) */ },
-  { 0x0005000010138D00, CL_WUPS_TITLE_WII_U, /* F1 RACE STARS POWERED UP EDITION (USA) */ },
-  { 0x0005000010138E00, CL_WUPS_TITLE_WII_U, /* Rayman Legends Challenges App (EUR) */ },
-  { 0x0005000010138F00, CL_WUPS_TITLE_WII_U, /* Devil's Third (JPN) */ },
-  { 0x0005000010139200, CL_WUPS_TITLE_WII_U, /* Skylanders SWAP Force (USA) */ },
-  { 0x0005000010139400, CL_WUPS_TITLE_WII_U, /* Phineas and Ferb: Quest for Cool Stuff (USA) */ },
-  { 0x0005000010139500, CL_WUPS_TITLE_WII_U, /* Rayman Legends Challenges App (USA) */ },
-  { 0x0005000010139800, CL_WUPS_TITLE_NES, /* ドルアーガの塔 (The Tower of Druaga) (JPN) */ },
-  { 0x0005000010139900, CL_WUPS_TITLE_WII_U, /* JUST DANCE® 2014 (USA) */ },
-  { 0x0005000010139A00, CL_WUPS_TITLE_WII_U, /* Cocoto Magic Circus 2 (USA) */ },
-  { 0x0005000010139B00, CL_WUPS_TITLE_WII_U, /* NINJA GAIDEN 3: Razor's Edge (EUR) */ },
-  { 0x0005000010140000, CL_WUPS_TITLE_WII_U, /* Angry Birds Trilogy (EUR) */ },
-  { 0x0005000010140300, CL_WUPS_TITLE_WII_U, /* Hunter's Trophy 2 - Europa (EUR) */ },
-  { 0x0005000010140400, CL_WUPS_TITLE_WII_U, /* Skylanders SWAP Force (EUR) */ },
-  { 0x0005000010140500, CL_WUPS_TITLE_WII_U, /* WATCH_DOGS (EUR) */ },
-  { 0x0005000010140600, CL_WUPS_TITLE_WII_U, /* 銀星将棋 強天怒闘風雷神 (Ginsei Shogi: Kyoutendo Toufuu Raijin) (JPN) */ },
-  { 0x0005000010140700, CL_WUPS_TITLE_WII_U, /* Injustice: Gods Among Us (JPN) */ },
-  { 0x0005000010140800, CL_WUPS_TITLE_WII_U, /* ARC STYLE： 野球！！SP (ARC STYLE： BASEBALL!!SP) (JPN) */ },
-  { 0x0005000010140900, CL_WUPS_TITLE_WII_U, /* オセロ (Othello) (JPN) */ },
-  { 0x0005000010140C00, CL_WUPS_TITLE_SNES, /* スーパーワギャンランド (Super Wagyan Land) (JPN) */ },
-  { 0x0005000010140D00, CL_WUPS_TITLE_SNES, /* 重装機兵ヴァルケン (Assault Suits Valken) (JPN) */ },
-  { 0x0005000010140E00, CL_WUPS_TITLE_SNES, /* Cybernator (USA) */ },
-  { 0x0005000010140F00, CL_WUPS_TITLE_SNES, /* Cybernator (EUR) */ },
-  { 0x0005000010141100, CL_WUPS_TITLE_SNES, /* 大航海時代Ⅱ (Uncharted Waters 2 - New Horizons) (JPN) */ },
-  { 0x0005000010141200, CL_WUPS_TITLE_SNES, /* Uncharted Waters: New Horizons (USA) */ },
-  { 0x0005000010141300, CL_WUPS_TITLE_SNES, /* Uncharted Waters: New Horizons (EUR) */ },
-  { 0x0005000010141400, CL_WUPS_TITLE_SNES, /* 真･女神転生Ⅱ (Shin Megami Tensei II) (JPN) */ },
-  { 0x0005000010141500, CL_WUPS_TITLE_SNES, /* 真･女神転生if... (Shin Megami Tensei if…) (JPN) */ },
-  { 0x0005000010141600, CL_WUPS_TITLE_SNES, /* ロックマンX2 (Mega Man X2) (JPN) */ },
-  { 0x0005000010141700, CL_WUPS_TITLE_SNES, /* Mega Man X2 (USA) */ },
-  { 0x0005000010141800, CL_WUPS_TITLE_SNES, /* Mega Man X2 (EUR) */ },
-  { 0x0005000010141900, CL_WUPS_TITLE_SNES, /* ファイナルファイト タフ (Final Fight Tough) (JPN) */ },
-  { 0x0005000010141A00, CL_WUPS_TITLE_SNES, /* Final Fight 3 (USA) */ },
-  { 0x0005000010141B00, CL_WUPS_TITLE_SNES, /* Final Fight 3 (EUR) */ },
-  { 0x0005000010141C00, CL_WUPS_TITLE_SNES, /* RUSHING BEAT 乱 複製都市 (Brawl Brothers) (JPN) */ },
-  { 0x0005000010141D00, CL_WUPS_TITLE_SNES, /* Brawl Brothers (USA) */ },
-  { 0x0005000010141E00, CL_WUPS_TITLE_SNES, /* Brawl Brothers (EUR) */ },
-  { 0x0005000010141F00, CL_WUPS_TITLE_SNES, /* クロックタワー (Clock Tower) (JPN) */ },
-  { 0x0005000010142000, CL_WUPS_TITLE_WII_U, /* WATCH_DOGS (USA) */ },
-  { 0x0005000010142200, CL_WUPS_TITLE_WII_U, /* NewスーパールイージU (New SUPER LUIGI U) (JPN) */ },
-  { 0x0005000010142300, CL_WUPS_TITLE_WII_U, /* New SUPER LUIGI U (USA) */ },
-  { 0x0005000010142400, CL_WUPS_TITLE_WII_U, /* New SUPER LUIGI U (EUR) */ },
-  { 0x0005000010142700, CL_WUPS_TITLE_WII_U, /* Art Academy: SketchPad (EUR) */ },
-  { 0x0005000010142800, CL_WUPS_TITLE_WII_U, /* TNT Racers (EUR) */ },
-  { 0x0005000010142A00, CL_WUPS_TITLE_WII_U, /* Zumba Fitness World Party (USA) */ },
-  { 0x0005000010142B00, CL_WUPS_TITLE_WII_U, /* 絵心教室 スケッチ (Art Academy: SketchPad) (JPN) */ },
-  { 0x0005000010142C00, CL_WUPS_TITLE_WII_U, /* Art Academy: SketchPad (USA) */ },
-  { 0x0005000010142D00, CL_WUPS_TITLE_WII_U, /* スカイランダーズ　スパイロの大冒険 (Skylanders Spyro's Adventure) (JPN) */ },
-  { 0x0005000010142F00, CL_WUPS_TITLE_WII_U, /* レゴ®シティ アンダーカバー (LEGO® CITY UNDERCOVER) (JPN) */ },
-  { 0x0005000010143200, CL_WUPS_TITLE_WII_U, /* Cabela's Big Game Hunter: Pro Hunts (USA) */ },
-  { 0x0005000010143300, CL_WUPS_TITLE_WII_U, /* Hot Wheels™ World’s Best Driver™ (USA) */ },
-  { 0x0005000010143400, CL_WUPS_TITLE_WII_U, /* ゼルダの伝説 風のタクト ＨＤ (THE LEGEND OF ZELDA The Wind Waker HD) (JPN) */ },
-  { 0x0005000010143500, CL_WUPS_TITLE_WII_U, /* THE LEGEND OF ZELDA The Wind Waker HD (USA) */ },
-  { 0x0005000010143600, CL_WUPS_TITLE_WII_U, /* THE LEGEND OF ZELDA The Wind Waker HD (EUR) */ },
-  { 0x0005000010143700, CL_WUPS_TITLE_SNES, /* 聖剣伝説2 (Seiken Densetsu 2) (JPN) */ },
-  { 0x0005000010143C00, CL_WUPS_TITLE_SNES, /* ファイナルファンタジーⅥ (Final Fantasy VI) (JPN) */ },
-  { 0x0005000010143F00, CL_WUPS_TITLE_WII_U, /* JUST DANCE® 2014 (EUR) */ },
-  { 0x0005000010144000, CL_WUPS_TITLE_WII_U, /* Adventure Time: Explore the Dungeon Because I Don't Know! (USA) */ },
-  { 0x0005000010144800, CL_WUPS_TITLE_WII_U, /* ドンキーコング トロピカルフリーズ (Donkey Kong Country Tropical Freeze) (JPN) */ },
-  { 0x0005000010144D00, CL_WUPS_TITLE_WII_U, /* Wii Sports Club (USA) */ },
-  { 0x0005000010144E00, CL_WUPS_TITLE_WII_U, /* Wii Sports Club (EUR) */ },
-  { 0x0005000010144F00, CL_WUPS_TITLE_WII_U, /* Super Smash Bros. for Wii U (USA) */ },
-  { 0x0005000010145000, CL_WUPS_TITLE_WII_U, /* Super Smash Bros. for Wii U (EUR) */ },
-  { 0x0005000010145100, CL_WUPS_TITLE_WII_U, /* Hot Wheels™ World’s Best Driver (EUR) */ },
-  { 0x0005000010145200, CL_WUPS_TITLE_WII_U, /* Just Dance® Kids 2014 (USA) */ },
-  { 0x0005000010145300, CL_WUPS_TITLE_WII_U, /* スナイパー エリートV2 (Sniper Elite V2) (JPN) */ },
-  { 0x0005000010145500, CL_WUPS_TITLE_WII_U, /* Wipeout Create & Crash (USA) */ },
-  { 0x0005000010145600, CL_WUPS_TITLE_WII_U, /* Animal Crossing Plaza (EUR/JAP/USA) */ },
-  { 0x0005000010145800, CL_WUPS_TITLE_WII_U, /* Unepic EnjoyUp Games (EUR) */ },
-  { 0x0005000010145900, CL_WUPS_TITLE_WII_U, /* Coaster Crazy Deluxe (EUR) */ },
-  { 0x0005000010145A00, CL_WUPS_TITLE_WII_U, /* Pure Chess (EUR) */ },
-  { 0x0005000010145B00, CL_WUPS_TITLE_WII_U, /* Just Dance® Kids 2014 (EUR) */ },
-  { 0x0005000010145C00, CL_WUPS_TITLE_WII_U, /* SUPER MARIO 3D WORLD (USA) */ },
-  { 0x0005000010145D00, CL_WUPS_TITLE_WII_U, /* SUPER MARIO 3D WORLD (EUR) */ },
-  { 0x0005000010145E00, CL_WUPS_TITLE_WII_U, /* Angry Birds Star Wars (USA) */ },
-  { 0x0005000010145F00, CL_WUPS_TITLE_WII_U, /* ファミコン　リミックス (NES REMIX) (JPN) */ },
-  { 0x0005000010146000, CL_WUPS_TITLE_WII_U, /* NES REMIX (USA) */ },
-  { 0x0005000010146100, CL_WUPS_TITLE_WII_U, /* NES Remix (EUR) */ },
-  { 0x0005000010146300, CL_WUPS_TITLE_WII_U, /* PAC-MAN and the Ghostly Adventures (USA) */ },
-  { 0x0005000010146600, CL_WUPS_TITLE_WII_U, /* BEN 10 OMNIVERSE™ 2 (EUR) */ },
-  { 0x0005000010146800, CL_WUPS_TITLE_WII_U, /* Call of Duty Ghosts (USA) */ },
-  { 0x0005000010146900, CL_WUPS_TITLE_WII_U, /* SpongeBob SquarePants: Plankton's Robotic Revenge (USA) */ },
-  { 0x0005000010146A00, CL_WUPS_TITLE_WII_U, /* The Amazing Spider-Man 2™ (USA) */ },
-  { 0x0005000010147300, CL_WUPS_TITLE_WII_U, /* EvoFish (USA) */ },
-  { 0x0005000010147400, CL_WUPS_TITLE_WII_U, /* Pure Chess (USA) */ },
-  { 0x0005000010147500, CL_WUPS_TITLE_WII_U, /* BEN 10 OMNIVERSE™ 2 (USA) */ },
-  { 0x0005000010147600, CL_WUPS_TITLE_WII_U, /* EvoFish (EUR) */ },
-  { 0x0005000010147700, CL_WUPS_TITLE_WII_U, /* Pokémon Rumble U (EUR/USA) */ },
-  { 0x0005000010147900, CL_WUPS_TITLE_WII_U, /* PAC-MAN and the Ghostly Adventures (EUR) */ },
-  { 0x0005000010147A00, CL_WUPS_TITLE_WII_U, /* Monster High 13 Wishes (EUR) */ },
-  { 0x0005000010147B00, CL_WUPS_TITLE_WII_U, /* Barbie Dreamhouse Party (EUR) */ },
-  { 0x0005000010147D00, CL_WUPS_TITLE_WII_U, /* SpongeBob SquarePants: Plankton's Robotic Revenge (EUR) */ },
-  { 0x0005000010147E00, CL_WUPS_TITLE_WII_U, /* Hello Kitty© Kruisers (USA) */ },
-  { 0x0005000010147F00, CL_WUPS_TITLE_WII_U, /* Spin The Bottle: Bumpie's Party (USA) */ },
-  { 0x0005000010148000, CL_WUPS_TITLE_WII_U, /* ONE PIECE UNLIMITED WORLD R (JPN) */ },
-  { 0x0005000010148200, CL_WUPS_TITLE_WII_U, /* Rock 'N Racing Off Road (USA) */ },
-  { 0x0005000010148500, CL_WUPS_TITLE_WII_U, /* Abyss EnjoUp Games (USA) */ },
-  { 0x0005000010148F00, CL_WUPS_TITLE_WII_U, /* Uplay (JPN) */ },
-  { 0x0005000010149000, CL_WUPS_TITLE_WII_U, /* 三國志12 with パワーアップキット (Romance of the Three Kingdoms 12 with Powerup kit) (JPN) */ },
-  { 0x0005000010149100, CL_WUPS_TITLE_WII_U, /* Angry Birds Star Wars (EUR) */ },
-  { 0x0005000010149200, CL_WUPS_TITLE_WII_U, /* Spot The Differences: Party! (EUR) */ },
-  { 0x0005000010149300, CL_WUPS_TITLE_WII_U, /* Mario vs. Donkey Kong Tipping Stars (USA) */ },
-  { 0x0005000010149400, CL_WUPS_TITLE_WII_U, /* Art of Balance (EUR) */ },
-  { 0x0005000010149500, CL_WUPS_TITLE_WII_U, /* Scram Kitty and his Buddy on Rails (USA) */ },
-  { 0x0005000010149600, CL_WUPS_TITLE_WII_U, /* Wii KARAOKE U by JOYSOUND (EUR) */ },
-  { 0x0005000010149700, CL_WUPS_TITLE_WII_U, /* 役満 鳳凰 (Yakuman Houou Mahjong) (JPN) */ },
-  { 0x0005000010149800, CL_WUPS_TITLE_NES, /* ベースボール (Baseball) (JPN) */ },
-  { 0x0005000010149900, CL_WUPS_TITLE_NES, /* BASEBALL (USA) */ },
-  { 0x0005000010149A00, CL_WUPS_TITLE_NES, /* BASEBALL (EUR) */ },
-  { 0x0005000010149B00, CL_WUPS_TITLE_NES, /* テニス (Tennis) (JPN) */ },
-  { 0x0005000010149C00, CL_WUPS_TITLE_NES, /* TENNIS (USA) */ },
-  { 0x0005000010149D00, CL_WUPS_TITLE_NES, /* TENNIS (EUR) */ },
-  { 0x0005000010149E00, CL_WUPS_TITLE_NES, /* ピンボール (Pinball) (JPN) */ },
-  { 0x0005000010149F00, CL_WUPS_TITLE_NES, /* PINBALL (USA) */ },
-  { 0x000500001014A000, CL_WUPS_TITLE_NES, /* PINBALL (EUR) */ },
-  { 0x000500001014A100, CL_WUPS_TITLE_NES, /* アーバンチャンピオン (Urban Champion) (JPN) */ },
-  { 0x000500001014A200, CL_WUPS_TITLE_NES, /* Urban Champion (USA) */ },
-  { 0x000500001014A300, CL_WUPS_TITLE_NES, /* Urban Champion (EUR) */ },
-  { 0x000500001014A400, CL_WUPS_TITLE_NES, /* クルクルランド (Clu Clu Land) (JPN) */ },
-  { 0x000500001014A500, CL_WUPS_TITLE_NES, /* Clu Clu Land (USA) */ },
-  { 0x000500001014A600, CL_WUPS_TITLE_NES, /* Clu Clu Land (EUR) */ },
-  { 0x000500001014A700, CL_WUPS_TITLE_NES, /* ドンキーコング3 (Donkey Kong 3) (JPN) */ },
-  { 0x000500001014A800, CL_WUPS_TITLE_NES, /* DONKEY KONG 3 (USA) */ },
-  { 0x000500001014A900, CL_WUPS_TITLE_NES, /* DONKEY KONG 3 (EUR) */ },
-  { 0x000500001014AA00, CL_WUPS_TITLE_NES, /* ゴルフ (Golf) (JPN) */ },
-  { 0x000500001014AB00, CL_WUPS_TITLE_NES, /* GOLF (USA) */ },
-  { 0x000500001014AC00, CL_WUPS_TITLE_NES, /* GOLF (EUR) */ },
-  { 0x000500001014AD00, CL_WUPS_TITLE_NES, /* ファイナルファンタジー (Final Fantasy) (JPN) */ },
-  { 0x000500001014B000, CL_WUPS_TITLE_SNES, /* ファイナルファンタジーIV (Final Fantasy IV) (JPN) */ },
-  { 0x000500001014B300, CL_WUPS_TITLE_NES, /* 伝説のオウガバトル (Ogre Battle: The March of the Black Queen) (JPN) */ },
-  { 0x000500001014B700, CL_WUPS_TITLE_WII_U, /* New SUPER MARIO BROS. U + New SUPER LUIGI U (USA) */ },
-  { 0x000500001014B800, CL_WUPS_TITLE_WII_U, /* New SUPER MARIO BROS. U + New SUPER LUIGI U (EUR) */ },
-  { 0x000500001014BF00, CL_WUPS_TITLE_WII_U, /* @SIMPLE DLシリーズ for Wii U Vol.1 THE 密室からの脱出 (@SIMPLE DLseries for Wii U Vol.1 THE Escape Trick) (JPN) */ },
-  { 0x000500001014C000, CL_WUPS_TITLE_WII_U, /* WATCH_DOGS (JPN) */ },
-  { 0x000500001014C100, CL_WUPS_TITLE_WII_U, /* TRANSFORMERS: Rise of the Dark Spark (USA) */ },
-  { 0x000500001014C300, CL_WUPS_TITLE_WII_U, /* 引ク押ス ワールド (Pushmo World) (JPN) */ },
-  { 0x000500001014C600, CL_WUPS_TITLE_WII_U, /* Giana Sisters Twisted Dreams (EUR) */ },
-  { 0x000500001014C700, CL_WUPS_TITLE_WII_U, /* How to Survive (USA) */ },
-  { 0x000500001014C800, CL_WUPS_TITLE_WII_U, /* アサシン クリード4 ブラック フラッグ (Assassin's Creed® IV Black Flag) (JPN) */ },
-  { 0x000500001014C900, CL_WUPS_TITLE_WII_U, /* My Farm (EUR) */ },
-  { 0x000500001014CA00, CL_WUPS_TITLE_WII_U, /* The Legend of Zelda™: Hyrule Historia (USA) */ },
-  { 0x000500001014CB00, CL_WUPS_TITLE_WII_U, /* Giana Sisters Twisted Dreams (USA) */ },
-  { 0x000500001014CC00, CL_WUPS_TITLE_WII_U, /* Cocoto Magic Circus 2 (EUR) */ },
-  { 0x000500001014CE00, CL_WUPS_TITLE_WII_U, /* YouTube (USA) */ },
-  { 0x000500001014CF00, CL_WUPS_TITLE_WII_U, /* Coaster Crazy Deluxe (USA) */ },
-  { 0x000500001014D000, CL_WUPS_TITLE_WII_U, /* My Farm (USA) */ },
-  { 0x000500001014D100, CL_WUPS_TITLE_WII_U, /* Scram Kitty and his Buddy on Rails (EUR) */ },
-  { 0x000500001014D200, CL_WUPS_TITLE_WII_U, /* 零 ～濡鴉ノ巫女～ (Project Zero Maiden of Black Water) (JPN) */ },
-  { 0x000500001014D600, CL_WUPS_TITLE_WII_U, /* トライン ２ 三つの力と不可思議の森 (Trine 2 Director's Cut) (JPN) */ },
-  { 0x000500001014D800, CL_WUPS_TITLE_WII_U, /* Knytt Underground (EUR) */ },
-  { 0x000500001014D900, CL_WUPS_TITLE_WII_U, /* ぷよぷよテトリス (PUYOPUYOTETRIS) (JPN) */ },
-  { 0x000500001014DA00, CL_WUPS_TITLE_WII_U, /* モンスターハンター フロンティアＧ (Monster Hunter Frontier G) (JPN) */ },
-  { 0x000500001014DB00, CL_WUPS_TITLE_WII_U, /* BAYONETTA (JPN) */ },
-  { 0x000500001014DD00, CL_WUPS_TITLE_WII_U, /* Chimpuzzle Pro (EUR) */ },
-  { 0x000500001014DE00, CL_WUPS_TITLE_WII_U, /* The LEGO® Movie Videogame (USA) */ },
-  { 0x000500001014DF00, CL_WUPS_TITLE_WII_U, /* Spot The Differences: Party! (USA) */ },
-  { 0x000500001014E000, CL_WUPS_TITLE_WII_U, /* The LEGO®  Movie Videogame (EUR) */ },
-  { 0x000500001014E100, CL_WUPS_TITLE_WII_U, /* Adventure Time: Explore the Dungeon Because I DON’T KNOW! (EUR) */ },
-  { 0x000500001014E200, CL_WUPS_TITLE_WII_U, /* Phineas and Ferb: Quest for Cool Stuff (EUR) */ },
-  { 0x000500001014E300, CL_WUPS_TITLE_WII_U, /* Zumba Fitness World Party (EUR) */ },
-  { 0x000500001014EF00, CL_WUPS_TITLE_WII_U, /* Knytt Underground (USA) */ },
-  { 0x000500001014F000, CL_WUPS_TITLE_WII_U, /* TNT Racers (USA) */ },
-  { 0x000500001014F100, CL_WUPS_TITLE_WII_U, /* Mighty Switch Force! 2™ (EUR) */ },
-  { 0x000500001014F300, CL_WUPS_TITLE_WII_U, /* パックワールド (PAC-MAN and the Ghostly Adventures) (JPN) */ },
-  { 0x000500001014F400, CL_WUPS_TITLE_WII_U, /* クラウドベリーキングダム (Cloudberry Kingdom) (JPN) */ },
-  { 0x000500001014FB00, CL_WUPS_TITLE_WII_U, /* Q.U.B.E: Director's Cut (EUR) */ },
-  { 0x000500001014FC00, CL_WUPS_TITLE_WII_U, /* Mighty Switch Force! 2™ (USA) */ },
-  { 0x000500001014FD00, CL_WUPS_TITLE_WII_U, /* Cubemen 2 (USA) */ },
-  { 0x000500001014FE00, CL_WUPS_TITLE_WII_U, /* My Style Studio: Hair Salon (USA) */ },
-  { 0x000500001014FF00, CL_WUPS_TITLE_WII_U, /* Percy's Predicament (USA) */ },
-  { 0x0005000010150200, CL_WUPS_TITLE_WII_U, /* Cubemen 2 (EUR) */ },
-  { 0x0005000010150300, CL_WUPS_TITLE_WII_U, /* Dr.LUIGI & 細菌撲滅 (JPN) */ },
-  { 0x0005000010150400, CL_WUPS_TITLE_NES, /* アイスホッケー (Ice Hockey) (JPN) */ },
-  { 0x0005000010150500, CL_WUPS_TITLE_NES, /* Ice Hockey (USA) */ },
-  { 0x0005000010150600, CL_WUPS_TITLE_NES, /* Ice Hockey (EUR) */ },
-  { 0x0005000010150700, CL_WUPS_TITLE_NES, /* ワリオの森 (Wario's Woods) (JPN) */ },
-  { 0x0005000010150800, CL_WUPS_TITLE_NES, /* Wario's Woods (USA) */ },
-  { 0x0005000010150900, CL_WUPS_TITLE_NES, /* Wario's Woods (EUR) */ },
-  { 0x0005000010150A00, CL_WUPS_TITLE_WII_U, /* BUBBLE BOBBLE (JPN) */ },
-  { 0x0005000010150D00, CL_WUPS_TITLE_NES, /* ファイナルファンタジーII (Final Fantasy II) (JPN) */ },
-  { 0x0005000010150E00, CL_WUPS_TITLE_NES, /* ファイナルファンタジーIII (Final Fantasy III) (JPN) */ },
-  { 0x0005000010150F00, CL_WUPS_TITLE_NES, /* ダウンタウンスペシャル くにおくんの時代劇だよ全員集合！ (Downtown Special Kunio-kun's Historical Period Drama!) (JPN) */ },
-  { 0x0005000010151000, CL_WUPS_TITLE_NES, /* 熱血高校ドッジボール部 (Super Dodge Ball) (JPN) */ },
-  { 0x0005000010151100, CL_WUPS_TITLE_NES, /* Super Dodge Ball (USA) */ },
-  { 0x0005000010151200, CL_WUPS_TITLE_NES, /* Super Dodge Ball (EUR) */ },
-  { 0x0005000010151300, CL_WUPS_TITLE_NES, /* 悪魔城ドラキュラ (Castlevania) (JPN) */ },
-  { 0x0005000010151400, CL_WUPS_TITLE_NES, /* Castlevania (USA) */ },
-  { 0x0005000010151500, CL_WUPS_TITLE_NES, /* Castlevania (EUR) */ },
-  { 0x0005000010151600, CL_WUPS_TITLE_SNES, /* ロマンシング サ･ガ (Romancing SaGa) (JPN) */ },
-  { 0x0005000010152100, CL_WUPS_TITLE_WII_U, /* EDGE (EUR) */ },
-  { 0x0005000010152200, CL_WUPS_TITLE_WII_U, /* EDGE (USA) */ },
-  { 0x0005000010152300, CL_WUPS_TITLE_WII_U, /* Toki Tori (USA) */ },
-  { 0x0005000010152400, CL_WUPS_TITLE_WII_U, /* Toki Tori (EUR) */ },
-  { 0x0005000010152500, CL_WUPS_TITLE_WII_U, /* RUSH (EUR) */ },
-  { 0x0005000010152600, CL_WUPS_TITLE_WII_U, /* RUSH (USA) */ },
-  { 0x0005000010152700, CL_WUPS_TITLE_WII_U, /* Wooden Sen'SeY (EUR) */ },
-  { 0x0005000010152A00, CL_WUPS_TITLE_WII_U, /* Dr. Luigi (USA) */ },
-  { 0x0005000010152B00, CL_WUPS_TITLE_WII_U, /* Dr. Luigi (EUR) */ },
-  { 0x0005000010152C00, CL_WUPS_TITLE_NES, /* マリオオープンゴルフ (Mario Open Golf) (JPN) */ },
-  { 0x0005000010152E00, CL_WUPS_TITLE_NES, /* NES Open Tournament Golf (USA) */ },
-  { 0x0005000010152F00, CL_WUPS_TITLE_NES, /* NES Open Tournament Golf (EUR) */ },
-  { 0x0005000010153000, CL_WUPS_TITLE_NES, /* ドクターマリオ (Dr. Mario) (JPN) */ },
-  { 0x0005000010153100, CL_WUPS_TITLE_NES, /* Dr. MARIO (USA) */ },
-  { 0x0005000010153200, CL_WUPS_TITLE_NES, /* Dr. MARIO (EUR) */ },
-  { 0x0005000010153300, CL_WUPS_TITLE_NES, /* 熱血硬派くにおくん (Renegade) (JPN) */ },
-  { 0x0005000010153400, CL_WUPS_TITLE_NES, /* Renegade (USA) */ },
-  { 0x0005000010153500, CL_WUPS_TITLE_NES, /* Renegade (EUR) */ },
-  { 0x0005000010153600, CL_WUPS_TITLE_NES, /* ダブルドラゴン (Double Dragon) (JPN) */ },
-  { 0x0005000010153700, CL_WUPS_TITLE_NES, /* Double Dragon (USA) */ },
-  { 0x0005000010153800, CL_WUPS_TITLE_NES, /* Double Dragon (EUR) */ },
-  { 0x0005000010153900, CL_WUPS_TITLE_NES, /* ドラキュラⅡ 呪いの封印 (Castlevania Ⅱ Simon's Quest) (JPN) */ },
-  { 0x0005000010153B00, CL_WUPS_TITLE_NES, /* Castlevania Ⅱ Simon's Quest (USA) */ },
-  { 0x0005000010153C00, CL_WUPS_TITLE_NES, /* Castlevania Ⅱ Simon's Quest (EUR) */ },
-  { 0x0005000010153D00, CL_WUPS_TITLE_SNES, /* タクティクスオウガ (Tactics Ogre) (JPN) */ },
-  { 0x0005000010153E00, CL_WUPS_TITLE_SNES, /* ロマンシング サ･ガ2 (Romancing SaGa2) (JPN) */ },
-  { 0x0005000010153F00, CL_WUPS_TITLE_SNES, /* ファイナルファンタジーV (Final Fantasy V) (JPN) */ },
-  { 0x0005000010154000, CL_WUPS_TITLE_SNES, /* ファイナルファンタジーUSA ミスティッククエスト ((Final Fantasy USA Mystic Quest) (JPN) */ },
-  { 0x0005000010154500, CL_WUPS_TITLE_WII_U, /* トガビトノセンリツ (Togabito no Senritsu) (JPN) */ },
-  { 0x0005000010154600, CL_WUPS_TITLE_WII_U, /* バットマン™ アーカム・ビギンズ (Batman™ Arkham Origins) (JPN) */ },
-  { 0x0005000010154800, CL_WUPS_TITLE_WII_U, /* BBC iPlayer (EUR) */ },
-  { 0x0005000010154900, CL_WUPS_TITLE_WII_U, /* Angry Bunnies: Colossal Carrot Crusade (EUR) */ },
-  { 0x0005000010154A00, CL_WUPS_TITLE_WII_U, /* MY STYLE STUDIO: NOTEBOOK (EUR) */ },
-  { 0x0005000010154B00, CL_WUPS_TITLE_WII_U, /* RUBIKS CUBE (EUR) */ },
-  { 0x0005000010154C00, CL_WUPS_TITLE_WII_U, /* My Style Studio: Hair Salon (EUR) */ },
-  { 0x0005000010154D00, CL_WUPS_TITLE_WII_U, /* The Mysterious Cities of Gold: Secret Paths (EUR) */ },
-  { 0x0005000010154E00, CL_WUPS_TITLE_WII_U, /* Luv Me Buddies Wonderland (EUR) */ },
-  { 0x0005000010155B00, CL_WUPS_TITLE_WII_U, /* Tengami (EUR) */ },
-  { 0x0005000010155F00, CL_WUPS_TITLE_WII_U, /* ドラゴンクエストⅩ 眠れる勇者と導きの盟友 オンライン Version 2 (Dragon Quest X The Sleeping Hero and the Guided Allies) (JPN) */ },
-  { 0x0005000010156000, CL_WUPS_TITLE_WII_U, /* MY STYLE STUDIO: NOTEBOOK (USA) */ },
-  { 0x0005000010156100, CL_WUPS_TITLE_WII_U, /* Call of Duty: Ghosts (EUR) */ },
-  { 0x0005000010156400, CL_WUPS_TITLE_WII_U, /* RUBIKS CUBE (USA) */ },
-  { 0x0005000010156500, CL_WUPS_TITLE_WII_U, /* The Mysterious Cities of Gold: Secret Paths (USA) */ },
-  { 0x0005000010156600, CL_WUPS_TITLE_GBA, /* F-ZERO FOR GAMEBOY ADVANCE (JPN) */ },
-  { 0x0005000010156700, CL_WUPS_TITLE_GBA, /* F-Zero Maximum Velocity (USA) */ },
-  { 0x0005000010156800, CL_WUPS_TITLE_GBA, /* F-ZERO MAXIMUM VELOCITY (EUR) */ },
-  { 0x0005000010156900, CL_WUPS_TITLE_GBA, /* スーパーマリオアドバンス3 (Yoshi's Island: Super Mario Advance 3) (JPN) */ },
-  { 0x0005000010156A00, CL_WUPS_TITLE_GBA, /* Yoshi's Island: Super Mario Advance 3 (USA) */ },
-  { 0x0005000010156B00, CL_WUPS_TITLE_GBA, /* Yoshi's Island: Super Mario Advance 3 (EUR) */ },
-  { 0x0005000010156C00, CL_WUPS_TITLE_GBA, /* メイド イン ワリオ (Made in Wario) (JPN) */ },
-  { 0x0005000010156E00, CL_WUPS_TITLE_GBA, /* WarioWare, Inc.: Mega Microgame$ (USA) */ },
-  { 0x0005000010156F00, CL_WUPS_TITLE_GBA, /* WarioWare, Inc. Minigame Mania (EUR) */ },
-  { 0x0005000010157000, CL_WUPS_TITLE_GBA, /* メトロイド フュージョン (Metroid Fusion) (JPN) */ },
-  { 0x0005000010157100, CL_WUPS_TITLE_GBA, /* Metroid Fusion (USA) */ },
-  { 0x0005000010157200, CL_WUPS_TITLE_GBA, /* Metroid Fusion (EUR) */ },
-  { 0x0005000010157300, CL_WUPS_TITLE_GBA, /* マリオ&ルイージRPG (Mario & Luigi RPG) (JPN) */ },
-  { 0x0005000010157400, CL_WUPS_TITLE_GBA, /* Mario & Luigi: Superstar Saga (USA) */ },
-  { 0x0005000010157500, CL_WUPS_TITLE_GBA, /* Mario & Luigi: Superstar Saga (EUR) */ },
-  { 0x0005000010157600, CL_WUPS_TITLE_WII_U, /* Call of Duty: Ghosts (EUR) */ },
-  { 0x0005000010157800, CL_WUPS_TITLE_WII_U, /* Squids Odyssey (EUR) */ },
-  { 0x0005000010157900, CL_WUPS_TITLE_WII_U, /* Call of Duty: Ghosts (JPN) */ },
-  { 0x0005000010157A00, CL_WUPS_TITLE_WII_U, /* Squids Odyssey (USA) */ },
-  { 0x0005000010157C00, CL_WUPS_TITLE_WII_U, /* アルファディア ジェネシス (Alphadia Genesis) (JPN) */ },
-  { 0x0005000010157D00, CL_WUPS_TITLE_WII_U, /* GAIABREAKER (JPN) */ },
-  { 0x0005000010157E00, CL_WUPS_TITLE_WII_U, /* BAYONETTA (USA) */ },
-  { 0x0005000010157F00, CL_WUPS_TITLE_WII_U, /* BAYONETTA (EUR) */ },
-  { 0x0005000010158000, CL_WUPS_TITLE_NES, /* ELEVATOR ACTION (JPN) */ },
-  { 0x0005000010158300, CL_WUPS_TITLE_WII_U, /* Wooden Sen'SeY (USA) */ },
-  { 0x0005000010158400, CL_WUPS_TITLE_WII_U, /* My First Songs (USA) */ },
-  { 0x0005000010158500, CL_WUPS_TITLE_NES, /* ファミコン探偵倶楽部 消えた後継者(前後編) (Famicom Detective Club The Missing Heir) (JPN) */ },
-  { 0x0005000010158600, CL_WUPS_TITLE_NES, /* 忍者龍剣伝 (Ninja Gaiden) (JPN) */ },
-  { 0x0005000010158700, CL_WUPS_TITLE_NES, /* NINJA GAIDEN (USA) */ },
-  { 0x0005000010158800, CL_WUPS_TITLE_NES, /* NINJA GAIDEN (EUR) */ },
-  { 0x0005000010158900, CL_WUPS_TITLE_NES, /* マイティボンジャック (Mighty Bomb Jack) (JPN) */ },
-  { 0x0005000010158A00, CL_WUPS_TITLE_NES, /* MIGHTY BOMB JACK (USA) */ },
-  { 0x0005000010158B00, CL_WUPS_TITLE_NES, /* MIGHTY BOMB JACK (EUR) */ },
-  { 0x0005000010158C00, CL_WUPS_TITLE_NES, /* がんばれゴエモン！ からくり道中 (Ganbare Goemon! Karakuri Dōchū) (JPN) */ },
-  { 0x0005000010158D00, CL_WUPS_TITLE_NES, /* SUPER魂斗羅 (Super Contra) (JPN) */ },
-  { 0x0005000010158E00, CL_WUPS_TITLE_NES, /* Super C (USA) */ },
-  { 0x0005000010158F00, CL_WUPS_TITLE_NES, /* Super C (EUR) */ },
-  { 0x0005000010159000, CL_WUPS_TITLE_SNES, /* スーパーパンチアウト!! (Super Punch-Out!!) (JPN) */ },
-  { 0x0005000010159100, CL_WUPS_TITLE_SNES, /* Super Punch-Out!! (USA) */ },
-  { 0x0005000010159200, CL_WUPS_TITLE_SNES, /* Super Punch-Out!! (EUR) */ },
-  { 0x0005000010159300, CL_WUPS_TITLE_SNES, /* ロマンシング サ･ガ3 (Romancing SaGa 3) (JPN) */ },
-  { 0x0005000010159400, CL_WUPS_TITLE_SNES, /* バハムート ラグーン (Bahamut Lagoon) (JPN) */ },
-  { 0x0005000010159500, CL_WUPS_TITLE_SNES, /* Pop'nツインビー (Pop'n TwinBee) (JPN) */ },
-  { 0x0005000010159600, CL_WUPS_TITLE_SNES, /* Pop'n Twinbee (EUR) */ },
-  { 0x0005000010159800, CL_WUPS_TITLE_WII_U, /* Wii Fit U (CP) (JPN) */ },
-  { 0x0005000010159900, CL_WUPS_TITLE_WII_U, /* Wii Fit U (Free) (USA) */ },
-  { 0x0005000010159A00, CL_WUPS_TITLE_WII_U, /* Wii Fit U (promo) (EUR) */ },
-  { 0x000500001015A300, CL_WUPS_TITLE_WII_U, /* Disney INFINITY (USA) */ },
-  { 0x000500001015B100, CL_WUPS_TITLE_WII_U, /* Tengami (USA) */ },
-  { 0x000500001015B200, CL_WUPS_TITLE_WII_U, /* CHILD of LIGHT (USA) */ },
-  { 0x000500001015B400, CL_WUPS_TITLE_WII_U, /* ソニック&オールスターレーシング TRANSFORMED (Sonic & All-Stars Racing Transformed) (JPN) */ },
-  { 0x000500001015B500, CL_WUPS_TITLE_TG16, /* グラディウス (GRADIUS) (JPN) */ },
-  { 0x000500001015B600, CL_WUPS_TITLE_TG16, /* PC原人 (Bonk's Adventure) (JPN) */ },
-  { 0x000500001015B700, CL_WUPS_TITLE_TG16, /* 高橋名人の新冒険島 (New Adventure Island) (JPN) */ },
-  { 0x000500001015B800, CL_WUPS_TITLE_TG16, /* スーパースターソルジャー (SUPER STAR SOLDIER) (JPN) */ },
-  { 0x000500001015B900, CL_WUPS_TITLE_TG16, /* ニュートピア (NEUTOPIA) (JPN) */ },
-  { 0x000500001015BA00, CL_WUPS_TITLE_TG16, /* PC電人 (Air Zonk) (JPN) */ },
-  { 0x000500001015BB00, CL_WUPS_TITLE_TG16, /* PC原人2 (Bonk's Revenge) (JPN) */ },
-  { 0x000500001015BC00, CL_WUPS_TITLE_TG16, /* PC原人3 (BONK 3 Bonk's Big Adventure) (JPN) */ },
-  { 0x000500001015BD00, CL_WUPS_TITLE_TG16, /* THE 功夫 (China Warrior) (JPN) */ },
-  { 0x000500001015BE00, CL_WUPS_TITLE_TG16, /* ブレイジングレーザーズ (Blazing Lazers) (JPN) */ },
-  { 0x000500001015BF00, CL_WUPS_TITLE_TG16, /* エイリアンクラッシュ (ALIEN CRUSH) (JPN) */ },
-  { 0x000500001015C000, CL_WUPS_TITLE_TG16, /* ニュートピアII (NEUTOPIA II) (JPN) */ },
-  { 0x000500001015C100, CL_WUPS_TITLE_TG16, /* 改造町人シュビビンマン2 －新たなる敵－ (Shockman) (JPN) */ },
-  { 0x000500001015C200, CL_WUPS_TITLE_TG16, /* BE BALL (CHEW MAN FU) (JPN) */ },
-  { 0x000500001015C300, CL_WUPS_TITLE_TG16, /* ファイナルソルジャー (Final Soldier) (JPN) */ },
-  { 0x000500001015C400, CL_WUPS_TITLE_TG16, /* ビクトリーラン (VICTORY RUN) (JPN) */ },
-  { 0x000500001015C500, CL_WUPS_TITLE_TG16, /* ダブルダンジョン (DOUBLE DUNGEONS) (JPN) */ },
-  { 0x000500001015C600, CL_WUPS_TITLE_TG16, /* ソルジャーブレイド (SOLDIER BLADE) (JPN) */ },
-  { 0x000500001015C700, CL_WUPS_TITLE_TG16, /* パワーゴルフ (Power Golf) (JPN) */ },
-  { 0x000500001015C800, CL_WUPS_TITLE_TG16, /* 沙羅曼蛇 (SALAMANDER) (JPN) */ },
-  { 0x000500001015C900, CL_WUPS_TITLE_TG16, /* ボンバーマン '94 (BOMBERMAN '94) (JPN) */ },
-  { 0x000500001015CA00, CL_WUPS_TITLE_TG16, /* 出たな!! ツインビー (DETANA TWIN BEE) (JPN) */ },
-  { 0x000500001015CB00, CL_WUPS_TITLE_TG16, /* デジタルチャンプ (DIGITAL CHAMP) (JPN) */ },
-  { 0x000500001015CC00, CL_WUPS_TITLE_TG16, /* BREAK IN (JPN) */ },
-  { 0x000500001015CD00, CL_WUPS_TITLE_TG16, /* モトローダー (MOTOROADER) (JPN) */ },
-  { 0x000500001015CE00, CL_WUPS_TITLE_TG16, /* ダンジョンエクスプローラー (Dungeon Explorer) (JPN) */ },
-  { 0x000500001015CF00, CL_WUPS_TITLE_TG16, /* パワースポーツ (WORLD SPORTS COMPETITION) (JPN) */ },
-  { 0x000500001015D000, CL_WUPS_TITLE_TG16, /* ウィンズ オブ サンダー (Lords Of Thunder) (JPN) */ },
-  { 0x000500001015D100, CL_WUPS_TITLE_TG16, /* デビルクラッシュ (Devil's Crush) (JPN) */ },
-  { 0x000500001015D200, CL_WUPS_TITLE_TG16, /* ボンバーマン ぱにっくボンバー (BOMBERMAN PANICBOMBER) (JPN) */ },
-  { 0x000500001015D300, CL_WUPS_TITLE_WII_U, /* Lucadian Chronicles (USA) */ },
-  { 0x000500001015D700, CL_WUPS_TITLE_GBA, /* 黄金の太陽 開かれし封印 (Golden Sun) (JPN) */ },
-  { 0x000500001015D800, CL_WUPS_TITLE_GBA, /* Golden Sun (USA) */ },
-  { 0x000500001015D900, CL_WUPS_TITLE_GBA, /* Golden Sun (EUR) */ },
-  { 0x000500001015DA00, CL_WUPS_TITLE_GBA, /* マリオvs.ドンキーコング (Mario vs. Donkey Kong) (JPN) */ },
-  { 0x000500001015DB00, CL_WUPS_TITLE_GBA, /* Mario vs. Donkey Kong (USA) */ },
-  { 0x000500001015DC00, CL_WUPS_TITLE_GBA, /* Mario vs. Donkey Kong (EUR) */ },
-  { 0x000500001015DD00, CL_WUPS_TITLE_GBA, /* 星のカービィ 鏡の大迷宮 (Kirby & The Amazing Mirror) (JPN) */ },
-  { 0x000500001015DE00, CL_WUPS_TITLE_GBA, /* Kirby & The Amazing Mirror (USA) */ },
-  { 0x000500001015DF00, CL_WUPS_TITLE_GBA, /* Kirby & The AMAZING MIRROR (EUR) */ },
-  { 0x000500001015E000, CL_WUPS_TITLE_GBA, /* ゲームボーイウォーズアドバンス 1+2 (Advance Wars 1+2) (JPN) */ },
-  { 0x000500001015E100, CL_WUPS_TITLE_GBA, /* Advance Wars (USA) */ },
-  { 0x000500001015E200, CL_WUPS_TITLE_GBA, /* Advance Wars (EUR) */ },
-  { 0x000500001015E300, CL_WUPS_TITLE_GBA, /* ゼルダの伝説 ふしぎのぼうし (The Legend of Zelda: The Minish Cap) (JPN) */ },
-  { 0x000500001015E400, CL_WUPS_TITLE_GBA, /* The Legend of Zelda: The Minish Cap (USA) */ },
-  { 0x000500001015E500, CL_WUPS_TITLE_GBA, /* The Legend of Zelda: The Minish Cap (EUR) */ },
-  { 0x000500001015EA00, CL_WUPS_TITLE_WII_U, /* おきらくテニスＳＰ (Family Tennis SP) (JPN) */ },
-  { 0x000500001015EB00, CL_WUPS_TITLE_WII_U, /* マイティー スイッチ フォース! ハイパードライブエディション (Mighty Switch Force!™ Hyper Drive Edition) (JPN) */ },
-  { 0x000500001015ED00, CL_WUPS_TITLE_WII_U, /* @SIMPLE DLシリーズ for Wii U Vol.2 THE 密室からの脱出２ (@SIMPLE DLseries for Wii U Vol.2 THE Escape Trick2) (JPN) */ },
-  { 0x000500001015EF00, CL_WUPS_TITLE_NES, /* バレーボール (Volleyball) (JPN) */ },
-  { 0x000500001015F000, CL_WUPS_TITLE_NES, /* Volleyball (USA) */ },
-  { 0x000500001015F100, CL_WUPS_TITLE_NES, /* Volleyball (EUR) */ },
-  { 0x000500001015F200, CL_WUPS_TITLE_NES, /* ファイアーエムブレム 暗黒竜と光の剣 (Fire Emblem Shadow Dragon and the Blade of Light) (JPN) */ },
-  { 0x000500001015F300, CL_WUPS_TITLE_NES, /* 悪魔城伝説 (Castlevania III: Dracula's Curse) (JPN) */ },
-  { 0x000500001015F400, CL_WUPS_TITLE_NES, /* Castlevania III: Dracula's Curse (USA) */ },
-  { 0x000500001015F500, CL_WUPS_TITLE_NES, /* Castlevania III: Dracula's Curse (EUR) */ },
-  { 0x000500001015F600, CL_WUPS_TITLE_NES, /* 半熟英雄 (Hanjuku Hero) (JPN) */ },
-  { 0x000500001015F700, CL_WUPS_TITLE_NES, /* 影の伝説 (The Legend of Kage) (JPN) */ },
-  { 0x000500001015FA00, CL_WUPS_TITLE_NES, /* 熱血高校ドッジボール部　サッカー編 (Nintendo World Cup) (JPN) */ },
-  { 0x000500001015FB00, CL_WUPS_TITLE_NES, /* 飛龍の拳　奥義の書 (Flying Dragon: The Secret Scroll) (JPN) */ },
-  { 0x000500001015FC00, CL_WUPS_TITLE_NES, /* Flying Dragon: The Secret Scroll (USA) */ },
-  { 0x000500001015FD00, CL_WUPS_TITLE_NES, /* Flying Dragon: The Secret Scroll (EUR) */ },
-  { 0x000500001015FE00, CL_WUPS_TITLE_SNES, /* マーヴェラス ～もうひとつの宝島～ (Marvelous: Another Treasure Island) (JPN) */ },
-  { 0x000500001015FF00, CL_WUPS_TITLE_SNES, /* 悪魔城ドラキュラXX (Castlevania Dracula X) (JPN) */ },
-  { 0x0005000010160000, CL_WUPS_TITLE_SNES, /* Castlevania Dracula X (USA) */ },
-  { 0x0005000010160100, CL_WUPS_TITLE_SNES, /* Castlevania Dracula X (EUR) */ },
-  { 0x0005000010160200, CL_WUPS_TITLE_SNES, /* 弟切草 (Otogirisō) (JPN) */ },
-  { 0x0005000010160300, CL_WUPS_TITLE_NES, /* ファイアーエムブレム 外伝 (Fire Emblem Gaiden) (JPN) */ },
-  { 0x0005000010160400, CL_WUPS_TITLE_NES, /* サッカー (Soccer) (JPN) */ },
-  { 0x0005000010160500, CL_WUPS_TITLE_NES, /* Soccer (USA) */ },
-  { 0x0005000010160600, CL_WUPS_TITLE_NES, /* Soccer (EUR) */ },
-  { 0x0005000010160700, CL_WUPS_TITLE_NES, /* マッハライダー (Mach Rider) (JPN) */ },
-  { 0x0005000010160800, CL_WUPS_TITLE_NES, /* Mach Rider (USA) */ },
-  { 0x0005000010160900, CL_WUPS_TITLE_NES, /* Mach Rider (EUR) */ },
-  { 0x0005000010160A00, CL_WUPS_TITLE_NES, /* いけいけ！熱血ホッケー部 「すべってころんで大乱闘」 (Go-Go! Nekketsu Hockey Club Slip-and-Slide Madness) (JPN) */ },
-  { 0x0005000010160B00, CL_WUPS_TITLE_NES, /* ロックマン6 史上最大の戦い!! (Rockman 6) (JPN) */ },
-  { 0x0005000010160C00, CL_WUPS_TITLE_NES, /* MEGA MAN 6 (USA) */ },
-  { 0x0005000010160D00, CL_WUPS_TITLE_NES, /* MEGA MAN 6 (EUR) */ },
-  { 0x0005000010160E00, CL_WUPS_TITLE_NES, /* バトルシティー (Battle City) (JPN) */ },
-  { 0x0005000010160F00, CL_WUPS_TITLE_NES, /* ワギャンランド (Wagyan Land) (JPN) */ },
-  { 0x0005000010161000, CL_WUPS_TITLE_NES, /* サラダの国のトマト姫 (Princess Tomato in the Salad Kingdom) (JPN) */ },
-  { 0x0005000010161100, CL_WUPS_TITLE_NES, /* スーパーチャイニーズ (Super Chinese) (JPN) */ },
-  { 0x0005000010161200, CL_WUPS_TITLE_NES, /* Kung-Fu Heroes (USA) */ },
-  { 0x0005000010161300, CL_WUPS_TITLE_NES, /* Kung-Fu Heroes (EUR) */ },
-  { 0x0005000010161400, CL_WUPS_TITLE_SNES, /* ツインビー レインボーベルアドベンチャー (Pop'n TwinBee RAINBOW BELL ADVENTURES) (JPN) */ },
-  { 0x0005000010161500, CL_WUPS_TITLE_SNES, /* Pop'n TwinBee RAINBOW BELL ADVENTURES (EUR) */ },
-  { 0x0005000010161600, CL_WUPS_TITLE_WII_U, /* Falling Skies: The Game (EUR) */ },
-  { 0x0005000010161700, CL_WUPS_TITLE_WII_U, /* PIKMIN Short Movies HD (JPN) */ },
-  { 0x0005000010161800, CL_WUPS_TITLE_WII_U, /* PIKMIN Short Movies HD (USA) */ },
-  { 0x0005000010161900, CL_WUPS_TITLE_WII_U, /* PIKMIN Short Movies HD (EUR) */ },
-  { 0x0005000010161A00, CL_WUPS_TITLE_WII_U, /* How to Train Your Dragon 2 (USA) */ },
-  { 0x0005000010161B00, CL_WUPS_TITLE_WII_U, /* Teslagrad (EUR) */ },
-  { 0x0005000010161F00, CL_WUPS_TITLE_WII_U, /* マリオパーティ10 (Mario Party 10) (JPN) */ },
-  { 0x0005000010162200, CL_WUPS_TITLE_WII_U, /* Monkey Pirates (EUR) */ },
-  { 0x0005000010162300, CL_WUPS_TITLE_WII_U, /* Color Zen (EUR) */ },
-  { 0x0005000010162400, CL_WUPS_TITLE_WII_U, /* ファミコンリミックス 2 (NES REMIX 2) (JPN) */ },
-  { 0x0005000010162500, CL_WUPS_TITLE_WII_U, /* NES REMIX 2 (USA) */ },
-  { 0x0005000010162600, CL_WUPS_TITLE_WII_U, /* NES REMIX 2 (EUR) */ },
-  { 0x0005000010162700, CL_WUPS_TITLE_WII_U, /* ファミコンリミックス 1+2 (NES REMIX PACK) (JPN) */ },
-  { 0x0005000010162800, CL_WUPS_TITLE_WII_U, /* NES Remix Pack (USA) */ },
-  { 0x0005000010162A00, CL_WUPS_TITLE_WII_U, /* How to Train Your Dragon 2 (EUR) */ },
-  { 0x0005000010162B00, CL_WUPS_TITLE_WII_U, /* スプラトゥーン (Splatoon) (JPN) */ },
-  { 0x0005000010162D00, CL_WUPS_TITLE_WII_U, /* Mario Party 10 (USA) */ },
-  { 0x0005000010162E00, CL_WUPS_TITLE_WII_U, /* Mario Party 10 (EUR) */ },
-  { 0x0005000010162F00, CL_WUPS_TITLE_WII_U, /* Just Dance® Disney Party 2 (USA) */ },
-  { 0x0005000010163200, CL_WUPS_TITLE_TG16, /* R-TYPE (USA) */ },
-  { 0x0005000010163300, CL_WUPS_TITLE_TG16, /* ビジランテ (VIGILANTE) (JPN) */ },
-  { 0x0005000010163400, CL_WUPS_TITLE_TG16, /* VIGILANTE (USA) */ },
-  { 0x0005000010163500, CL_WUPS_TITLE_TG16, /* VIGILANTE (EUR) */ },
-  { 0x0005000010163600, CL_WUPS_TITLE_TG16, /* レジェンド・オブ・ヒーロー・トンマ (Legend of Hero Tonma) (JPN) */ },
-  { 0x0005000010163700, CL_WUPS_TITLE_TG16, /* LEGEND OF HERO TONMA (USA) */ },
-  { 0x0005000010163800, CL_WUPS_TITLE_TG16, /* LEGEND OF HERO TONMA (EUR) */ },
-  { 0x0005000010163900, CL_WUPS_TITLE_TG16, /* 最後の忍道 (Ninja Spirit) (JPN) */ },
-  { 0x0005000010163A00, CL_WUPS_TITLE_TG16, /* NINJA SPIRIT (USA) */ },
-  { 0x0005000010163B00, CL_WUPS_TITLE_TG16, /* NINJA SPIRIT (EUR) */ },
-  { 0x0005000010163C00, CL_WUPS_TITLE_TG16, /* イメージファイト (IMAGEFIGHT) (JPN) */ },
-  { 0x0005000010163D00, CL_WUPS_TITLE_TG16, /* IMAGEFIGHT (USA) */ },
-  { 0x0005000010163E00, CL_WUPS_TITLE_TG16, /* IMAGEFIGHT (EUR) */ },
-  { 0x0005000010163F00, CL_WUPS_TITLE_TG16, /* イメージファイトII (IMAGEFIGHT II) (JPN) */ },
-  { 0x0005000010164000, CL_WUPS_TITLE_TG16, /* IMAGEFIGHT II (USA) */ },
-  { 0x0005000010164100, CL_WUPS_TITLE_TG16, /* IMAGEFIGHT II (EUR) */ },
-  { 0x0005000010164200, CL_WUPS_TITLE_TG16, /* Mr.HELIの大冒険 (Battle Chopper) (JPN) */ },
-  { 0x0005000010164300, CL_WUPS_TITLE_TG16, /* BATTLE CHOPPER (USA) */ },
-  { 0x0005000010164400, CL_WUPS_TITLE_TG16, /* BATTLE CHOPPER (EUR) */ },
-  { 0x0005000010164500, CL_WUPS_TITLE_TG16, /* GRADIUS (USA) */ },
-  { 0x0005000010164600, CL_WUPS_TITLE_TG16, /* GRADIUS (EUR) */ },
-  { 0x0005000010164700, CL_WUPS_TITLE_TG16, /* Bonk's Adventure (USA) */ },
-  { 0x0005000010164800, CL_WUPS_TITLE_TG16, /* Bonk's Adventure (EUR) */ },
-  { 0x0005000010164900, CL_WUPS_TITLE_TG16, /* New Adventure Island (USA) */ },
-  { 0x0005000010164A00, CL_WUPS_TITLE_TG16, /* New Adventure Island (EUR) */ },
-  { 0x0005000010164B00, CL_WUPS_TITLE_TG16, /* SUPER STAR SOLDIER (USA) */ },
-  { 0x0005000010164C00, CL_WUPS_TITLE_TG16, /* SUPER STAR SOLDIER (EUR) */ },
-  { 0x0005000010164D00, CL_WUPS_TITLE_TG16, /* NEUTOPIA (USA) */ },
-  { 0x0005000010164E00, CL_WUPS_TITLE_TG16, /* NEUTOPIA (EUR) */ },
-  { 0x0005000010164F00, CL_WUPS_TITLE_TG16, /* AIR ZONK (USA) */ },
-  { 0x0005000010165000, CL_WUPS_TITLE_TG16, /* AIR ZONK (EUR) */ },
-  { 0x0005000010165100, CL_WUPS_TITLE_TG16, /* BONK'S REVENGE (USA) */ },
-  { 0x0005000010165200, CL_WUPS_TITLE_TG16, /* BONK'S REVENGE (EUR) */ },
-  { 0x0005000010165300, CL_WUPS_TITLE_TG16, /* BONK III Bonk's Big Adventure (USA) */ },
-  { 0x0005000010165400, CL_WUPS_TITLE_TG16, /* BONK III Bonk's Big Adventure (EUR) */ },
-  { 0x0005000010165500, CL_WUPS_TITLE_TG16, /* CHINA WARRIOR (USA) */ },
-  { 0x0005000010165600, CL_WUPS_TITLE_TG16, /* CHINA WARRIOR (EUR) */ },
-  { 0x0005000010165700, CL_WUPS_TITLE_TG16, /* BLAZING LAZERS (USA) */ },
-  { 0x0005000010165800, CL_WUPS_TITLE_TG16, /* Blazing Lazers (EUR) */ },
-  { 0x0005000010165900, CL_WUPS_TITLE_TG16, /* ALIEN CRUSH (USA) */ },
-  { 0x0005000010165A00, CL_WUPS_TITLE_TG16, /* ALIEN CRUSH (EUR) */ },
-  { 0x0005000010165B00, CL_WUPS_TITLE_TG16, /* NEUTOPIA II (USA) */ },
-  { 0x0005000010165C00, CL_WUPS_TITLE_TG16, /* NEUTOPIA II (EUR) */ },
-  { 0x0005000010165D00, CL_WUPS_TITLE_TG16, /* SHOCKMAN (USA) */ },
-  { 0x0005000010165E00, CL_WUPS_TITLE_TG16, /* SHOCKMAN (EUR) */ },
-  { 0x0005000010165F00, CL_WUPS_TITLE_TG16, /* CHEW MAN FU (USA) */ },
-  { 0x0005000010166000, CL_WUPS_TITLE_TG16, /* CHEW MAN FU (EUR) */ },
-  { 0x0005000010166100, CL_WUPS_TITLE_TG16, /* FINAL SOLDIER (USA) */ },
-  { 0x0005000010166200, CL_WUPS_TITLE_TG16, /* FINAL SOLDIER (EUR) */ },
-  { 0x0005000010166300, CL_WUPS_TITLE_TG16, /* VICTORY RUN (USA) */ },
-  { 0x0005000010166400, CL_WUPS_TITLE_TG16, /* VICTORY RUN (EUR) */ },
-  { 0x0005000010166500, CL_WUPS_TITLE_TG16, /* DOUBLE DUNGEONS (USA) */ },
-  { 0x0005000010166600, CL_WUPS_TITLE_TG16, /* DOUBLE DUNGEONS (EUR) */ },
-  { 0x0005000010166700, CL_WUPS_TITLE_TG16, /* SOLDIER BLADE (USA) */ },
-  { 0x0005000010166800, CL_WUPS_TITLE_TG16, /* SOLDIER BLADE (EUR) */ },
-  { 0x0005000010166900, CL_WUPS_TITLE_TG16, /* POWER GOLF (USA) */ },
-  { 0x0005000010166A00, CL_WUPS_TITLE_TG16, /* POWER GOLF (EUR) */ },
-  { 0x0005000010166B00, CL_WUPS_TITLE_TG16, /* SALAMANDER (USA) */ },
-  { 0x0005000010166C00, CL_WUPS_TITLE_TG16, /* SALAMANDER (EUR) */ },
-  { 0x0005000010166D00, CL_WUPS_TITLE_TG16, /* BOMBERMAN '94 (USA) */ },
-  { 0x0005000010166E00, CL_WUPS_TITLE_TG16, /* BOMBERMAN '94 (EUR) */ },
-  { 0x0005000010166F00, CL_WUPS_TITLE_TG16, /* DETANA TWIN BEE (USA) */ },
-  { 0x0005000010167000, CL_WUPS_TITLE_TG16, /* DETANA TWIN BEE (EUR) */ },
-  { 0x0005000010167100, CL_WUPS_TITLE_TG16, /* DIGITAL CHAMP (USA) */ },
-  { 0x0005000010167200, CL_WUPS_TITLE_TG16, /* DIGITAL CHAMP (EUR) */ },
-  { 0x0005000010167300, CL_WUPS_TITLE_TG16, /* BREAK IN (USA) */ },
-  { 0x0005000010167400, CL_WUPS_TITLE_TG16, /* BREAK IN (EUR) */ },
-  { 0x0005000010167500, CL_WUPS_TITLE_TG16, /* MOTOROADER (USA) */ },
-  { 0x0005000010167600, CL_WUPS_TITLE_TG16, /* MOTOROADER (EUR) */ },
-  { 0x0005000010167700, CL_WUPS_TITLE_TG16, /* DUNGEON EXPLORER (USA) */ },
-  { 0x0005000010167800, CL_WUPS_TITLE_TG16, /* DUNGEON EXPLORER (EUR) */ },
-  { 0x0005000010167900, CL_WUPS_TITLE_TG16, /* WORLD SPORTS COMPETITION (USA) */ },
-  { 0x0005000010167A00, CL_WUPS_TITLE_TG16, /* WORLD SPORTS COMPETITION (EUR) */ },
-  { 0x0005000010167B00, CL_WUPS_TITLE_TG16, /* LORDS OF THUNDER (USA) */ },
-  { 0x0005000010167C00, CL_WUPS_TITLE_TG16, /* LORDS OF THUNDER (EUR) */ },
-  { 0x0005000010167D00, CL_WUPS_TITLE_TG16, /* DEVIL'S CRUSH (USA) */ },
-  { 0x0005000010167E00, CL_WUPS_TITLE_TG16, /* DEVIL'S CRUSH (EUR) */ },
-  { 0x0005000010167F00, CL_WUPS_TITLE_TG16, /* BOMBERMAN PANIC BOMBER (USA) */ },
-  { 0x0005000010168000, CL_WUPS_TITLE_TG16, /* BOMBERMAN PANIC BOMBER (EUR) */ },
-  { 0x0005000010168100, CL_WUPS_TITLE_MSX, /* パロディウス (PARODIUS) (JPN) */ },
-  { 0x0005000010168200, CL_WUPS_TITLE_MSX, /* 夢大陸アドベンチャー (PENGUIN ADVENTURE) (JPN) */ },
-  { 0x0005000010168300, CL_WUPS_TITLE_MSX, /* スペースマンボウ (Space Manbow) (JPN) */ },
-  { 0x0005000010168400, CL_WUPS_TITLE_MSX, /* イーガー皇帝の逆襲 イー・アル・カンフー2 (Yie Ar Kung-Fu II The Emperor Yie-Gah) (JPN) */ },
-  { 0x0005000010168500, CL_WUPS_TITLE_MSX, /* ロードファイター (ROAD FIGHTER) (JPN) */ },
-  { 0x0005000010168600, CL_WUPS_TITLE_MSX, /* クォース (QUARTH) (JPN) */ },
-  { 0x0005000010168700, CL_WUPS_TITLE_MSX, /* 魂斗羅 (Contra) (JPN) */ },
-  { 0x0005000010168800, CL_WUPS_TITLE_MSX, /* 魔城伝説 (Knightmare) (JPN) */ },
-  { 0x0005000010168900, CL_WUPS_TITLE_MSX, /* グラディウス2 (GLADIUS2) (JPN) */ },
-  { 0x0005000010168A00, CL_WUPS_TITLE_SNES, /* ゴーファーの野望・EPISODE II (NEMESIS3 THE EVE OF DESTRUCTION) (JPN) */ },
-  { 0x0005000010168B00, CL_WUPS_TITLE_TG16, /* 沙羅曼蛇 (SALAMANDER) (JPN) */ },
-  { 0x0005000010168D00, CL_WUPS_TITLE_WII_U, /* LEGO® The Hobbit™ (EUR) */ },
-  { 0x0005000010168F00, CL_WUPS_TITLE_WII_U, /* JUST DANCE® Wii U (JPN) */ },
-  { 0x0005000010169000, CL_WUPS_TITLE_WII_U, /* My Exotic Farm (EUR) */ },
-  { 0x0005000010169500, CL_WUPS_TITLE_WII_U, /* My Exotic Farm (USA) */ },
-  { 0x0005000010169600, CL_WUPS_TITLE_WII_U, /* Unepic EnjoyUp Games (EUR) */ },
-  { 0x0005000010169700, CL_WUPS_TITLE_GBA, /* ミスタードリラー2 (Mr. Driller 2) (JPN) */ },
-  { 0x0005000010169800, CL_WUPS_TITLE_GBA, /* 風のクロノア ～夢見る帝国～ (Klonoa Empire of Dreams) (JPN) */ },
-  { 0x0005000010169900, CL_WUPS_TITLE_GBA, /* マリオテニスアドバンス (Mario Tennis Advance) (JPN) */ },
-  { 0x0005000010169A00, CL_WUPS_TITLE_GBA, /* Mario Tennis: Power Tour (USA) */ },
-  { 0x0005000010169B00, CL_WUPS_TITLE_GBA, /* Mario Power Tennis (EUR) */ },
-  { 0x0005000010169C00, CL_WUPS_TITLE_GBA, /* スーパーマリオアドバンス4 (Super Mario Advance: 4 Super Mario Bros. 3) (JPN) */ },
-  { 0x0005000010169D00, CL_WUPS_TITLE_GBA, /* Super Mario Advance 4: Super Mario Bros. 3 (USA) */ },
-  { 0x0005000010169E00, CL_WUPS_TITLE_GBA, /* Super Mario Advance 4: Super Mario Bros. 3 (EUR) */ },
-  { 0x0005000010169F00, CL_WUPS_TITLE_GBA, /* ワリオランドアドバンス ヨーキのお宝 (Wario Land 4) (JPN) */ },
-  { 0x000500001016A000, CL_WUPS_TITLE_GBA, /* Wario Land 4 (USA) */ },
-  { 0x000500001016A100, CL_WUPS_TITLE_GBA, /* Wario Land 4 (EUR) */ },
-  { 0x000500001016A200, CL_WUPS_TITLE_WII_U, /* Bombing Bastards (EUR) */ },
-  { 0x000500001016A300, CL_WUPS_TITLE_WII_U, /* My First Songs (EUR) */ },
-  { 0x000500001016A400, CL_WUPS_TITLE_WII_U, /* LEGO® Batman™ 3 Beyond Gotham (EUR) */ },
-  { 0x000500001016A500, CL_WUPS_TITLE_TG16, /* R-TYPE (EUR) */ },
-  { 0x000500001016A600, CL_WUPS_TITLE_WII_U, /* わいわい！みんなでチャレンジ (Spin the Bottle: Bumpie's Party) (JPN) */ },
-  { 0x000500001016A700, CL_WUPS_TITLE_WII_U, /* LEGO® The Hobbit™ (USA) */ },
-  { 0x000500001016A800, CL_WUPS_TITLE_WII_U, /* Wii Fit Uのご案内 (Wii Fit U Information) (JPN) */ },
-  { 0x000500001016A900, CL_WUPS_TITLE_WII_U, /* Wii Fit U Info (USA) */ },
-  { 0x000500001016AA00, CL_WUPS_TITLE_WII_U, /* Wii Fit U Info (EUR) */ },
-  { 0x000500001016AB00, CL_WUPS_TITLE_WII_U, /* Bombing Bastards (USA) */ },
-  { 0x000500001016AC00, CL_WUPS_TITLE_WII_U, /* Armillo (USA) */ },
-  { 0x000500001016AD00, CL_WUPS_TITLE_WII_U, /* LEGO® Batman™ 3 Beyond Gotham (USA) */ },
-  { 0x000500001016AE00, CL_WUPS_TITLE_WII_U, /* Wings of Magloryx (USA) */ },
-  { 0x000500001016B000, CL_WUPS_TITLE_WII_U, /* まちがいさがしパーティー (Spot the Differences! Party) (JPN) */ },
-  { 0x000500001016B100, CL_WUPS_TITLE_WII_U, /* Gravity Badgers (USA) */ },
-  { 0x000500001016B200, CL_WUPS_TITLE_WII_U, /* Master Reboot (USA) */ },
-  { 0x000500001016B300, CL_WUPS_TITLE_NES, /* アドベンチャーズ オブ ロロ (Adventures of Lolo) (JPN) */ },
-  { 0x000500001016B400, CL_WUPS_TITLE_NES, /* ADVENTURES OF LOLO (USA) */ },
-  { 0x000500001016B500, CL_WUPS_TITLE_NES, /* ADVENTURES OF LOLO (EUR) */ },
-  { 0x000500001016B600, CL_WUPS_TITLE_NES, /* ジョイメカファイト (Joy Mech Fight) (JPN) */ },
-  { 0x000500001016B700, CL_WUPS_TITLE_NES, /* パックランド (Pac-Land) (JPN) */ },
-  { 0x000500001016B800, CL_WUPS_TITLE_NES, /* PAC-LAND (USA) */ },
-  { 0x000500001016B900, CL_WUPS_TITLE_NES, /* PAC-LAND (EUR) */ },
-  { 0x000500001016BA00, CL_WUPS_TITLE_NES, /* 燃えろ!!プロ野球 (Bases Loaded) (JPN) */ },
-  { 0x000500001016BB00, CL_WUPS_TITLE_NES, /* Bases Loaded (USA) */ },
-  { 0x000500001016BC00, CL_WUPS_TITLE_MSX, /* イー・アル・カンフー (Yie Ar Kung-Fu) (JPN) */ },
-  { 0x000500001016BD00, CL_WUPS_TITLE_MSX, /* けっきょく南極大冒険 (Antarctic Adventure) (JPN) */ },
-  { 0x000500001016BE00, CL_WUPS_TITLE_NES, /* ロックマン5 ブルースの罠! (Rockman 5) (JPN) */ },
-  { 0x000500001016BF00, CL_WUPS_TITLE_NES, /* MEGA MAN 5 (USA) */ },
-  { 0x000500001016C000, CL_WUPS_TITLE_NES, /* MEGA MAN 5 (EUR) */ },
-  { 0x000500001016C100, CL_WUPS_TITLE_NES, /* レッドアリーマーⅡ (Gargoyle's Quest II) (JPN) */ },
-  { 0x000500001016C200, CL_WUPS_TITLE_NES, /* Gargoyle's Quest II: The Demon Darkness (USA) */ },
-  { 0x000500001016C300, CL_WUPS_TITLE_NES, /* Gargoyle's Quest II: The Demon Darkness (EUR) */ },
-  { 0x000500001016C400, CL_WUPS_TITLE_SNES, /* ストリートファイターZERO2 (Street Fighter Zero 2) (JPN) */ },
-  { 0x000500001016C500, CL_WUPS_TITLE_SNES, /* Street Fighter Alpha 2 (USA) */ },
-  { 0x000500001016C600, CL_WUPS_TITLE_SNES, /* Street Fighter Alpha 2 (EUR) */ },
-  { 0x000500001016C700, CL_WUPS_TITLE_WII_U, /* Armillo (EUR) */ },
-  { 0x000500001016C800, CL_WUPS_TITLE_WII_U, /* Just Dance® Disney Party 2 (EUR) */ },
-  { 0x000500001016CE00, CL_WUPS_TITLE_WII_U, /* Color Zen (USA) */ },
-  { 0x000500001016CF00, CL_WUPS_TITLE_GBA, /* Mr. Driller 2 (USA) */ },
-  { 0x000500001016D000, CL_WUPS_TITLE_GBA, /* Mr. Driller 2 (EUR) */ },
-  { 0x000500001016D100, CL_WUPS_TITLE_GBA, /* KLONOA: Empire of Dreams (USA) */ },
-  { 0x000500001016D200, CL_WUPS_TITLE_GBA, /* Klonoa: Empire of Dreams (EUR) */ },
-  { 0x000500001016D300, CL_WUPS_TITLE_WII_U, /* Batman™: Arkham Origins Blackgate - Deluxe Edition (EUR) */ },
-  { 0x000500001016D400, CL_WUPS_TITLE_WII_U, /* Stick it to the Man (EUR) */ },
-  { 0x000500001016D500, CL_WUPS_TITLE_WII_U, /* Super Toy Cars (EUR) */ },
-  { 0x000500001016D600, CL_WUPS_TITLE_WII_U, /* The Amazing Spider-Man 2™ (EUR) */ },
-  { 0x000500001016D800, CL_WUPS_TITLE_WII_U, /* CHILD of LIGHT (JPN) */ },
-  { 0x000500001016D900, CL_WUPS_TITLE_WII_U, /* Abyss (EUR) */ },
-  { 0x000500001016DA00, CL_WUPS_TITLE_WII_U, /* Nihilumbra (EUR) */ },
-  { 0x000500001016DB00, CL_WUPS_TITLE_WII_U, /* Ittle Dew (EUR) */ },
-  { 0x000500001016DC00, CL_WUPS_TITLE_WII_U, /* Disney Infinity [2.0] (USA) */ },
-  { 0x000500001016DD00, CL_WUPS_TITLE_WII_U, /* Mon Premier Karaoké (My First Songs) (USA) */ },
-  { 0x000500001016DE00, CL_WUPS_TITLE_WII_U, /* Super Toy Cars (USA) */ },
-  { 0x000500001016DF00, CL_WUPS_TITLE_WII_U, /* Batman™: Arkham Origins Blackgate - Deluxe Edition (USA) */ },
-  { 0x000500001016E000, CL_WUPS_TITLE_WII_U, /* Stick it to the Man (USA) */ },
-  { 0x000500001016E100, CL_WUPS_TITLE_WII_U, /* Shovel Knight (USA) */ },
-  { 0x000500001016E200, CL_WUPS_TITLE_WII_U, /* XType Plus (EUR) */ },
-  { 0x000500001016E300, CL_WUPS_TITLE_WII_U, /* GravBlocks+ From Nothing Game Studios (USA) */ },
-  { 0x000500001016E500, CL_WUPS_TITLE_WII_U, /* BLOK DROP U (USA) */ },
-  { 0x000500001016E600, CL_WUPS_TITLE_WII_U, /* ZaciSa's Last Stand (USA) */ },
-  { 0x000500001016E700, CL_WUPS_TITLE_WII_U, /* 99Seconds (USA) */ },
-  { 0x000500001016E800, CL_WUPS_TITLE_WII_U, /* Master Reboot (EUR) */ },
-  { 0x000500001016E900, CL_WUPS_TITLE_WII_U, /* Gravity Badgers (EUR) */ },
-  { 0x000500001016EA00, CL_WUPS_TITLE_WII_U, /* CHILD of LIGHT (EUR) */ },
-  { 0x000500001016EF00, CL_WUPS_TITLE_WII_U, /* Angry Bunnies: Colossal Carrot Crusade (USA) */ },
-  { 0x000500001016F100, CL_WUPS_TITLE_GBA, /* 悪魔城ドラキュラ ～サークル オブ ザ ムーン～ (Castlevania Circle of the Moon) (JPN) */ },
-  { 0x000500001016F200, CL_WUPS_TITLE_GBA, /* Castlevania Circle of the Moon (USA) */ },
-  { 0x000500001016F300, CL_WUPS_TITLE_GBA, /* 星のカービィ 夢の泉デラックス (Kirby: Nightmare in Dream Land) (JPN) */ },
-  { 0x000500001016F400, CL_WUPS_TITLE_GBA, /* Kirby: Nightmare in Dream Land (USA) */ },
-  { 0x000500001016F500, CL_WUPS_TITLE_GBA, /* スーパーマリオアドバンス2 (Super Mario World: Super Mario Advance 2) (JPN) */ },
-  { 0x000500001016F600, CL_WUPS_TITLE_GBA, /* Super Mario World: Super Mario Advance 2 (USA) */ },
-  { 0x000500001016F700, CL_WUPS_TITLE_GBA, /* マリオゴルフ GBAツアー (Mario Golf: Advance Tour) (JPN) */ },
-  { 0x000500001016F800, CL_WUPS_TITLE_GBA, /* Mario Golf: Advance Tour (USA) */ },
-  { 0x000500001016F900, CL_WUPS_TITLE_GBA, /* メトロイド ゼロミッション (Metroid: Zero Mission) (JPN) */ },
-  { 0x000500001016FA00, CL_WUPS_TITLE_GBA, /* Metroid: Zero Mission (USA) */ },
-  { 0x000500001016FB00, CL_WUPS_TITLE_WII_U, /* Mon Premier Karaoké (EUR) */ },
-  { 0x000500001016FC00, CL_WUPS_TITLE_WII_U, /* Aqua Moto Racing Utopia (USA) */ },
-  { 0x000500001016FD00, CL_WUPS_TITLE_WII_U, /* Ava and Avior Save the Earth (USA) */ },
-  { 0x000500001016FE00, CL_WUPS_TITLE_WII_U, /* Ballpoint Universe: Infinite (USA) */ },
-  { 0x000500001016FF00, CL_WUPS_TITLE_WII_U, /* Flowerworks HD: Follie's Adventure (USA) */ },
-  { 0x0005000010170100, CL_WUPS_TITLE_WII_U, /* Monkey Pirates (USA) */ },
-  { 0x0005000010170200, CL_WUPS_TITLE_WII_U, /* Pier Solar and the Great Architects (USA) */ },
-  { 0x0005000010170400, CL_WUPS_TITLE_WII_U, /* XType Plus (USA) */ },
-  { 0x0005000010170600, CL_WUPS_TITLE_WII_U, /* 仮面ライダー バトライド・ウォーⅡ プレミアムTV＆MOVIEサウンドED. (KAMEN RIDER BATTRIDE WAR Ⅱ PREMIUM TV&MOVIE SOUND ED.) (JPN) */ },
-  { 0x0005000010170700, CL_WUPS_TITLE_WII_U, /* 仮面ライダー バトライド・ウォーⅡ (KAMEN RIDER BATTRIDE WAR Ⅱ) (JPN) */ },
-  { 0x0005000010170800, CL_WUPS_TITLE_TG16, /* R-TYPE (JPN) */ },
-  { 0x0005000010170900, CL_WUPS_TITLE_NES, /* Castlevania (EUR) */ },
-  { 0x0005000010170A00, CL_WUPS_TITLE_NES, /* 謎の村雨城 (The Mysterious Murasame Castle) (JPN) */ },
-  { 0x0005000010170B00, CL_WUPS_TITLE_NES, /* ダブルドラゴンⅡ The Revenge (Double Dragon II The Revenge) (JPN) */ },
-  { 0x0005000010170C00, CL_WUPS_TITLE_NES, /* DOUBLE DRAGON II: The Revenge (USA) */ },
-  { 0x0005000010170D00, CL_WUPS_TITLE_NES, /* DOUBLE DRAGON II: The Revenge (EUR) */ },
-  { 0x0005000010170E00, CL_WUPS_TITLE_NES, /* 沙羅曼蛇 (Salamander) (JPN) */ },
-  { 0x0005000010170F00, CL_WUPS_TITLE_NES, /* Life Force (USA) */ },
-  { 0x0005000010171000, CL_WUPS_TITLE_NES, /* Life Force (EUR) */ },
-  { 0x0005000010171100, CL_WUPS_TITLE_NES, /* へべれけ (Hebereke) (JPN) */ },
-  { 0x0005000010171200, CL_WUPS_TITLE_NES, /* Ufouria: The Saga (USA) */ },
-  { 0x0005000010171300, CL_WUPS_TITLE_NES, /* Ufouria: THE SAGA (EUR) */ },
-  { 0x0005000010171400, CL_WUPS_TITLE_NES, /* バベルの塔 (Tower of Babel) (JPN) */ },
-  { 0x0005000010171500, CL_WUPS_TITLE_NES, /* クインティ (Quinty) (JPN) */ },
-  { 0x0005000010171600, CL_WUPS_TITLE_SNES, /* ラストバイブルⅢ (Last Bible III) (JPN) */ },
-  { 0x0005000010171700, CL_WUPS_TITLE_SNES, /* スーパーチャイニーズワールド (Super Ninja Boy) (JPN) */ },
-  { 0x0005000010171A00, CL_WUPS_TITLE_SNES, /* くにおくんのドッジボールだよ全員集合! (Kunio-kun no Dodge Ball da yo: Zenin Shūgo) (JPN) */ },
-  { 0x0005000010171B00, CL_WUPS_TITLE_SNES, /* SUPER 信長の野望･全国版 (Nobunaga's Ambition) (JPN) */ },
-  { 0x0005000010171C00, CL_WUPS_TITLE_SNES, /* Nobunaga's Ambition (USA) */ },
-  { 0x0005000010171D00, CL_WUPS_TITLE_SNES, /* Nobunaga's Ambition (EUR) */ },
-  { 0x0005000010171E00, CL_WUPS_TITLE_WII_U, /* Wii Sports Club Lite (JPN) */ },
-  { 0x0005000010171F00, CL_WUPS_TITLE_WII_U, /* Pushmo World (USA) */ },
-  { 0x0005000010172000, CL_WUPS_TITLE_WII_U, /* Pullblox World (EUR) */ },
-  { 0x0005000010172100, CL_WUPS_TITLE_WII_U, /* Meine Ersten Mitsing-Lieder (My First Songs) (EUR) */ },
-  { 0x0005000010172200, CL_WUPS_TITLE_WII_U, /* Color Zen Kids (USA) */ },
-  { 0x0005000010172600, CL_WUPS_TITLE_WII_U, /* BAYONETTA 2 (USA) */ },
-  { 0x0005000010172700, CL_WUPS_TITLE_WII_U, /* BAYONETTA 2 (EUR) */ },
-  { 0x0005000010172900, CL_WUPS_TITLE_WII_U, /* Aqua Moto Racing Utopia (EUR) */ },
-  { 0x0005000010172A00, CL_WUPS_TITLE_WII_U, /* Crunchyroll (USA) */ },
-  { 0x0005000010172B00, CL_WUPS_TITLE_WII_U, /* Crunchyroll (EUR) */ },
-  { 0x0005000010172C00, CL_WUPS_TITLE_GBA, /* Kirby: Nightmare in Dream Land (EUR) */ },
-  { 0x0005000010172D00, CL_WUPS_TITLE_GBA, /* Super Mario World: Super Mario Advance 2 (EUR) */ },
-  { 0x0005000010172E00, CL_WUPS_TITLE_GBA, /* Mario Golf: Advance Tour (EUR) */ },
-  { 0x0005000010172F00, CL_WUPS_TITLE_GBA, /* Metroid: Zero Mission (EUR) */ },
-  { 0x0005000010173000, CL_WUPS_TITLE_WII_U, /* 任天堂ゲームセミナー2013 受講生作品 (Nintendo Game Seminar 2013 Student Works) (JPN) */ },
-  { 0x0005000010173100, CL_WUPS_TITLE_WII_U, /* I've Got to Run! (USA) */ },
-  { 0x0005000010173200, CL_WUPS_TITLE_WII_U, /* Another World 20th Anniversary Edition (EUR) */ },
-  { 0x0005000010173300, CL_WUPS_TITLE_WII_U, /* Stealth Inc 2 A Game of Clones (EUR) */ },
-  { 0x0005000010173400, CL_WUPS_TITLE_WII_U, /* TRANSFORMERS: Rise of the Dark Spark (EUR) */ },
-  { 0x0005000010173500, CL_WUPS_TITLE_GBA, /* スーパーマリオアドバンス (Super Mario Advance) (JPN) */ },
-  { 0x0005000010173600, CL_WUPS_TITLE_GBA, /* Super Mario Advance (USA) */ },
-  { 0x0005000010173700, CL_WUPS_TITLE_GBA, /* Super Mario Advance (EUR) */ },
-  { 0x0005000010173800, CL_WUPS_TITLE_GBA, /* パックマンコレクション (Pac-Man Collection) (JPN) */ },
-  { 0x0005000010173900, CL_WUPS_TITLE_GBA, /* PAC-MAN Collection (USA) */ },
-  { 0x0005000010173A00, CL_WUPS_TITLE_GBA, /* ファイアーエムブレム 烈火の剣 (Fire Emblem) (JPN) */ },
-  { 0x0005000010173B00, CL_WUPS_TITLE_GBA, /* Fire Emblem (USA) */ },
-  { 0x0005000010173C00, CL_WUPS_TITLE_GBA, /* Fire Emblem (EUR) */ },
-  { 0x0005000010173D00, CL_WUPS_TITLE_GBA, /* Fire Emblem (EUR) */ },
-  { 0x0005000010173E00, CL_WUPS_TITLE_GBA, /* スーパーマリオボール (Super Mario Ball) (JPN) */ },
-  { 0x0005000010173F00, CL_WUPS_TITLE_GBA, /* PAC-MAN COLLECTION (EUR) */ },
-  { 0x0005000010174000, CL_WUPS_TITLE_GBA, /* Mario Pinball Land (USA) */ },
-  { 0x0005000010174100, CL_WUPS_TITLE_GBA, /* Super Mario Ball (EUR) */ },
-  { 0x0005000010174200, CL_WUPS_TITLE_WII_U, /* Color Zen Kids (EUR) */ },
-  { 0x0005000010174300, CL_WUPS_TITLE_NES, /* ドンキーコングJR.の算数遊び (Donkey Kong Jr. Math) (JPN) */ },
-  { 0x0005000010174400, CL_WUPS_TITLE_NES, /* Donkey Kong Jr. Math (USA) */ },
-  { 0x0005000010174500, CL_WUPS_TITLE_NES, /* Donkey Kong Jr. Math (EUR) */ },
-  { 0x0005000010174600, CL_WUPS_TITLE_NES, /* ディグダグ (Dig Dug) (JPN) */ },
-  { 0x0005000010174700, CL_WUPS_TITLE_NES, /* DIG DUG (USA) */ },
-  { 0x0005000010174800, CL_WUPS_TITLE_NES, /* DIG DUG (EUR) */ },
-  { 0x0005000010174900, CL_WUPS_TITLE_NES, /* ドラゴンバスター (Dragon Buster) (JPN) */ },
-  { 0x0005000010174A00, CL_WUPS_TITLE_NES, /* つっぱり大相撲 (Tsuppari Ōzumō) (JPN) */ },
-  { 0x0005000010174B00, CL_WUPS_TITLE_NES, /* ナッツ&ミルク (Nuts & Milk) (JPN) */ },
-  { 0x0005000010174C00, CL_WUPS_TITLE_SNES, /* 平成 新･鬼ヶ島 前編 (Heisei Shin Onigashima: Zenpen) (JPN) */ },
-  { 0x0005000010174D00, CL_WUPS_TITLE_SNES, /* ロックマン7 宿命の対決! (Rockman 7) (JPN) */ },
-  { 0x0005000010174E00, CL_WUPS_TITLE_SNES, /* MEGA MAN 7 (USA) */ },
-  { 0x0005000010174F00, CL_WUPS_TITLE_SNES, /* MEGA MAN 7 (EUR) */ },
-  { 0x0005000010175100, CL_WUPS_TITLE_SNES, /* ロックマンX3 (Mega Man X3) (JPN) */ },
-  { 0x0005000010175200, CL_WUPS_TITLE_SNES, /* MEGA MAN X3 (USA) */ },
-  { 0x0005000010175300, CL_WUPS_TITLE_SNES, /* MEGA MAN X3 (EUR) */ },
-  { 0x0005000010175400, CL_WUPS_TITLE_WII_U, /* Paper Monsters Recut (USA) */ },
-  { 0x0005000010175500, CL_WUPS_TITLE_WII_U, /* Another World Out of This World (USA) */ },
-  { 0x0005000010175700, CL_WUPS_TITLE_WII_U, /* BLOK DROP U (EUR) */ },
-  { 0x0005000010175800, CL_WUPS_TITLE_WII_U, /* My Jurassic Farm (USA) */ },
-  { 0x0005000010175900, CL_WUPS_TITLE_WII_U, /* My Arctic Farm (USA) */ },
-  { 0x0005000010175A00, CL_WUPS_TITLE_WII_U, /* 6180 the moon (USA) */ },
-  { 0x0005000010175B00, CL_WUPS_TITLE_WII_U, /* Sonic Boom: Rise of Lyric (USA) */ },
-  { 0x0005000010175C00, CL_WUPS_TITLE_WII_U, /* ONE PIECE Unlimited World Red (USA) */ },
-  { 0x0005000010175D00, CL_WUPS_TITLE_WII_U, /* ONE PIECE Unlimited World Red (EUR) */ },
-  { 0x0005000010175E00, CL_WUPS_TITLE_WII_U, /* ギアナシスターズ ツイステッドドリームズ (Giana Sisters Twisted Dreams) (JPN) */ },
-  { 0x0005000010175F00, CL_WUPS_TITLE_WII_U, /* D.M.L.C.-デスマッチラブコメ- (Death Match Love Comedy) (JPN) */ },
-  { 0x0005000010176000, CL_WUPS_TITLE_GBA, /* Castlevania 白夜の協奏曲 (Castlevania Harmony of Dissonance) (JPN) */ },
-  { 0x0005000010176100, CL_WUPS_TITLE_GBA, /* Castlevania Harmony of Dissonance (USA) */ },
-  { 0x0005000010176200, CL_WUPS_TITLE_GBA, /* Castlevania Harmony of Dissonance (EUR) */ },
-  { 0x0005000010176300, CL_WUPS_TITLE_WII_U, /* リトル インフェルノ (Little Inferno) (JPN) */ },
-  { 0x0005000010176400, CL_WUPS_TITLE_WII_U, /* Pixel Paint (USA) */ },
-  { 0x0005000010176500, CL_WUPS_TITLE_WII_U, /* Stealth Inc 2 A Game of Clones (USA) */ },
-  { 0x0005000010176600, CL_WUPS_TITLE_WII_U, /* グレートレース (GREAT RACE) (JPN) */ },
-  { 0x0005000010176700, CL_WUPS_TITLE_WII_U, /* ケモノダッシュ！ (Kemono Dash!) (JPN) */ },
-  { 0x0005000010176800, CL_WUPS_TITLE_WII_U, /* Guacamelee! Super Turbo Championship Edition (USA) */ },
-  { 0x0005000010176900, CL_WUPS_TITLE_WII_U, /* Splatoon (USA) */ },
-  { 0x0005000010176A00, CL_WUPS_TITLE_WII_U, /* Splatoon (EUR) */ },
-  { 0x0005000010176B00, CL_WUPS_TITLE_WII_U, /* 1001 Spikes (USA) */ },
-  { 0x0005000010176C00, CL_WUPS_TITLE_GBA, /* 黄金の太陽 失われし時代 (Golden Sun: The Lost Age) (JPN) */ },
-  { 0x0005000010176D00, CL_WUPS_TITLE_GBA, /* Golden Sun: The Lost Age (USA) */ },
-  { 0x0005000010176E00, CL_WUPS_TITLE_GBA, /* Golden Sun: The Lost Age (EUR) */ },
-  { 0x0005000010176F00, CL_WUPS_TITLE_WII_U, /* JUST DANCE® 2015 (EUR) */ },
-  { 0x0005000010177000, CL_WUPS_TITLE_WII_U, /* Hello Kitty Kruisers (EUR) */ },
-  { 0x0005000010177200, CL_WUPS_TITLE_WII_U, /* Citizens of Earth (USA) */ },
-  { 0x0005000010177300, CL_WUPS_TITLE_WII_U, /* Fit Music (USA) */ },
-  { 0x0005000010177400, CL_WUPS_TITLE_WII_U, /* Luv Me Buddies Wonderland (USA) */ },
-  { 0x0005000010177500, CL_WUPS_TITLE_WII_U, /* Nihilumbra (USA) */ },
-  { 0x0005000010177600, CL_WUPS_TITLE_WII_U, /* Devil's Third (USA) */ },
-  { 0x0005000010177700, CL_WUPS_TITLE_WII_U, /* Devil's Third (EUR) */ },
-  { 0x0005000010177800, CL_WUPS_TITLE_WII_U, /* Sonic Boom: Rise Of Lyric (EUR) */ },
-  { 0x0005000010177900, CL_WUPS_TITLE_NES, /* 五目ならべ 連珠 (Gomoku Narabe Renju) (JPN) */ },
-  { 0x0005000010177A00, CL_WUPS_TITLE_NES, /* マイティファイナルファイト (Mighty Final Fight) (JPN) */ },
-  { 0x0005000010177B00, CL_WUPS_TITLE_NES, /* Mighty Final Fight (USA) */ },
-  { 0x0005000010177C00, CL_WUPS_TITLE_NES, /* Mighty Final Fight (EUR) */ },
-  { 0x0005000010177D00, CL_WUPS_TITLE_NES, /* 2010 ストリートファイター (Street Fighter 2010) (JPN) */ },
-  { 0x0005000010177E00, CL_WUPS_TITLE_NES, /* Street Fighter 2010: The Final Fight (USA) */ },
-  { 0x0005000010177F00, CL_WUPS_TITLE_NES, /* Street Fighter 2010: The Final Fight (EUR) */ },
-  { 0x0005000010178000, CL_WUPS_TITLE_SNES, /* 平成 新･鬼ヶ島 後編 (Heisei Shin Onigashima: Kōhen) (JPN) */ },
-  { 0x0005000010178100, CL_WUPS_TITLE_SNES, /* すってはっくん (Sutte Hakkun) (JPN) */ },
-  { 0x0005000010178200, CL_WUPS_TITLE_SNES, /* 学校であった怖い話 (Gakkou de atta Kowai Hanashi) (JPN) */ },
-  { 0x0005000010178300, CL_WUPS_TITLE_SNES, /* Wild Guns (USA) */ },
-  { 0x0005000010178400, CL_WUPS_TITLE_SNES, /* Wild Guns (EUR) */ },
-  { 0x0005000010178600, CL_WUPS_TITLE_SNES, /* Natsume Championship Wrestling (USA) */ },
-  { 0x0005000010178700, CL_WUPS_TITLE_SNES, /* Natsume Championship Wrestling (EUR) */ },
-  { 0x0005000010178800, CL_WUPS_TITLE_SNES, /* ブレス オブ ファイア 竜の戦士 (Breath of Fire) (JPN) */ },
-  { 0x0005000010178900, CL_WUPS_TITLE_SNES, /* BREATH OF FIRE (USA) */ },
-  { 0x0005000010178A00, CL_WUPS_TITLE_SNES, /* BREATH OF FIRE (EUR) */ },
-  { 0x0005000010178B00, CL_WUPS_TITLE_SNES, /* デモンズブレイゾン 魔界村 紋章編 (Demon's Blazon) (JPN) */ },
-  { 0x0005000010178C00, CL_WUPS_TITLE_SNES, /* DEMON'S CREST (USA) */ },
-  { 0x0005000010178D00, CL_WUPS_TITLE_SNES, /* DEMON'S CREST (EUR) */ },
-  { 0x0005000010178E00, CL_WUPS_TITLE_WII_U, /* Mario vs. Donkey Kong Tipping Stars (EUR) */ },
-  { 0x0005000010178F00, CL_WUPS_TITLE_WII_U, /* Shovel Knight (EUR) */ },
-  { 0x0005000010179100, CL_WUPS_TITLE_WII_U, /* JUST DANCE® 2015 (USA) */ },
-  { 0x0005000010179200, CL_WUPS_TITLE_WII_U, /* マリオvs.ドンキーコング みんなでミニランド (Mario vs. Donkey Kong Tipping Stars) (JPN) */ },
-  { 0x0005000010179300, CL_WUPS_TITLE_WII_U, /* Internal Invasion (USA) */ },
-  { 0x0005000010179400, CL_WUPS_TITLE_WII_U, /* Ittle Dew (USA) */ },
-  { 0x0005000010179500, CL_WUPS_TITLE_WII_U, /* Plenty of Fishies (USA) */ },
-  { 0x0005000010179600, CL_WUPS_TITLE_WII_U, /* Shiny The Firefly (USA) */ },
-  { 0x0005000010179700, CL_WUPS_TITLE_WII_U, /* Guacamelee! Super Turbo Championship Edition (EUR) */ },
-  { 0x0005000010179900, CL_WUPS_TITLE_WII_U, /* Chariot (EUR) */ },
-  { 0x0005000010179A00, CL_WUPS_TITLE_NDS, /* 脳を鍛える大人のDSトレーニング (Brain Age: Train Your Brain In Minutes A Day) (JPN) */ },
-  { 0x0005000010179B00, CL_WUPS_TITLE_NDS, /* Brain Age: Train Your Brain in Minutes a Day (USA) */ },
-  { 0x0005000010179C00, CL_WUPS_TITLE_NDS, /* Dr Kawashima's Brain Training How Old Is Your Brain? (EUR) */ },
-  { 0x0005000010179D00, CL_WUPS_TITLE_NDS, /* キャッチ！タッチ！ヨッシー！ (Yoshi Touch & Go) (JPN) */ },
-  { 0x0005000010179E00, CL_WUPS_TITLE_NDS, /* Yoshi Touch & Go (USA) */ },
-  { 0x0005000010179F00, CL_WUPS_TITLE_NDS, /* Yoshi Touch & Go (EUR) */ },
-  { 0x000500001017A000, CL_WUPS_TITLE_GBA, /* NAMCO MUSEUM (USA) */ },
-  { 0x000500001017A100, CL_WUPS_TITLE_GBA, /* ナムコミュージアム (Namco Museum) (JPN) */ },
-  { 0x000500001017A200, CL_WUPS_TITLE_GBA, /* くるくるくるりん (Kuru Kuru Kururin) (JPN) */ },
-  { 0x000500001017A300, CL_WUPS_TITLE_GBA, /* MEGAMAN BATTLE CHIP CHALLENGE (EUR) */ },
-  { 0x000500001017A400, CL_WUPS_TITLE_GBA, /* ロックマンエグゼ バトルチップGP (Rockman.EXE Battle Chip GP) (JPN) */ },
-  { 0x000500001017A500, CL_WUPS_TITLE_GBA, /* ロックマン エグゼ (Rockman.EXE) (JPN) */ },
-  { 0x000500001017A700, CL_WUPS_TITLE_WII_U, /* BrickBlast U! (USA) */ },
-  { 0x000500001017A800, CL_WUPS_TITLE_WII_U, /* GAIABREAKER (USA) */ },
-  { 0x000500001017A900, CL_WUPS_TITLE_WII_U, /* SUPER ROBO MOUSE (USA) */ },
-  { 0x000500001017AB00, CL_WUPS_TITLE_WII_U, /* GAIABREAKER (EUR) */ },
-  { 0x000500001017AC00, CL_WUPS_TITLE_WII_U, /* Chariot (USA) */ },
-  { 0x000500001017AD00, CL_WUPS_TITLE_WII_U, /* Chubbins (USA) */ },
-  { 0x000500001017AE00, CL_WUPS_TITLE_WII_U, /* GEOM (USA) */ },
-  { 0x000500001017AF00, CL_WUPS_TITLE_WII_U, /* PING 1.5+ (USA) */ },
-  { 0x000500001017B000, CL_WUPS_TITLE_WII_U, /* Roving Rogue (USA) */ },
-  { 0x000500001017B100, CL_WUPS_TITLE_WII_U, /* Shuttle Rush (USA) */ },
-  { 0x000500001017B200, CL_WUPS_TITLE_WII_U, /* Turtle Tale (USA) */ },
-  { 0x000500001017B300, CL_WUPS_TITLE_WII_U, /* A World of Keflings (USA) */ },
-  { 0x000500001017B500, CL_WUPS_TITLE_WII_U, /* Art Academy Atelier (EUR) */ },
-  { 0x000500001017B600, CL_WUPS_TITLE_WII_U, /* ご当地鉄道 ～ご当地キャラと日本全国の旅～ (Gotouchi Tetsudou: Gotouchi Chara to Nihon Zenkoku no Tabi) (JPN) */ },
-  { 0x000500001017B700, CL_WUPS_TITLE_WII_U, /* クニットアンダーグラウンド (Knytt Underground) (JPN) */ },
-  { 0x000500001017B800, CL_WUPS_TITLE_WII_U, /* タッチバトル戦車SP (TouchBattleTankSP) (JPN) */ },
-  { 0x000500001017B900, CL_WUPS_TITLE_WII_U, /* アミーロ・ザ・アルマジロ (Armillo) (JPN) */ },
-  { 0x000500001017BA00, CL_WUPS_TITLE_GBA, /* NAMCO MUSEUM (EUR) */ },
-  { 0x000500001017BB00, CL_WUPS_TITLE_GBA, /* Kuru Kuru Kururin (EUR) */ },
-  { 0x000500001017BC00, CL_WUPS_TITLE_GBA, /* Kuru Kuru Kururin (USA) */ },
-  { 0x000500001017BE00, CL_WUPS_TITLE_WII_U, /* じっくり絵心教室 (Art Academy: Home Studio) (JPN) */ },
-  { 0x000500001017BF00, CL_WUPS_TITLE_WII_U, /* Art Academy: Home Studio (USA) */ },
-  { 0x000500001017C200, CL_WUPS_TITLE_WII_U, /* Baila Latino (EUR) */ },
-  { 0x000500001017C400, CL_WUPS_TITLE_WII_U, /* Baila Latino (USA) */ },
-  { 0x000500001017C600, CL_WUPS_TITLE_WII_U, /* Skylanders Trap Team (USA) */ },
-  { 0x000500001017C700, CL_WUPS_TITLE_WII_U, /* Swords & Soldiers (USA) */ },
-  { 0x000500001017C800, CL_WUPS_TITLE_WII_U, /* Swords & Soldiers (EUR) */ },
-  { 0x000500001017C900, CL_WUPS_TITLE_WII_U, /* EDGE (JPN) */ },
-  { 0x000500001017CA00, CL_WUPS_TITLE_WII_U, /* TOKI TORI 2+ 秘められた謎と不思議な島 (JPN) */ },
-  { 0x000500001017CB00, CL_WUPS_TITLE_WII_U, /* アートオブバランス (Art of Balance) (JPN) */ },
-  { 0x000500001017CD00, CL_WUPS_TITLE_WII_U, /* ゼルダ無双 (Hyrule Warriors) (JPN) */ },
-  { 0x000500001017CE00, CL_WUPS_TITLE_GBA, /* ファイアーエムブレム 聖魔の光石 (Fire Emblem: The Sacred Stones) (JPN) */ },
-  { 0x000500001017CF00, CL_WUPS_TITLE_GBA, /* Fire Emblem: The Sacred Stones (USA) */ },
-  { 0x000500001017D000, CL_WUPS_TITLE_GBA, /* Fire Emblem: The Sacred Stones (EUR) */ },
-  { 0x000500001017D100, CL_WUPS_TITLE_GBA, /* ぶらぶらドンキー (DK King of Swing) (JPN) */ },
-  { 0x000500001017D200, CL_WUPS_TITLE_GBA, /* Mario Kart: Super Circuit (EUR) */ },
-  { 0x000500001017D300, CL_WUPS_TITLE_GBA, /* Mario Kart: Super Circuit (USA) */ },
-  { 0x000500001017D500, CL_WUPS_TITLE_GBA, /* マリオカートアドバンス (Mario Kart Advance) (JPN) */ },
-  { 0x000500001017D600, CL_WUPS_TITLE_GBA, /* DK: King of Swing (USA) */ },
-  { 0x000500001017D700, CL_WUPS_TITLE_GBA, /* DK: King of Swing (EUR) */ },
-  { 0x000500001017D800, CL_WUPS_TITLE_WII_U, /* Hyrule Warriors (USA) */ },
-  { 0x000500001017D900, CL_WUPS_TITLE_WII_U, /* Hyrule Warriors (EUR) */ },
-  { 0x000500001017DA00, CL_WUPS_TITLE_WII_U, /* Costume Quest 2 (USA) */ },
-  { 0x000500001017DB00, CL_WUPS_TITLE_WII_U, /* Dolphin Up (USA) */ },
-  { 0x000500001017DC00, CL_WUPS_TITLE_WII_U, /* Frenchy Bird (USA) */ },
-  { 0x000500001017E000, CL_WUPS_TITLE_WII_U, /* Turtle Tale (EUR) */ },
-  { 0x000500001017E100, CL_WUPS_TITLE_WII_U, /* Ice Cream Surfer (EUR) */ },
-  { 0x000500001017E200, CL_WUPS_TITLE_WII_U, /* 3Souls (EUR) */ },
-  { 0x000500001017E300, CL_WUPS_TITLE_WII_U, /* Splatoon Global Testfire (EUR/JAP/USA) */ },
-  { 0x000500001017E400, CL_WUPS_TITLE_WII_U, /* Chasing Dead (USA) */ },
-  { 0x000500001017E500, CL_WUPS_TITLE_WII_U, /* PAC-MAN and the Ghostly Adventures 2 (EUR) */ },
-  { 0x000500001017E600, CL_WUPS_TITLE_WII_U, /* PAC-MAN and the Ghostly Adventures 2 (USA) */ },
-  { 0x000500001017E700, CL_WUPS_TITLE_WII_U, /* 3Souls (USA) */ },
-  { 0x000500001017EB00, CL_WUPS_TITLE_WII_U, /* SDK Paint (USA) */ },
-  { 0x000500001017EC00, CL_WUPS_TITLE_WII_U, /* Guac' a Mole (EUR) */ },
-  { 0x000500001017ED00, CL_WUPS_TITLE_WII_U, /* Flowerworks HD: Follie's Adventure (EUR) */ },
-  { 0x000500001017EE00, CL_WUPS_TITLE_NES, /* デビルワールド (Devil World) (JPN) */ },
-  { 0x000500001017EF00, CL_WUPS_TITLE_NES, /* Devil World (EUR) */ },
-  { 0x000500001017F000, CL_WUPS_TITLE_NES, /* ワイワイワールド2 SOS!!パセリ城 (Wai Wai World 2: SOS!! Parsley Jō) (JPN) */ },
-  { 0x000500001017F100, CL_WUPS_TITLE_NES, /* がんばれゴエモン外伝2 天下の財宝 (Ganbare Goemon Gaiden 2: Tenka no Zaihō) (JPN) */ },
-  { 0x000500001017F200, CL_WUPS_TITLE_NES, /* 闘いの挽歌 (Trojan) (JPN) */ },
-  { 0x000500001017F300, CL_WUPS_TITLE_NES, /* 妖怪道中記 (Yokai Dochuki) (JPN) */ },
-  { 0x000500001017F400, CL_WUPS_TITLE_NES, /* びっくり熱血新記録！ はるかなる金メダル (Crash 'n the Boys Street Challenge) (JPN) */ },
-  { 0x000500001017F500, CL_WUPS_TITLE_NES, /* Crash 'n the Boys Street Challenge (USA) */ },
-  { 0x000500001017F600, CL_WUPS_TITLE_NES, /* Crash 'n the Boys Street Challenge (EUR) */ },
-  { 0x000500001017F700, CL_WUPS_TITLE_NES, /* Shadow of the Ninja (USA) */ },
-  { 0x000500001017F800, CL_WUPS_TITLE_NES, /* Shadow of the Ninja (EUR) */ },
-  { 0x000500001017F900, CL_WUPS_TITLE_NES, /* S.C.A.T. (USA) */ },
-  { 0x000500001017FA00, CL_WUPS_TITLE_NES, /* S.C.A.T. (EUR) */ },
-  { 0x000500001017FB00, CL_WUPS_TITLE_SNES, /* スーパードンキーコング3 謎のクレミス島 (Donkey Kong Country 3 Dixie Kong's Double Trouble) (JPN) */ },
-  { 0x000500001017FC00, CL_WUPS_TITLE_SNES, /* Donkey Kong Country 3: Dixie Kong's Double Trouble (USA) */ },
-  { 0x000500001017FD00, CL_WUPS_TITLE_SNES, /* Donkey Kong Country 3: Dixie Kong's Double Trouble (EUR) */ },
-  { 0x000500001017FE00, CL_WUPS_TITLE_SNES, /* ヘラクレスの栄光Ⅳ 神々からの贈り物 (Herakles no Eikō 4: Kamigami no Okurimono) (JPN) */ },
-  { 0x000500001017FF00, CL_WUPS_TITLE_GBA, /* MEGA MAN BATTLE NETWORK (USA) */ },
-  { 0x0005000010180000, CL_WUPS_TITLE_GBA, /* MEGAMAN BATTLE NETWORK (EUR) */ },
-  { 0x0005000010180100, CL_WUPS_TITLE_GBA, /* MEGA MAN BATTLE CHIP CHALLENGE (USA) */ },
-  { 0x0005000010180200, CL_WUPS_TITLE_GBA, /* MEGAMAN ZERO (EUR) */ },
-  { 0x0005000010180300, CL_WUPS_TITLE_GBA, /* MEGA MAN ZERO (USA) */ },
-  { 0x0005000010180400, CL_WUPS_TITLE_GBA, /* ロックマン ゼロ (Rockman Zero) (JPN) */ },
-  { 0x0005000010180500, CL_WUPS_TITLE_WII_U, /* 進め!キノピオ隊長 (Captain Toad: Treasure Tracker) (JPN) */ },
-  { 0x0005000010180600, CL_WUPS_TITLE_WII_U, /* Captain Toad: Treasure Tracker (USA) */ },
-  { 0x0005000010180700, CL_WUPS_TITLE_WII_U, /* Captain Toad: Treasure Tracker (EUR) */ },
-  { 0x0005000010180B00, CL_WUPS_TITLE_WII_U, /* Citizens of Earth (EUR) */ },
-  { 0x0005000010180D00, CL_WUPS_TITLE_WII_U, /* Shiny The Firefly (EUR) */ },
-  { 0x0005000010180E00, CL_WUPS_TITLE_WII_U, /* Roving Rogue (EUR) */ },
-  { 0x0005000010181000, CL_WUPS_TITLE_GBA, /* マリオパーティアドバンス (Mario Party Advance) (JPN) */ },
-  { 0x0005000010181100, CL_WUPS_TITLE_GBA, /* Mario Party Advance (USA) */ },
-  { 0x0005000010181200, CL_WUPS_TITLE_GBA, /* Mario Party Advance (EUR) */ },
-  { 0x0005000010181400, CL_WUPS_TITLE_WII_U, /* Flight of Light (USA) */ },
-  { 0x0005000010181700, CL_WUPS_TITLE_WII_U, /* The Letter (USA) */ },
-  { 0x0005000010181B00, CL_WUPS_TITLE_WII_U, /* Zombie Brigade: No Brain No Gain (EUR) */ },
-  { 0x0005000010181C00, CL_WUPS_TITLE_WII_U, /* Zombie Brigade: No Brain No Gain (USA) */ },
-  { 0x0005000010181F00, CL_WUPS_TITLE_WII_U, /* Skylanders Trap Team (EUR) */ },
-  { 0x0005000010182300, CL_WUPS_TITLE_WII_U, /* パックワールド®２) PAC-MAN and the Ghostly Adventures 2 (JPN) */ },
-  { 0x0005000010182400, CL_WUPS_TITLE_WII_U, /* わいわい！みんなでシューティング クラフトアイランドからの脱出！ (Cocoto Magic Circus 2) (JPN) */ },
-  { 0x0005000010182600, CL_WUPS_TITLE_WII_U, /* Ice Cream Surfer (USA) */ },
-  { 0x0005000010182700, CL_WUPS_TITLE_WII_U, /* 99Seconds (EUR) */ },
-  { 0x0005000010182800, CL_WUPS_TITLE_WII_U, /* Frenchy Bird (EUR) */ },
-  { 0x0005000010182900, CL_WUPS_TITLE_GBA, /* F-ZERO ファルコン伝説 (JPN) */ },
-  { 0x0005000010182A00, CL_WUPS_TITLE_GBA, /* F-Zero - GP Legend (USA) */ },
-  { 0x0005000010182B00, CL_WUPS_TITLE_GBA, /* F-Zero: GP Legend (EUR) */ },
-  { 0x0005000010182C00, CL_WUPS_TITLE_WII_U, /* Jett Tailfin (EUR) */ },
-  { 0x0005000010182D00, CL_WUPS_TITLE_WII_U, /* Fat City (USA) */ },
-  { 0x0005000010182E00, CL_WUPS_TITLE_WII_U, /* GetClose (USA) */ },
-  { 0x0005000010182F00, CL_WUPS_TITLE_WII_U, /* Midtown Crazy Race (USA) */ },
-  { 0x0005000010183000, CL_WUPS_TITLE_WII_U, /* Runbow (USA) */ },
-  { 0x0005000010183100, CL_WUPS_TITLE_WII_U, /* Snake Den (USA) */ },
-  { 0x0005000010183300, CL_WUPS_TITLE_WII_U, /* The Voice (USA) */ },
-  { 0x0005000010183400, CL_WUPS_TITLE_WII_U, /* U Host (USA) */ },
-  { 0x0005000010183500, CL_WUPS_TITLE_GBA, /* ポケモンピンボール ルビー&サファイア (Pokémon Pinball Ruby & Sapphire) (JPN) */ },
-  { 0x0005000010183600, CL_WUPS_TITLE_GBA, /* Pokémon Pinball: Ruby & Sapphire (USA) */ },
-  { 0x0005000010183700, CL_WUPS_TITLE_GBA, /* Pokémon Pinball: Ruby & Sapphire (EUR) */ },
-  { 0x0005000010183900, CL_WUPS_TITLE_WII_U, /* 99Moves (USA) */ },
-  { 0x0005000010183A00, CL_WUPS_TITLE_WII_U, /* キャンペーン応募用ソフト (MARIOKART 8 Campaign Soft) (JPN) */ },
-  { 0x0005000010183C00, CL_WUPS_TITLE_WII_U, /* Infinity Runner (USA) */ },
-  { 0x0005000010183E00, CL_WUPS_TITLE_GBA, /* Castlevania 暁月の円舞曲 (Castlevania Aria of Sorrow) (JPN) */ },
-  { 0x0005000010183F00, CL_WUPS_TITLE_GBA, /* Castlevania Aria of Sorrow (USA) */ },
-  { 0x0005000010184000, CL_WUPS_TITLE_GBA, /* Castlevania  Aria of Sorrow (EUR) */ },
-  { 0x0005000010184200, CL_WUPS_TITLE_GBA, /* 風のクロノアG2 ドリームチャンプ･トーナメント (Klonoa 2 Dream Champ Tournament) (JPN) */ },
-  { 0x0005000010184300, CL_WUPS_TITLE_GBA, /* KLONOA 2 Dream Champ Tournament (USA) */ },
-  { 0x0005000010184400, CL_WUPS_TITLE_WII_U, /* Infinity Runner (EUR) */ },
-  { 0x0005000010184500, CL_WUPS_TITLE_WII_U, /* Frederic: Resurrection of Music (USA) */ },
-  { 0x0005000010184900, CL_WUPS_TITLE_WII_U, /* Slender: The Arrival (USA) */ },
-  { 0x0005000010184D00, CL_WUPS_TITLE_WII_U, /* Yoshi's Woolly World (USA) */ },
-  { 0x0005000010184E00, CL_WUPS_TITLE_WII_U, /* Yoshi's Woolly World (EUR) */ },
-  { 0x0005000010185000, CL_WUPS_TITLE_WII_U, /* ブタメダル (Buta Medal) (JPN) */ },
-  { 0x0005000010185100, CL_WUPS_TITLE_WII_U, /* Nintendo Land  ニンテンドーランド (Nintendo Land (Trial)) (JPN) */ },
-  { 0x0005000010185200, CL_WUPS_TITLE_WII_U, /* NewスーパーマリオブラザーズU 無料お試し版 (New SUPER MARIO BROS. U (Trial)) (JPN) */ },
-  { 0x0005000010185300, CL_WUPS_TITLE_WII_U, /* ピクミン３ 無料お試し版 (PIKMIN 3 (Trial)) (JPN) */ },
-  { 0x0005000010185400, CL_WUPS_TITLE_WII_U, /* ゼルダの伝説 風のタクト ＨＤ 無料お試し版 (THE LEGEND OF ZELDA The Wind Waker HD (Trial)) (JPN) */ },
-  { 0x0005000010185500, CL_WUPS_TITLE_WII_U, /* ゲーム＆ワリオ 無料お試し版 (Game & Wario (Trial)) (JPN) */ },
-  { 0x0005000010185600, CL_WUPS_TITLE_WII_U, /* The Wonderful 101 無料お試し版 (The Wonderful 101 (Trial)) (JPN) */ },
-  { 0x0005000010185900, CL_WUPS_TITLE_WII_U, /* GolT Stadium (EUR) */ },
-  { 0x0005000010185C00, CL_WUPS_TITLE_NES, /* スマッシュピンポン (Konami's Ping Pong) (JPN) */ },
-  { 0x0005000010185D00, CL_WUPS_TITLE_NES, /* ファミコンウォーズ (Famicom Wars) (JPN) */ },
-  { 0x0005000010185E00, CL_WUPS_TITLE_NES, /* ワルキューレの冒険 時の鍵伝説 (Valkyrie no Bōken: Toki no Kagi Densetsu) (JPN) */ },
-  { 0x0005000010185F00, CL_WUPS_TITLE_NES, /* スカイキッド (SkyKid) (JPN) */ },
-  { 0x0005000010186000, CL_WUPS_TITLE_NES, /* SkyKid (USA) */ },
-  { 0x0005000010186100, CL_WUPS_TITLE_NES, /* POOYAN プーヤン (JPN) */ },
-  { 0x0005000010186200, CL_WUPS_TITLE_NES, /* マッド・シティ (Mad City) (JPN) */ },
-  { 0x0005000010186300, CL_WUPS_TITLE_NES, /* THE ADVENTURES OF BAYOU BiLLY (USA) */ },
-  { 0x0005000010186400, CL_WUPS_TITLE_NES, /* THE ADVENTURES OF BAYOU BiLLY (EUR) */ },
-  { 0x0005000010186500, CL_WUPS_TITLE_SNES, /* AXELAY アクスレイ (JPN) */ },
-  { 0x0005000010186600, CL_WUPS_TITLE_SNES, /* AXELAY (USA) */ },
-  { 0x0005000010186700, CL_WUPS_TITLE_SNES, /* AXELAY (EUR) */ },
-  { 0x0005000010186800, CL_WUPS_TITLE_SNES, /* すーぱーぐっすんおよよ (Gussun Oyoyo) (JPN) */ },
-  { 0x0005000010186900, CL_WUPS_TITLE_SNES, /* ミリティア (Militia) (JPN) */ },
-  { 0x0005000010186A00, CL_WUPS_TITLE_SNES, /* Metal Marines (USA) */ },
-  { 0x0005000010186B00, CL_WUPS_TITLE_SNES, /* コズモギャング ザ パズル (Cosmo Gang the Puzzle) (JPN) */ },
-  { 0x0005000010186C00, CL_WUPS_TITLE_SNES, /* PAC-ATTACK (USA) */ },
-  { 0x0005000010186D00, CL_WUPS_TITLE_SNES, /* PAC-ATTACK (EUR) */ },
-  { 0x0005000010187000, CL_WUPS_TITLE_WII_U, /* Pier Solar and the Great Architects (EUR) */ },
-  { 0x0005000010187100, CL_WUPS_TITLE_WII_U, /* Underground (EUR) */ },
-  { 0x0005000010187200, CL_WUPS_TITLE_WII_U, /* Chests O' Booty (USA) */ },
-  { 0x0005000010187400, CL_WUPS_TITLE_WII_U, /* Gemology (USA) */ },
-  { 0x0005000010187700, CL_WUPS_TITLE_WII_U, /* Pad of Time (USA) */ },
-  { 0x0005000010187B00, CL_WUPS_TITLE_WII_U, /* Planes Fire & Rescue (USA) */ },
-  { 0x0005000010187F00, CL_WUPS_TITLE_GBA, /* ナポレオン (Napoleon) (JPN) */ },
-  { 0x0005000010188000, CL_WUPS_TITLE_GBA, /* ことばのパズル もじぴったんアドバンス (Kotoba no Puzzle Mojipittan Advance) (JPN) */ },
-  { 0x0005000010188100, CL_WUPS_TITLE_GBA, /* ロックマン エグゼ 2 (Battle Network Rockman EXE 2) (JPN) */ },
-  { 0x0005000010188200, CL_WUPS_TITLE_GBA, /* MEGA MAN BATTLE NETWORK 2 (USA) */ },
-  { 0x0005000010188300, CL_WUPS_TITLE_GBA, /* MEGAMAN BATTLE NETWORK 2 (EUR) */ },
-  { 0x0005000010188400, CL_WUPS_TITLE_GBA, /* ロックマン エグゼ 3 (Battle Network Rockman EXE 3) (JPN) */ },
-  { 0x0005000010188500, CL_WUPS_TITLE_GBA, /* MEGA MAN BATTLE NETWORK 3 WHITE (USA) */ },
-  { 0x0005000010188600, CL_WUPS_TITLE_GBA, /* MEGAMAN BATTLE NETWORK 3 WHITE (EUR) */ },
-  { 0x0005000010188700, CL_WUPS_TITLE_GBA, /* ロックマン エグゼ 3 BLACK (Battle Network Rockman EXE 3 Black) (JPN) */ },
-  { 0x0005000010188800, CL_WUPS_TITLE_GBA, /* MEGA MAN BATTLE NETWORK 3 BLUE (USA) */ },
-  { 0x0005000010188900, CL_WUPS_TITLE_GBA, /* MEGAMAN BATTLE NETWORK 3 BLUE (EUR) */ },
-  { 0x0005000010188B00, CL_WUPS_TITLE_WII_U, /* タッチ！カービィ スーパーレインボー (Kirby and the Rainbow Curse) (JPN) */ },
-  { 0x0005000010188C00, CL_WUPS_TITLE_WII_U, /* Disney Infinity [2.0] (EUR) */ },
-  { 0x0005000010188D00, CL_WUPS_TITLE_WII_U, /* Disney Infinity [2.0] (EUR) */ },
-  { 0x0005000010188E00, CL_WUPS_TITLE_WII_U, /* Soul Axiom (EUR) */ },
-  { 0x0005000010189100, CL_WUPS_TITLE_WII_U, /* Soul Axiom (USA) */ },
-  { 0x0005000010189200, CL_WUPS_TITLE_WII_U, /* Sportsball (USA) */ },
-  { 0x0005000010189300, CL_WUPS_TITLE_WII_U, /* The Fall (USA) */ },
-  { 0x0005000010189400, CL_WUPS_TITLE_WII_U, /* c (EUR/JAP/USA) */ },
-  { 0x0005000010189500, CL_WUPS_TITLE_WII_U, /* 戦車ＳＰ (Tank SP) (JPN) */ },
-  { 0x0005000010189A00, CL_WUPS_TITLE_WII_U, /* TEMPLE OF YOG (USA) */ },
-  { 0x0005000010189B00, CL_WUPS_TITLE_WII_U, /* Midtown Crazy Race (EUR) */ },
-  { 0x0005000010189C00, CL_WUPS_TITLE_WII_U, /* Trine Enchanted Edition (EUR) */ },
-  { 0x0005000010189D00, CL_WUPS_TITLE_SNES, /* ライブ・ア・ライブ (Live A Live) (JPN) */ },
-  { 0x0005000010189E00, CL_WUPS_TITLE_WII_U, /* Trine Enchanted Edition (USA) */ },
-  { 0x0005000010189F00, CL_WUPS_TITLE_WII_U, /* Shadow Puppeteer (USA) */ },
-  { 0x000500001018A100, CL_WUPS_TITLE_WII_U, /* Teslagrad (USA) */ },
-  { 0x000500001018A200, CL_WUPS_TITLE_WII_U, /* Darts Up (EUR) */ },
-  { 0x000500001018A400, CL_WUPS_TITLE_WII_U, /* POKER DICE SOLITAIRE FUTURE (USA) */ },
-  { 0x000500001018A700, CL_WUPS_TITLE_WII_U, /* Dinox (EUR) */ },
-  { 0x000500001018A800, CL_WUPS_TITLE_WII_U, /* SMART Adventures Mission Math (EUR) */ },
-  { 0x000500001018A900, CL_WUPS_TITLE_WII_U, /* Thomas Was Alone (EUR) */ },
-  { 0x000500001018AB00, CL_WUPS_TITLE_WII_U, /* Affordable Space Adventures (USA) */ },
-  { 0x000500001018AC00, CL_WUPS_TITLE_WII_U, /* ボールポイントユニバース インフィニット (Ballpoint Universe) (JPN) */ },
-  { 0x000500001018AF00, CL_WUPS_TITLE_WII_U, /* Teslapunk (USA) */ },
-  { 0x000500001018B000, CL_WUPS_TITLE_WII_U, /* Thomas Was Alone (USA) */ },
-  { 0x000500001018B100, CL_WUPS_TITLE_NES, /* 月風魔伝 (Getsu Fūma Den) (JPN) */ },
-  { 0x000500001018B200, CL_WUPS_TITLE_NES, /* ＥＳＰＥＲ　ＤＲＥＡＭ エスパードリーム (JPN) */ },
-  { 0x000500001018B300, CL_WUPS_TITLE_NES, /* がんばれゴエモン２ (Ganbare Goemon 2: Kiteretsu Shōgun Magginesu) (JPN) */ },
-  { 0x000500001018B400, CL_WUPS_TITLE_NES, /* もえろツインビー シナモン博士を救え！ (Stinger) (JPN) */ },
-  { 0x000500001018B500, CL_WUPS_TITLE_NES, /* STINGER (USA) */ },
-  { 0x000500001018B600, CL_WUPS_TITLE_NES, /* すごろクエスト ダイスの戦士たち (Sugoro Quest: The Quest of Dice Heroes) (JPN) */ },
-  { 0x000500001018B700, CL_WUPS_TITLE_NES, /* セクロス (Seicross) (JPN) */ },
-  { 0x000500001018B800, CL_WUPS_TITLE_NES, /* マッピーランド (Mappy-Land) (JPN) */ },
-  { 0x000500001018B900, CL_WUPS_TITLE_NES, /* MAPPY-LAND (USA) */ },
-  { 0x000500001018BA00, CL_WUPS_TITLE_NES, /* MAPPY-LAND (EUR) */ },
-  { 0x000500001018BB00, CL_WUPS_TITLE_NES, /* アトランチスの謎 (Atlantos no Nazo) (JPN) */ },
-  { 0x000500001018BC00, CL_WUPS_TITLE_NES, /* 超惑星戦記 メタファイト (Blaster Master) (JPN) */ },
-  { 0x000500001018BD00, CL_WUPS_TITLE_NES, /* BLASTER MASTER (USA) */ },
-  { 0x000500001018BE00, CL_WUPS_TITLE_NES, /* BLASTER MASTER (EUR) */ },
-  { 0x000500001018BF00, CL_WUPS_TITLE_SNES, /* アルバートオデッセイ (Albert Odyssey) (JPN) */ },
-  { 0x000500001018C400, CL_WUPS_TITLE_WII_U, /* 藤子・F・不二雄キャラクターズ 大集合！SFドタバタパーティー！！ ((Fujiko F. Fujio Characters Daishuugou! SF Dotabata Party!!)) (JPN) */ },
-  { 0x000500001018C500, CL_WUPS_TITLE_WII_U, /* ロデア・ザ・スカイソルジャー (RODEA THE SKYSOLDIER) (JPN) */ },
-  { 0x000500001018C600, CL_WUPS_TITLE_WII_U, /* The Swapper (EUR) */ },
-  { 0x000500001018C700, CL_WUPS_TITLE_WII_U, /* The Swapper (JPN) */ },
-  { 0x000500001018C800, CL_WUPS_TITLE_WII_U, /* スティックイットトゥザマン！ (Stick It to The Man!) (JPN) */ },
-  { 0x000500001018CB00, CL_WUPS_TITLE_WII_U, /* Lone Survivor The Director's Cut (EUR) */ },
-  { 0x000500001018CC00, CL_WUPS_TITLE_WII_U, /* Planes Fire & Rescue (EUR) */ },
-  { 0x000500001018CD00, CL_WUPS_TITLE_WII_U, /* Cake Ninja 3: The Legend Continues (EUR) */ },
-  { 0x000500001018CF00, CL_WUPS_TITLE_WII_U, /* Adventures of Pip By Tic Toc Games (USA) */ },
-  { 0x000500001018D000, CL_WUPS_TITLE_WII_U, /* IQ Test (USA) */ },
-  { 0x000500001018D100, CL_WUPS_TITLE_WII_U, /* Lone Survivor The Director's Cut (USA) */ },
-  { 0x000500001018D300, CL_WUPS_TITLE_WII_U, /* The Swapper (USA) */ },
-  { 0x000500001018D400, CL_WUPS_TITLE_WII_U, /* CAKE NINJA 3: THE LEGEND CONTINUES (USA) */ },
-  { 0x000500001018D700, CL_WUPS_TITLE_WII_U, /* SHUT THE BOX (USA) */ },
-  { 0x000500001018D800, CL_WUPS_TITLE_WII_U, /* SteamWorld Dig (EUR) */ },
-  { 0x000500001018D900, CL_WUPS_TITLE_WII_U, /* LOST REAVERS (JPN) */ },
-  { 0x000500001018DB00, CL_WUPS_TITLE_WII_U, /* Super Mario Maker (スーパーマリオメーカー) (JPN) */ },
-  { 0x000500001018DC00, CL_WUPS_TITLE_WII_U, /* Super Mario Maker (USA) */ },
-  { 0x000500001018DD00, CL_WUPS_TITLE_WII_U, /* Super Mario Maker (EUR) */ },
-  { 0x000500001018DE00, CL_WUPS_TITLE_WII_U, /* Tetrobot & Co. (EUR) */ },
-  { 0x000500001018E000, CL_WUPS_TITLE_WII_U, /* ズンバ フィットネス ワールドパーティ (Zumba Ftiness World Party) (JPN) */ },
-  { 0x000500001018E300, CL_WUPS_TITLE_SNES, /* 超魔界村 R (Super Ghouls 'N Ghosts) (JPN) */ },
-  { 0x000500001018E400, CL_WUPS_TITLE_SNES, /* Super Ghouls'N Ghosts (USA) */ },
-  { 0x000500001018E500, CL_WUPS_TITLE_SNES, /* Super Ghouls 'N Ghosts (EUR) */ },
-  { 0x000500001018E600, CL_WUPS_TITLE_GBA, /* ロックマン＆フォルテ (Rockman & Forte) (JPN) */ },
-  { 0x000500001018E700, CL_WUPS_TITLE_GBA, /* MEGA MAN & BASS (USA) */ },
-  { 0x000500001018E800, CL_WUPS_TITLE_GBA, /* MEGAMAN & BASS (EUR) */ },
-  { 0x000500001018E900, CL_WUPS_TITLE_GBA, /* ロックマン ゼロ 2 (Rockman Zero 2) (JPN) */ },
-  { 0x000500001018EA00, CL_WUPS_TITLE_GBA, /* MEGA MAN ZERO 2 (USA) */ },
-  { 0x000500001018EB00, CL_WUPS_TITLE_GBA, /* MEGAMAN ZERO 2 (EUR) */ },
-  { 0x000500001018EC00, CL_WUPS_TITLE_WII_U, /* Soon Shine (USA) */ },
-  { 0x000500001018ED00, CL_WUPS_TITLE_WII_U, /* Tetrobot & Co. (USA) */ },
-  { 0x000500001018EE00, CL_WUPS_TITLE_WII_U, /* Don't Touch Anything Red (USA) */ },
-  { 0x000500001018F100, CL_WUPS_TITLE_WII_U, /* SteamWorld Dig (USA) */ },
-  { 0x000500001018F300, CL_WUPS_TITLE_WII_U, /* Xavier (USA) */ },
-  { 0x000500001018F400, CL_WUPS_TITLE_WII_U, /* Angry Video Game Nerd Adventures (USA) */ },
-  { 0x000500001018F500, CL_WUPS_TITLE_WII_U, /* Dinox (USA) */ },
-  { 0x000500001018F600, CL_WUPS_TITLE_WII_U, /* Jumpy Cat (USA) */ },
-  { 0x000500001018F800, CL_WUPS_TITLE_WII_U, /* SMART Adventures Mission Math (USA) */ },
-  { 0x000500001018F900, CL_WUPS_TITLE_WII_U, /* TOSS N GO (USA) */ },
-  { 0x000500001018FB00, CL_WUPS_TITLE_WII_U, /* ALPHADIA GENESIS (USA) */ },
-  { 0x000500001018FD00, CL_WUPS_TITLE_WII_U, /* Penguins of Madagascar (USA) */ },
-  { 0x000500001018FE00, CL_WUPS_TITLE_WII_U, /* Sense by Play.me (EUR) */ },
-  { 0x000500001018FF00, CL_WUPS_TITLE_GBA, /* Harvest Moon: More Friends of Mineral Town (USA) */ },
-  { 0x0005000010190000, CL_WUPS_TITLE_GBA, /* Harvest Moon: Friends of Mineral Town (USA) */ },
-  { 0x0005000010190100, CL_WUPS_TITLE_WII_U, /* どうぶつの森 amiiboフェスティバル (Animal Crossing: amiibo Festival) (JPN) */ },
-  { 0x0005000010190300, CL_WUPS_TITLE_WII_U, /* マリオ＆ソニック ＡＴ リオオリンピック (Mario & Sonic at the Rio 2016 Olympic Games) (JPN) */ },
-  { 0x0005000010190400, CL_WUPS_TITLE_WII_U, /* Red Riding Hood (USA) */ },
-  { 0x0005000010190700, CL_WUPS_TITLE_NES, /* バイオミラクル ぼくってウパ (Bio Miracle Bokutte Upa) (JPN) */ },
-  { 0x0005000010190800, CL_WUPS_TITLE_NES, /* チャンピオンシップ・ロードランナー (Championship Lode Runner) (JPN) */ },
-  { 0x0005000010190900, CL_WUPS_TITLE_NES, /* かんしゃく玉なげカン太郎の 東海道五十三次 (Tōkaidō Gojūsan‑tsugi) (JPN) */ },
-  { 0x0005000010190A00, CL_WUPS_TITLE_NES, /* ワギャンランド2 (Wagyan Land 2) (JPN) */ },
-  { 0x0005000010190B00, CL_WUPS_TITLE_NES, /* メトロクロス (Metro-Cross) (JPN) */ },
-  { 0x0005000010190C00, CL_WUPS_TITLE_SNES, /* スーパー蒼き狼と白き牝鹿 元朝秘史 (Genghis Khan II: Clan of the Gray Wolf) (JPN) */ },
-  { 0x0005000010190E00, CL_WUPS_TITLE_SNES, /* Genghis Khan II:  Clan of the Grey Wolf (USA) */ },
-  { 0x0005000010190F00, CL_WUPS_TITLE_SNES, /* 太閤立志伝 (Taikou Risshiden) (JPN) */ },
-  { 0x0005000010191000, CL_WUPS_TITLE_SNES, /* 魔神転生 (Majin Tensei) (JPN) */ },
-  { 0x0005000010191100, CL_WUPS_TITLE_SNES, /* SUPER E.D.F. EARTH DEFENSE FORCE (JPN) */ },
-  { 0x0005000010191200, CL_WUPS_TITLE_SNES, /* SUPER E.D.F. Earth Defense Force (USA) */ },
-  { 0x0005000010191300, CL_WUPS_TITLE_SNES, /* ラッシング･ビート (Rushing Beat) (JPN) */ },
-  { 0x0005000010191400, CL_WUPS_TITLE_SNES, /* Rival Turf (USA) */ },
-  { 0x0005000010191700, CL_WUPS_TITLE_WII_U, /* 99Moves (EUR) */ },
-  { 0x0005000010191800, CL_WUPS_TITLE_WII_U, /* Rock 'N Racing Off Road (EUR) */ },
-  { 0x0005000010191F00, CL_WUPS_TITLE_WII_U, /* ソニックトゥーン 太古の秘宝 (Sonic Toon Ancients' Secret Treasure) (JPN) */ },
-  { 0x0005000010192000, CL_WUPS_TITLE_WII_U, /* 太鼓の達人 特盛り！ (Taiko no Tatsujin Tokumori!) (JPN) */ },
-  { 0x0005000010192100, CL_WUPS_TITLE_WII_U, /* LEGO®ムービー ザ・ゲーム (The LEGO® Movie Videogame) (JPN) */ },
-  { 0x0005000010192200, CL_WUPS_TITLE_WII_U, /* 仮面ライダー　サモンライド！ (KAMEN RIDER SUMMON RIDE!) (JPN) */ },
-  { 0x0005000010192400, CL_WUPS_TITLE_NES, /* ダックハント (Duck Hunt) (JPN) */ },
-  { 0x0005000010192500, CL_WUPS_TITLE_NES, /* Duck Hunt (USA) */ },
-  { 0x0005000010192600, CL_WUPS_TITLE_NES, /* Duck Hunt (EUR) */ },
-  { 0x0005000010192700, CL_WUPS_TITLE_GBA, /* ロックマン エグゼ 4 トーナメント ブルームーン (Rockman EXE 4 Blue Moon) (JPN) */ },
-  { 0x0005000010192800, CL_WUPS_TITLE_GBA, /* MEGA MAN BATTLE NETWORK 4 BLUE MOON (USA) */ },
-  { 0x0005000010192900, CL_WUPS_TITLE_GBA, /* MEGAMAN BATTLE NETWORK 4 BLUE MOON (EUR) */ },
-  { 0x0005000010192A00, CL_WUPS_TITLE_GBA, /* ロックマン エグゼ 4 トーナメント レッドサン (Rockman EXE 4 Red Sun) (JPN) */ },
-  { 0x0005000010192B00, CL_WUPS_TITLE_GBA, /* MEGA MAN BATTLE NETWORK 4 RED SUN (USA) */ },
-  { 0x0005000010192C00, CL_WUPS_TITLE_GBA, /* MEGAMAN BATTLE NETWORK 4 RED SUN (EUR) */ },
-  { 0x0005000010192D00, CL_WUPS_TITLE_GBA, /* ロックマン ゼロ 3 (Rockman Zero 3) (JPN) */ },
-  { 0x0005000010192E00, CL_WUPS_TITLE_GBA, /* MEGA MAN ZERO 3 (USA) */ },
-  { 0x0005000010192F00, CL_WUPS_TITLE_GBA, /* MEGAMAN ZERO 3 (EUR) */ },
-  { 0x0005000010193100, CL_WUPS_TITLE_SNES, /* FINAL FIGHT ONE (USA) */ },
-  { 0x0005000010193200, CL_WUPS_TITLE_SNES, /* Final Fight ONE (EUR) */ },
-  { 0x0005000010193300, CL_WUPS_TITLE_WII_U, /* Legend of Kay Anniversary (EUR) */ },
-  { 0x0005000010193400, CL_WUPS_TITLE_WII_U, /* Legend of Kay Anniversary (USA) */ },
-  { 0x0005000010193900, CL_WUPS_TITLE_WII_U, /* Flapp & Zegeta (USA) */ },
-  { 0x0005000010193D00, CL_WUPS_TITLE_WII_U, /* Tiny Galaxy (USA) */ },
-  { 0x0005000010193E00, CL_WUPS_TITLE_WII_U, /* Twisted Fusion (USA) */ },
-  { 0x0005000010193F00, CL_WUPS_TITLE_WII_U, /* Penguins of Madagascar (EUR) */ },
-  { 0x0005000010194000, CL_WUPS_TITLE_WII_U, /* Meme Run (USA) */ },
-  { 0x0005000010194200, CL_WUPS_TITLE_WII_U, /* LEGO® Dimensions™ (USA) */ },
-  { 0x0005000010194600, CL_WUPS_TITLE_SNES, /* ファイナルファイト ONE (Final Fight ONE) (JPN) */ },
-  { 0x0005000010194800, CL_WUPS_TITLE_MSX, /* ツインビー (TwinBee) (JPN) */ },
-  { 0x0005000010194900, CL_WUPS_TITLE_MSX, /* けっきょく南極大冒険 (Antarctic Adventure) (JPN) */ },
-  { 0x0005000010194A00, CL_WUPS_TITLE_MSX, /* 悪魔城ドラキュラ (Castlevania) (JPN) */ },
-  { 0x0005000010194B00, CL_WUPS_TITLE_MSX, /* イー・アル・カンフー (Yie Ar KUNG-FU) (JPN) */ },
-  { 0x0005000010194C00, CL_WUPS_TITLE_MSX, /* コナミのサッカー (Konami's Soccer) (JPN) */ },
-  { 0x0005000010194E00, CL_WUPS_TITLE_MSX, /* スカイジャガー (SKYJAGUAR) (JPN) */ },
-  { 0x0005000010194F00, CL_WUPS_TITLE_MSX, /* マジカル ツリー (Magical Tree) (JPN) */ },
-  { 0x0005000010195000, CL_WUPS_TITLE_MSX, /* ハイパースポーツ2 (HYPER SPORTS 2) (JPN) */ },
-  { 0x0005000010195200, CL_WUPS_TITLE_MSX, /* ウシャス (USAS) (JPN) */ },
-  { 0x0005000010195300, CL_WUPS_TITLE_MSX, /* グラディウス (GRADIUS) (JPN) */ },
-  { 0x0005000010195400, CL_WUPS_TITLE_MSX, /* がんばれゴエモン！ からくり道中 (Goemon) (JPN) */ },
-  { 0x0005000010195500, CL_WUPS_TITLE_MSX, /* サーカスチャーリー (CIRCUS CHARLIE) (JPN) */ },
-  { 0x0005000010195600, CL_WUPS_TITLE_NDS, /* マリオカートDS (Mario Kart DS) (JPN) */ },
-  { 0x0005000010195700, CL_WUPS_TITLE_NDS, /* Mario Kart DS (USA) */ },
-  { 0x0005000010195800, CL_WUPS_TITLE_NDS, /* MARIO KART DS (EUR) */ },
-  { 0x0005000010195900, CL_WUPS_TITLE_NDS, /* New スーパーマリオブラザーズ (New Super Mario Bros.) (JPN) */ },
-  { 0x0005000010195A00, CL_WUPS_TITLE_NDS, /* New Super Mario Bros. (USA) */ },
-  { 0x0005000010195B00, CL_WUPS_TITLE_NDS, /* NEW SUPER MARIO BROS. (EUR) */ },
-  { 0x0005000010195C00, CL_WUPS_TITLE_WII_U, /* Cosmophony (EUR) */ },
-  { 0x0005000010195D00, CL_WUPS_TITLE_WII_U, /* LEGO® DIMENSIONS™ (EUR) */ },
-  { 0x0005000010195E00, CL_WUPS_TITLE_WII_U, /* Rock Zombie (USA) */ },
-  { 0x0005000010195F00, CL_WUPS_TITLE_WII_U, /* Arrow Time U (USA) */ },
-  { 0x0005000010196000, CL_WUPS_TITLE_WII_U, /* Ninja Pizza Girl (USA) */ },
-  { 0x0005000010196200, CL_WUPS_TITLE_WII_U, /* Pad of Time (EUR) */ },
-  { 0x0005000010196400, CL_WUPS_TITLE_NES, /* スターラスター (Star Luster) (JPN) */ },
-  { 0x0005000010196500, CL_WUPS_TITLE_NES, /* がんばれゴエモン外伝  きえた黄金キセル (Ganbare Goemon Gaiden: Kieta Ōgon Kiseru) (JPN) */ },
-  { 0x0005000010196600, CL_WUPS_TITLE_NES, /* フィールドコンバット (Field Combat) (JPN) */ },
-  { 0x0005000010196700, CL_WUPS_TITLE_SNES, /* 晦－つきこもり (Kai: Tsukikomori) (JPN) */ },
-  { 0x0005000010196800, CL_WUPS_TITLE_SNES, /* ファイヤー･ファイティング (The Ignition Factor) (JPN) */ },
-  { 0x0005000010196900, CL_WUPS_TITLE_SNES, /* THE IGNITION FACTOR (USA) */ },
-  { 0x0005000010196A00, CL_WUPS_TITLE_SNES, /* 豪血寺一族 (Power Instinct) (JPN) */ },
-  { 0x0005000010196B00, CL_WUPS_TITLE_WII_U, /* Flight of Light (EUR) */ },
-  { 0x0005000010197000, CL_WUPS_TITLE_GBA, /* 逆転裁判 (Ace Attorney) (JPN) */ },
-  { 0x0005000010197100, CL_WUPS_TITLE_GBA, /* ミスタードリラーエース ふしぎなパクテリア (Mr. Driller Ace: Fushigi na Pacteria) (JPN) */ },
-  { 0x0005000010197200, CL_WUPS_TITLE_WII_U, /* Cosmophony (USA) */ },
-  { 0x0005000010197300, CL_WUPS_TITLE_WII_U, /* Electronic Super Joy: Groove City (USA) */ },
-  { 0x0005000010197700, CL_WUPS_TITLE_WII_U, /* イトル・デューの伝説 失われた島と謎の城 (Ittle Dew) (JPN) */ },
-  { 0x0005000010197800, CL_WUPS_TITLE_WII_U, /* Costume Quest 2 (EUR) */ },
-  { 0x0005000010197D00, CL_WUPS_TITLE_WII_U, /* Devil's Third (JPN) */ },
-  { 0x0005000010197E00, CL_WUPS_TITLE_GBA, /* Medabots Rokusho (EUR) */ },
-  { 0x0005000010197F00, CL_WUPS_TITLE_GBA, /* Medabots: Rokusho (USA) */ },
-  { 0x0005000010198000, CL_WUPS_TITLE_GBA, /* メダロット弐CORE クワガタVer. (Medabots: Rokusho) (JPN) */ },
-  { 0x0005000010198100, CL_WUPS_TITLE_GBA, /* Medabots: Metabee (EUR) */ },
-  { 0x0005000010198200, CL_WUPS_TITLE_GBA, /* Medabots: Metabee (USA) */ },
-  { 0x0005000010198300, CL_WUPS_TITLE_GBA, /* メダロット弐CORE カブトVer. (Medabots: Metabee) (JPN) */ },
-  { 0x0005000010198400, CL_WUPS_TITLE_GBA, /* ファミリーテニスアドバンス (Family Tennis Advance) (JPN) */ },
-  { 0x0005000010198600, CL_WUPS_TITLE_GBA, /* ソニック アドバンス (Sonic Advance) (JPN) */ },
-  { 0x0005000010198700, CL_WUPS_TITLE_WII_U, /* Watchup (USA) */ },
-  { 0x0005000010198800, CL_WUPS_TITLE_NDS, /* ヨッシーアイランドDS (Yoshi's Island DS) (JPN) */ },
-  { 0x0005000010198900, CL_WUPS_TITLE_NDS, /* Yoshi’s Island DS (USA) */ },
-  { 0x0005000010198A00, CL_WUPS_TITLE_NDS, /* YOSHI’S ISLAND DS (EUR) */ },
-  { 0x0005000010198B00, CL_WUPS_TITLE_NDS, /* やわらかあたま塾 (Big Brain Academy) (JPN) */ },
-  { 0x0005000010198C00, CL_WUPS_TITLE_NDS, /* Big Brain Academy (USA) */ },
-  { 0x0005000010198D00, CL_WUPS_TITLE_NDS, /* Big Brain Academy (EUR) */ },
-  { 0x0005000010198F00, CL_WUPS_TITLE_WII_U, /* Terraria (EUR) */ },
-  { 0x0005000010199000, CL_WUPS_TITLE_WII_U, /* マリオテニス　ウルトラスマッシュ (Mario Tennis: Ultra Smash) (JPN) */ },
-  { 0x0005000010199100, CL_WUPS_TITLE_N64, /* ドンキーコング64 (Donkey Kong 64) (JPN) */ },
-  { 0x0005000010199200, CL_WUPS_TITLE_N64, /* Donkey Kong 64 (USA) */ },
-  { 0x0005000010199300, CL_WUPS_TITLE_N64, /* Donkey Kong 64 (EUR) */ },
-  { 0x0005000010199400, CL_WUPS_TITLE_N64, /* スーパーマリオ64 (Super Mario 64) (JPN) */ },
-  { 0x0005000010199500, CL_WUPS_TITLE_N64, /* Super Mario 64 (EUR/USA) */ },
-  { 0x0005000010199600, CL_WUPS_TITLE_N64, /* マリオストーリー (Mario Story) (JPN) */ },
-  { 0x0005000010199700, CL_WUPS_TITLE_N64, /* Paper Mario (USA) */ },
-  { 0x0005000010199800, CL_WUPS_TITLE_N64, /* Paper Mario (EUR) */ },
-  { 0x0005000010199A00, CL_WUPS_TITLE_N64, /* ゼルダの伝説 時のオカリナ (The Legend of Zelda: Ocarina of Time) (JPN) */ },
-  { 0x0005000010199B00, CL_WUPS_TITLE_N64, /* The Legend of Zelda: Ocarina of Time (USA) */ },
-  { 0x0005000010199C00, CL_WUPS_TITLE_N64, /* The Legend of Zelda: Ocarina of Time (EUR) */ },
-  { 0x0005000010199E00, CL_WUPS_TITLE_WII_U, /* High Strangeness (USA) */ },
-  { 0x0005000010199F00, CL_WUPS_TITLE_WII_U, /* Maze (USA) */ },
-  { 0x000500001019A100, CL_WUPS_TITLE_WII_U, /* Shapes of Gray (USA) */ },
-  { 0x000500001019A300, CL_WUPS_TITLE_WII_U, /* SPIKEY WALLS (USA) */ },
-  { 0x000500001019A600, CL_WUPS_TITLE_WII_U, /* BADLAND Game of the Year Edition (USA) */ },
-  { 0x000500001019A700, CL_WUPS_TITLE_WII_U, /* BLOK DROP X TWISTED FUSION (USA) */ },
-  { 0x000500001019A800, CL_WUPS_TITLE_WII_U, /* Citadale The Legends Trilogy (USA) */ },
-  { 0x000500001019AB00, CL_WUPS_TITLE_WII_U, /* High Strangeness (EUR) */ },
-  { 0x000500001019AD00, CL_WUPS_TITLE_WII_U, /* Elliot Quest (USA) */ },
-  { 0x000500001019AE00, CL_WUPS_TITLE_WII_U, /* Family Tennis SP (USA) */ },
-  { 0x000500001019B000, CL_WUPS_TITLE_WII_U, /* Tachyon Project (USA) */ },
-  { 0x000500001019B200, CL_WUPS_TITLE_WII_U, /* Tachyon Project (EUR) */ },
-  { 0x000500001019B900, CL_WUPS_TITLE_WII_U, /* SUPER ROBO MOUSE (EUR) */ },
-  { 0x000500001019BA00, CL_WUPS_TITLE_WII_U, /* BLOK DROP X TWISTED FUSION (EUR) */ },
-  { 0x000500001019BC00, CL_WUPS_TITLE_GBA, /* SUPER STREET FIGHTER Ⅱ TURBO REVIVAL (EUR) */ },
-  { 0x000500001019BD00, CL_WUPS_TITLE_GBA, /* SUPER STREET FIGHTER Ⅱ TURBO REVIVAL (USA) */ },
-  { 0x000500001019BE00, CL_WUPS_TITLE_GBA, /* Super Street FighterⅡ X Revival (JPN) */ },
-  { 0x000500001019C100, CL_WUPS_TITLE_WII_U, /* Spy Chameleon (USA) */ },
-  { 0x000500001019C300, CL_WUPS_TITLE_WII_U, /* Terraria (USA) */ },
-  { 0x000500001019C800, CL_WUPS_TITLE_WII_U, /* ゼルダの伝説 トワイライトプリンセス HD (THE LEGEND OF ZELDA Twilight Princess HD) (JPN) */ },
-  { 0x000500001019C900, CL_WUPS_TITLE_WII_U, /* Alphadia Genesis (EUR) */ },
-  { 0x000500001019CA00, CL_WUPS_TITLE_WII_U, /* Rock Zombie (EUR) */ },
-  { 0x000500001019CB00, CL_WUPS_TITLE_WII, /* スーパーマリオギャラクシー２ (SUPER MARIO GALAXY 2) (JPN) */ },
-  { 0x000500001019CC00, CL_WUPS_TITLE_WII, /* Super Mario Galaxy 2 (USA) */ },
-  { 0x000500001019CD00, CL_WUPS_TITLE_WII, /* SUPER MARIO GALAXY 2 (EUR) */ },
-  { 0x000500001019CE00, CL_WUPS_TITLE_WII, /* ドンキーコング リターンズ (Donkey Kong Country Returns) (JPN) */ },
-  { 0x000500001019CF00, CL_WUPS_TITLE_WII, /* Donkey Kong Country Returns (USA) */ },
-  { 0x000500001019D000, CL_WUPS_TITLE_WII, /* Donkey Kong Country Returns (EUR) */ },
-  { 0x000500001019D100, CL_WUPS_TITLE_NES, /* パンチアウト！！ (Punch-Out!!) (JPN) */ },
-  { 0x000500001019D200, CL_WUPS_TITLE_NES, /* Punch-Out!! (USA) */ },
-  { 0x000500001019D300, CL_WUPS_TITLE_NES, /* Punch-Out!! (EUR) */ },
-  { 0x000500001019D400, CL_WUPS_TITLE_WII, /* 星のカービィ Wii (Kirby's Return to Dream Land) (JPN) */ },
-  { 0x000500001019D500, CL_WUPS_TITLE_WII, /* Kirby's Return to Dream Land (USA) */ },
-  { 0x000500001019D600, CL_WUPS_TITLE_WII, /* Kirby's Adventure Wii (EUR) */ },
-  { 0x000500001019D700, CL_WUPS_TITLE_WII, /* ゼノブレイド (Xenoblade Chronicles) (JPN) */ },
-  { 0x000500001019D800, CL_WUPS_TITLE_WII, /* Xenoblade Chronicles (USA) */ },
-  { 0x000500001019D900, CL_WUPS_TITLE_WII, /* Xenoblade Chronicles (EUR) */ },
-  { 0x000500001019DA00, CL_WUPS_TITLE_WII, /* New Super Mario Bros. Wii (JPN) */ },
-  { 0x000500001019DC00, CL_WUPS_TITLE_WII, /* New SUPER MARIO BROS. Wii (EUR) */ },
-  { 0x000500001019DD00, CL_WUPS_TITLE_WII, /* Metroid Prime: Trilogy (USA) */ },
-  { 0x000500001019DE00, CL_WUPS_TITLE_WII, /* Metroid Prime: Trilogy (EUR) */ },
-  { 0x000500001019DF00, CL_WUPS_TITLE_WII, /* METROID Other M (JPN) */ },
-  { 0x000500001019E000, CL_WUPS_TITLE_WII, /* Metroid: Other M (USA) */ },
-  { 0x000500001019E100, CL_WUPS_TITLE_WII, /* METROID Other M (EUR) */ },
-  { 0x000500001019E200, CL_WUPS_TITLE_WII, /* ポケパークWii ～ピカチュウの大冒険～ (PokéPark Wii Pikachu's Adventure) (JPN) */ },
-  { 0x000500001019E300, CL_WUPS_TITLE_WII, /* PokéPark Wii: Pikachu's Adventure (USA) */ },
-  { 0x000500001019E400, CL_WUPS_TITLE_WII, /* PokéPark Wii Pikachu's Adventure (EUR) */ },
-  { 0x000500001019E500, CL_WUPS_TITLE_WII_U, /* THE LEGEND OF ZELDA Twilight Princess HD (USA) */ },
-  { 0x000500001019E600, CL_WUPS_TITLE_WII_U, /* THE LEGEND OF ZELDA Twilight Princess HD (EUR) */ },
-  { 0x000500001019EA00, CL_WUPS_TITLE_WII_U, /* Zombeer (USA) */ },
-  { 0x000500001019ED00, CL_WUPS_TITLE_WII_U, /* STARWHAL (USA) */ },
-  { 0x000500001019EE00, CL_WUPS_TITLE_WII_U, /* Zombie Defense (USA) */ },
-  { 0x000500001019EF00, CL_WUPS_TITLE_GBA, /* MEGAMAN ZERO 4 (EUR) */ },
-  { 0x000500001019F000, CL_WUPS_TITLE_GBA, /* MEGA MAN ZERO 4 (USA) */ },
-  { 0x000500001019F100, CL_WUPS_TITLE_GBA, /* ロックマン ゼロ 4 (Rockman Zero 4) (JPN) */ },
-  { 0x000500001019F200, CL_WUPS_TITLE_GBA, /* MEGAMAN BATTLE NETWORK 5 TEAM COLONEL (EUR) */ },
-  { 0x000500001019F300, CL_WUPS_TITLE_GBA, /* MEGA MAN BATTLE NETWORK 5 TEAM COLONEL (USA) */ },
-  { 0x000500001019F500, CL_WUPS_TITLE_GBA, /* ロックマン エグゼ 5 チーム オブ カーネル (Rockman EXE 5 Team of Colonel) (JPN) */ },
-  { 0x000500001019F600, CL_WUPS_TITLE_GBA, /* MEGAMAN BATTLE NETWORK 5 TEAM PROTOMAN (EUR) */ },
-  { 0x000500001019F700, CL_WUPS_TITLE_GBA, /* MEGA MAN BATTLE NETWORK 5 TEAM PROTOMAN (USA) */ },
-  { 0x000500001019F800, CL_WUPS_TITLE_GBA, /* ロックマン エグゼ 5 チーム オブ ブルース (Rockman EXE 5 Team of Blues) (JPN) */ },
-  { 0x000500001019F900, CL_WUPS_TITLE_NES, /* スーパーチャイニーズ2 ドラゴンキッド (Super Chinese 2) (JPN) */ },
-  { 0x000500001019FA00, CL_WUPS_TITLE_NES, /* Little Ninja Brothers (USA) */ },
-  { 0x000500001019FB00, CL_WUPS_TITLE_NES, /* Little Ninja Brothers (EUR) */ },
-  { 0x000500001019FC00, CL_WUPS_TITLE_NES, /* 飛龍の拳Ⅱ ドラゴンの翼 (Hiryū no Ken II Dragon no Tsubasa) (JPN) */ },
-  { 0x000500001019FD00, CL_WUPS_TITLE_NES, /* Flying Warriors (USA) */ },
-  { 0x000500001019FE00, CL_WUPS_TITLE_NES, /* Flying Warriors (EUR) */ },
-  { 0x000500001019FF00, CL_WUPS_TITLE_NES, /* マグマックス (Magmax) (JPN) */ },
-  { 0x00050000101A0200, CL_WUPS_TITLE_NES, /* フォーメーションZ (Formation Z) (JPN) */ },
-  { 0x00050000101A0300, CL_WUPS_TITLE_NES, /* エクセリオン (Exerion) (JPN) */ },
-  { 0x00050000101A0400, CL_WUPS_TITLE_NES, /* ダウンタウン熱血物語 (River City Ransom) (JPN) */ },
-  { 0x00050000101A0500, CL_WUPS_TITLE_NES, /* River City Ransom (USA) */ },
-  { 0x00050000101A0600, CL_WUPS_TITLE_NES, /* Street Gangs (EUR) */ },
-  { 0x00050000101A0700, CL_WUPS_TITLE_NES, /* メタルスレイダーグローリー (Metal Slader Glory) (JPN) */ },
-  { 0x00050000101A0800, CL_WUPS_TITLE_WII_U, /* スーパーマリオコレクション (???) (JPN) */ },
-  { 0x00050000101A0B00, CL_WUPS_TITLE_SNES, /* 美少女雀士スーチーパイ (Bishōjo Janshi Suchie-Pai) (JPN) */ },
-  { 0x00050000101A0C00, CL_WUPS_TITLE_SNES, /* 魔神転生Ⅱ SPIRAL NEMESIS (JPN) */ },
-  { 0x00050000101A0D00, CL_WUPS_TITLE_N64, /* 星のカービィ64 (Kirby 64 The Crystal Shards) (JPN) */ },
-  { 0x00050000101A0E00, CL_WUPS_TITLE_N64, /* Kirby 64: The Crystal Shards (EUR/USA) */ },
-  { 0x00050000101A0F00, CL_WUPS_TITLE_N64, /* マリオテニス64 (Mario Tennis 64) (JPN) */ },
-  { 0x00050000101A1000, CL_WUPS_TITLE_N64, /* Mario Tennis (EUR/USA) */ },
-  { 0x00050000101A1200, CL_WUPS_TITLE_WII_U, /* Affordable Space Adventures (EUR) */ },
-  { 0x00050000101A1300, CL_WUPS_TITLE_WII_U, /* Paper Monsters Recut (EUR) */ },
-  { 0x00050000101A1400, CL_WUPS_TITLE_WII_U, /* Ultratron (EUR) */ },
-  { 0x00050000101A1600, CL_WUPS_TITLE_WII_U, /* Teslagrad (EUR) */ },
-  { 0x00050000101A1800, CL_WUPS_TITLE_WII_U, /* Zombie Defense (EUR) */ },
-  { 0x00050000101A1B00, CL_WUPS_TITLE_WII_U, /* Swords & Soldiers II (USA) */ },
-  { 0x00050000101A1C00, CL_WUPS_TITLE_WII_U, /* Ultratron (USA) */ },
-  { 0x00050000101A1E00, CL_WUPS_TITLE_NDS, /* さわるメイドインワリオ (WarioWare: Touched!) (JPN) */ },
-  { 0x00050000101A1F00, CL_WUPS_TITLE_NDS, /* WarioWare: Touched! (USA) */ },
-  { 0x00050000101A2000, CL_WUPS_TITLE_NDS, /* WarioWare: Touched! (EUR) */ },
-  { 0x00050000101A2100, CL_WUPS_TITLE_NDS, /* マリオ&ルイージRPG2 (Mario & Luigi: Partners in Time) (JPN) */ },
-  { 0x00050000101A2200, CL_WUPS_TITLE_NDS, /* Mario & Luigi: Partners in Time (USA) */ },
-  { 0x00050000101A2300, CL_WUPS_TITLE_NDS, /* Mario & Luigi: Partners in Time (EUR) */ },
-  { 0x00050000101A2400, CL_WUPS_TITLE_WII_U, /* Tested with robots ! (EUR) */ },
-  { 0x00050000101A2500, CL_WUPS_TITLE_WII_U, /* カラクリWooden Sen'SeY (JPN) */ },
-  { 0x00050000101A2600, CL_WUPS_TITLE_WII_U, /* カンフーラビット (Kung Fu Rabbit) (JPN) */ },
-  { 0x00050000101A2700, CL_WUPS_TITLE_WII_U, /* Puddle (JPN) */ },
-  { 0x00050000101A2800, CL_WUPS_TITLE_WII_U, /* スチームワールド ディグ HD (SteamWorld Dig) (JPN) */ },
-  { 0x00050000101A2C00, CL_WUPS_TITLE_WII_U, /* Family Tennis SP (EUR) */ },
-  { 0x00050000101A2D00, CL_WUPS_TITLE_WII_U, /* LEGO® マーベル スーパー・ヒーローズ ザ・ゲーム (LEGO® MARVEL Super Heroes) (JPN) */ },
-  { 0x00050000101A2E00, CL_WUPS_TITLE_WII_U, /* XType+ (JPN) */ },
-  { 0x00050000101A2F00, CL_WUPS_TITLE_WII_U, /* Super Toy Cars (JPN) */ },
-  { 0x00050000101A3000, CL_WUPS_TITLE_GBA, /* Advance Wars 2: Black Hole Rising (EUR) */ },
-  { 0x00050000101A3100, CL_WUPS_TITLE_GBA, /* Advance Wars 2: Black Hole Rising (USA) */ },
-  { 0x00050000101A3200, CL_WUPS_TITLE_GBA, /* 伝説のスタフィー (Densetsu no Stafy) (JPN) */ },
-  { 0x00050000101A3300, CL_WUPS_TITLE_GBA, /* トマトアドベンチャー (Tomato Adventure) (JPN) */ },
-  { 0x00050000101A3400, CL_WUPS_TITLE_GBA, /* マジカルバケーション (Magical Vacation) (JPN) */ },
-  { 0x00050000101A3500, CL_WUPS_TITLE_WII_U, /* Mario Tennis: Ultra Smash (USA) */ },
-  { 0x00050000101A3600, CL_WUPS_TITLE_WII_U, /* Mario Tennis: Ultra Smash (EUR) */ },
-  { 0x00050000101A3700, CL_WUPS_TITLE_WII_U, /* SteamWorld Heist (EUR) */ },
-  { 0x00050000101A3800, CL_WUPS_TITLE_WII_U, /* Spy Chameleon (EUR) */ },
-  { 0x00050000101A3900, CL_WUPS_TITLE_WII_U, /* Blek (EUR) */ },
-  { 0x00050000101A3B00, CL_WUPS_TITLE_WII_U, /* Life of Pixel (USA) */ },
-  { 0x00050000101A3C00, CL_WUPS_TITLE_WII_U, /* The Binding of Isaac: Rebirth (USA) */ },
-  { 0x00050000101A3E00, CL_WUPS_TITLE_WII_U, /* Defense Dome (USA) */ },
-  { 0x00050000101A3F00, CL_WUPS_TITLE_WII_U, /* Heptrix (USA) */ },
-  { 0x00050000101A4000, CL_WUPS_TITLE_WII_U, /* SteamWorld Heist (USA) */ },
-  { 0x00050000101A4300, CL_WUPS_TITLE_WII_U, /* Beatbuddy (USA) */ },
-  { 0x00050000101A4400, CL_WUPS_TITLE_WII_U, /* Toon Tanks (USA) */ },
-  { 0x00050000101A4700, CL_WUPS_TITLE_GBA, /* チューチューロケット！ (ChuChu Rocket!) (JPN) */ },
-  { 0x00050000101A4800, CL_WUPS_TITLE_WII_U, /* LOST REAVERS (USA) */ },
-  { 0x00050000101A4900, CL_WUPS_TITLE_WII_U, /* Life of Pixel (EUR) */ },
-  { 0x00050000101A4B00, CL_WUPS_TITLE_WII_U, /* Blek (USA) */ },
-  { 0x00050000101A4C00, CL_WUPS_TITLE_WII_U, /* Stone Shire (USA) */ },
-  { 0x00050000101A4E00, CL_WUPS_TITLE_WII_U, /* Cube Life: Pixel Action Heroes (EUR) */ },
-  { 0x00050000101A4F00, CL_WUPS_TITLE_WII_U, /* Cube Life: Pixel Action Heroes (USA) */ },
-  { 0x00050000101A5200, CL_WUPS_TITLE_NDS, /* ドンキーコング ジャングルクライマー (Donkey Kong Jungle Climber) (JPN) */ },
-  { 0x00050000101A5300, CL_WUPS_TITLE_NDS, /* DK Jungle Climber (USA) */ },
-  { 0x00050000101A5400, CL_WUPS_TITLE_NDS, /* Donkey Kong Jungle Climber (EUR) */ },
-  { 0x00050000101A5500, CL_WUPS_TITLE_NDS, /* 星のカービィ 参上！ドロッチェ団 (Kirby Squeak Squad) (JPN) */ },
-  { 0x00050000101A5600, CL_WUPS_TITLE_NDS, /* Kirby Squeak Squad (USA) */ },
-  { 0x00050000101A5700, CL_WUPS_TITLE_NDS, /* Kirby: Mouse Attack (EUR) */ },
-  { 0x00050000101A5800, CL_WUPS_TITLE_N64, /* マリオゴルフ64 (Mario Golf 64) (JPN) */ },
-  { 0x00050000101A5900, CL_WUPS_TITLE_N64, /* Mario Golf (EUR/USA) */ },
-  { 0x00050000101A5A00, CL_WUPS_TITLE_N64, /* テン・エイティ スノーボーディング (1080° Snowboarding) (JPN) */ },
-  { 0x00050000101A5B00, CL_WUPS_TITLE_N64, /* 1080° Snowboarding (EUR/USA) */ },
-  { 0x00050000101A5C00, CL_WUPS_TITLE_WII_U, /* LEGO® Jurassic World™ (EUR) */ },
-  { 0x00050000101A5D00, CL_WUPS_TITLE_WII_U, /* BADLAND Game of the Year Edition (EUR) */ },
-  { 0x00050000101A5E00, CL_WUPS_TITLE_WII_U, /* OlliOlli (EUR) */ },
-  { 0x00050000101A5F00, CL_WUPS_TITLE_WII_U, /* Shantae and the Pirate's Curse (USA) */ },
-  { 0x00050000101A6000, CL_WUPS_TITLE_WII_U, /* Tadpole Treble (USA) */ },
-  { 0x00050000101A6100, CL_WUPS_TITLE_WII_U, /* Shantae: Risky's Revenge - Director's Cut (USA) */ },
-  { 0x00050000101A6200, CL_WUPS_TITLE_WII_U, /* LEGO® Jurassic World™ (USA) */ },
-  { 0x00050000101A6300, CL_WUPS_TITLE_WII_U, /* Cube Life: Island Survival (EUR) */ },
-  { 0x00050000101A6400, CL_WUPS_TITLE_WII_U, /* Cube Life: Island Survival (USA) */ },
-  { 0x00050000101A6500, CL_WUPS_TITLE_WII_U, /* Kung Fu Panda Showdown of Legendary Legends (USA) */ },
-  { 0x00050000101A6700, CL_WUPS_TITLE_WII_U, /* Suspension Railroad Simulator (EUR) */ },
-  { 0x00050000101A6900, CL_WUPS_TITLE_WII_U, /* OlliOlli (USA) */ },
-  { 0x00050000101A7100, CL_WUPS_TITLE_NES, /* ワイルドガンマン (Wild Gunman) (JPN) */ },
-  { 0x00050000101A7200, CL_WUPS_TITLE_NES, /* Wild Gunman (USA) */ },
-  { 0x00050000101A7300, CL_WUPS_TITLE_NES, /* Wild Gunman (EUR) */ },
-  { 0x00050000101A7400, CL_WUPS_TITLE_NES, /* 超人ウルトラベースボール (Baseball Simulator 1000) (JPN) */ },
-  { 0x00050000101A7500, CL_WUPS_TITLE_NES, /* Baseball Simulator 1000 (USA) */ },
-  { 0x00050000101A7600, CL_WUPS_TITLE_NES, /* ディグダグⅡ (Dig Dug II) (JPN) */ },
-  { 0x00050000101A7700, CL_WUPS_TITLE_NES, /* DIG DUG II (USA) */ },
-  { 0x00050000101A7800, CL_WUPS_TITLE_NES, /* Dig Dug 2 (EUR) */ },
-  { 0x00050000101A7900, CL_WUPS_TITLE_NES, /* キングスナイト (King's Knight) (JPN) */ },
-  { 0x00050000101A7A00, CL_WUPS_TITLE_NES, /* FRONT LINE フロントライン (JPN) */ },
-  { 0x00050000101A7B00, CL_WUPS_TITLE_SNES, /* ルドラの秘宝 (Treasure of the Rudras) (JPN) */ },
-  { 0x00050000101A7C00, CL_WUPS_TITLE_SNES, /* SPACE INVADERS (JPN) */ },
-  { 0x00050000101A7D00, CL_WUPS_TITLE_SNES, /* ダライアスツイン DARIUS TWIN (JPN) */ },
-  { 0x00050000101A7E00, CL_WUPS_TITLE_WII_U, /* Bit Dungeon+ (USA) */ },
-  { 0x00050000101A7F00, CL_WUPS_TITLE_WII_U, /* Shiftlings (USA) */ },
-  { 0x00050000101A8000, CL_WUPS_TITLE_WII_U, /* uWordsmith (USA) */ },
-  { 0x00050000101A8100, CL_WUPS_TITLE_WII_U, /* Dodge Club Party (USA) */ },
-  { 0x00050000101A8200, CL_WUPS_TITLE_WII_U, /* Epic Dumpster Bear (USA) */ },
-  { 0x00050000101A8300, CL_WUPS_TITLE_WII_U, /* Journey of a Special Average Balloon (USA) */ },
-  { 0x00050000101A8600, CL_WUPS_TITLE_WII_U, /* Puzzle Monkeys (USA) */ },
-  { 0x00050000101A8700, CL_WUPS_TITLE_WII_U, /* Suspension Railroad Simulator (USA) */ },
-  { 0x00050000101A8900, CL_WUPS_TITLE_WII_U, /* Breezeblox (USA) */ },
-  { 0x00050000101A9100, CL_WUPS_TITLE_WII_U, /* Rakuten TV (JPN) */ },
-  { 0x00050000101A9200, CL_WUPS_TITLE_GBA, /* Onimusha Tactics (EUR) */ },
-  { 0x00050000101A9300, CL_WUPS_TITLE_GBA, /* ONIMUSHA TACTICS (USA) */ },
-  { 0x00050000101A9400, CL_WUPS_TITLE_GBA, /* 鬼武者～Onimusha Tactics～ (JPN) */ },
-  { 0x00050000101A9500, CL_WUPS_TITLE_WII_U, /* Shantae and the Pirate's Curse (EUR) */ },
-  { 0x00050000101A9600, CL_WUPS_TITLE_WII_U, /* Shantae: Risky's Revenge Director's Cut (EUR) */ },
-  { 0x00050000101A9800, CL_WUPS_TITLE_SNES, /* Pocky & Rocky with Becky (EUR/USA) */ },
-  { 0x00050000101A9900, CL_WUPS_TITLE_SNES, /* Car Battler Joe (USA) */ },
-  { 0x00050000101A9A00, CL_WUPS_TITLE_GBA, /* シャイニング・フォース 黒き竜の復活 (Shining Force) (JPN) */ },
-  { 0x00050000101A9B00, CL_WUPS_TITLE_WII_U, /* Rakoo & Friends (EUR) */ },
-  { 0x00050000101A9C00, CL_WUPS_TITLE_WII_U, /* Chompy Chomp Chomp Party (EUR) */ },
-  { 0x00050000101A9E00, CL_WUPS_TITLE_WII_U, /* Chompy Chomp Chomp Party (USA) */ },
-  { 0x00050000101A9F00, CL_WUPS_TITLE_WII_U, /* Dot Arcade (USA) */ },
-  { 0x00050000101AA100, CL_WUPS_TITLE_WII_U, /* Paparazzi (USA) */ },
-  { 0x00050000101AA200, CL_WUPS_TITLE_WII_U, /* Vector Assault (USA) */ },
-  { 0x00050000101AA300, CL_WUPS_TITLE_WII_U, /* SDK Spriter (USA) */ },
-  { 0x00050000101AA500, CL_WUPS_TITLE_WII_U, /* Kung Fu Panda Showdown of Legendary Legends (EUR) */ },
-  { 0x00050000101AAC00, CL_WUPS_TITLE_WII_U, /* Red Riding Hood (EUR) */ },
-  { 0x00050000101AAF00, CL_WUPS_TITLE_WII_U, /* Factotum (USA) */ },
-  { 0x00050000101AB100, CL_WUPS_TITLE_WII_U, /* Outer World 20th Anniversary Edition (JPN) */ },
-  { 0x00050000101ABB00, CL_WUPS_TITLE_WII_U, /* COLOR BOMBS (USA) */ },
-  { 0x00050000101ABC00, CL_WUPS_TITLE_WII_U, /* Kirby and the Rainbow Curse (USA) */ },
-  { 0x00050000101ABD00, CL_WUPS_TITLE_NDS, /* 怪盗ワリオ・ザ・セブン (Wario: Master of Disguise) (JPN) */ },
-  { 0x00050000101ABE00, CL_WUPS_TITLE_NDS, /* Wario: Master of Disguise (USA) */ },
-  { 0x00050000101ABF00, CL_WUPS_TITLE_NDS, /* Wario: Master of Disguise (EUR) */ },
-  { 0x00050000101AC000, CL_WUPS_TITLE_NDS, /* スターフォックス コマンド (Star Fox Command) (JPN) */ },
-  { 0x00050000101AC100, CL_WUPS_TITLE_NDS, /* Star Fox Command (USA) */ },
-  { 0x00050000101AC200, CL_WUPS_TITLE_NDS, /* Star Fox Command (EUR) */ },
-  { 0x00050000101AC300, CL_WUPS_TITLE_N64, /* スターフォックス64 (Star Fox 64) (JPN) */ },
-  { 0x00050000101AC400, CL_WUPS_TITLE_N64, /* Star Fox 64 (EUR/USA) */ },
-  { 0x00050000101AC500, CL_WUPS_TITLE_N64, /* ウエーブレース64 (Wave Race 64) (JPN) */ },
-  { 0x00050000101AC600, CL_WUPS_TITLE_N64, /* Wave Race 64 (EUR/USA) */ },
-  { 0x00050000101AC700, CL_WUPS_TITLE_WII_U, /* Adventure Time: Finn & Jake Investigations (USA) */ },
-  { 0x00050000101AC900, CL_WUPS_TITLE_WII_U, /* DISNEY INFINITY 3.0 EDITION (USA) */ },
-  { 0x00050000101ACA00, CL_WUPS_TITLE_WII_U, /* Free Balling (USA) */ },
-  { 0x00050000101ACB00, CL_WUPS_TITLE_WII_U, /* psyscrolr (USA) */ },
-  { 0x00050000101ACC00, CL_WUPS_TITLE_WII_U, /* Shiftlings (EUR) */ },
-  { 0x00050000101ACD00, CL_WUPS_TITLE_GBA, /* ファイアーエムブレム 封印の剣 (Fire Emblem: Fūin no Tsurugi) (JPN) */ },
-  { 0x00050000101ACF00, CL_WUPS_TITLE_GBA, /* Medabots AX: Rokusho Version (EUR) */ },
-  { 0x00050000101AD000, CL_WUPS_TITLE_GBA, /* Medabots AX: Rokusho (USA) */ },
-  { 0x00050000101AD100, CL_WUPS_TITLE_GBA, /* メダロットG クワガタバージョン Medabots AX: Rokusho Version) (JPN) */ },
-  { 0x00050000101AD200, CL_WUPS_TITLE_GBA, /* Medabots AX: Metabee Version (EUR) */ },
-  { 0x00050000101AD300, CL_WUPS_TITLE_GBA, /* Medabots AX: Metabee (USA) */ },
-  { 0x00050000101AD400, CL_WUPS_TITLE_GBA, /* メダロットG カブトバージョン (Medabots AX: Metabee Version) (JPN) */ },
-  { 0x00050000101AD500, CL_WUPS_TITLE_GBA, /* ソニック アドバンス 2 (Sonic Advance 2) (JPN) */ },
-  { 0x00050000101AD800, CL_WUPS_TITLE_WII_U, /* Cube Blitz (USA) */ },
-  { 0x00050000101AD900, CL_WUPS_TITLE_WII_U, /* Dare Up Adrenaline (USA) */ },
-  { 0x00050000101ADA00, CL_WUPS_TITLE_WII_U, /* Eba & Egg: A Hatch Trip (USA) */ },
-  { 0x00050000101ADE00, CL_WUPS_TITLE_WII_U, /* SPACE HULK (USA) */ },
-  { 0x00050000101AE200, CL_WUPS_TITLE_WII_U, /* Tomeling in Trouble (USA) */ },
-  { 0x00050000101AE300, CL_WUPS_TITLE_WII_U, /* Toto Temple Deluxe (USA) */ },
-  { 0x00050000101AE400, CL_WUPS_TITLE_GBA, /* CONTRA ADVANCE THE ALIEN WARS EX (EUR) */ },
-  { 0x00050000101AE500, CL_WUPS_TITLE_GBA, /* CONTRA ADVANCE THE ALIEN WARS EX (USA) */ },
-  { 0x00050000101AE600, CL_WUPS_TITLE_GBA, /* 魂斗羅ハードスピリッツ (Contra Hard Spirits) (JPN) */ },
-  { 0x00050000101AE700, CL_WUPS_TITLE_GBA, /* KONAMI KRAZY RACERS (EUR) */ },
-  { 0x00050000101AE800, CL_WUPS_TITLE_GBA, /* KONAMI KRAZY RACERS (USA) */ },
-  { 0x00050000101AE900, CL_WUPS_TITLE_GBA, /* コナミ ワイワイレーシング  アドバンス (Konami Krazy Racers) (JPN) */ },
-  { 0x00050000101AEA00, CL_WUPS_TITLE_NDS, /* 逆転裁判 2 (Phoenix Wright: Ace Attorney - Justice for All) (JPN) */ },
-  { 0x00050000101AEB00, CL_WUPS_TITLE_WII_U, /* SDK Paint (EUR) */ },
-  { 0x00050000101AEF00, CL_WUPS_TITLE_WII_U, /* Midnight (USA) */ },
-  { 0x00050000101AF400, CL_WUPS_TITLE_WII_U, /* PixlCross (USA) */ },
-  { 0x00050000101AFA00, CL_WUPS_TITLE_WII_U, /* Tilelicious Delicious Tiles (USA) */ },
-  { 0x00050000101AFC00, CL_WUPS_TITLE_WII_U, /* Puzzle Monkeys (EUR) */ },
-  { 0x00050000101AFD00, CL_WUPS_TITLE_WII_U, /* Crab Cakes Rescue (USA) */ },
-  { 0x00050000101AFE00, CL_WUPS_TITLE_WII_U, /* Adventure Time: Finn and Jake Investigations (EUR) */ },
-  { 0x00050000101AFF00, CL_WUPS_TITLE_WII_U, /* スターフォックス　ゼロ (Star Fox Zero) (JPN) */ },
-  { 0x00050000101B0000, CL_WUPS_TITLE_WII_U, /* Candy Hoarder (USA) */ },
-  { 0x00050000101B0100, CL_WUPS_TITLE_WII_U, /* Funk of Titans EnjoyUp Games (USA) */ },
-  { 0x00050000101B0200, CL_WUPS_TITLE_WII_U, /* PixelJunk Monsters (USA) */ },
-  { 0x00050000101B0400, CL_WUPS_TITLE_WII_U, /* Star Fox Zero (USA) */ },
-  { 0x00050000101B0500, CL_WUPS_TITLE_WII_U, /* Star Fox Zero (EUR) */ },
-  { 0x00050000101B0600, CL_WUPS_TITLE_WII, /* みんなのリズム天国 (Rhythm Heaven Fever) (JPN) */ },
-  { 0x00050000101B0700, CL_WUPS_TITLE_WII, /* Rhythm Heaven Fever (USA) */ },
-  { 0x00050000101B0800, CL_WUPS_TITLE_WII, /* Beat the Beat: Rhythm Paradise (EUR) */ },
-  { 0x00050000101B0900, CL_WUPS_TITLE_WII, /* 罪と罰 宇宙の後継者 (Sin & Punishment: Star Successor) (JPN) */ },
-  { 0x00050000101B0A00, CL_WUPS_TITLE_WII, /* Sin & Punishment: Star Successor (USA) */ },
-  { 0x00050000101B0B00, CL_WUPS_TITLE_WII, /* Sin and Punishment: Successor of the Skies (EUR) */ },
-  { 0x00050000101B0F00, CL_WUPS_TITLE_WII, /* ゼルダの伝説 スカイウォードソード (The Legend of Zelda Skyward Sword) (JPN) */ },
-  { 0x00050000101B1000, CL_WUPS_TITLE_WII, /* The Legend of Zelda: Skyward Sword (USA) */ },
-  { 0x00050000101B1100, CL_WUPS_TITLE_WII, /* The Legend of Zelda: Skyward Sword (EUR) */ },
-  { 0x00050000101B1200, CL_WUPS_TITLE_WII, /* パンドラの塔 君のもとへ帰るまで (Pandora's Tower) (JPN) */ },
-  { 0x00050000101B1300, CL_WUPS_TITLE_WII, /* Pandora's Tower (USA) */ },
-  { 0x00050000101B1400, CL_WUPS_TITLE_WII, /* Pandora's Tower (EUR) */ },
-  { 0x00050000101B1500, CL_WUPS_TITLE_WII, /* 斬撃のREGINLEIV (JPN) */ },
-  { 0x00050000101B1600, CL_WUPS_TITLE_WII, /* 毛糸のカービィ (Kirby's Epic Yarn) (JPN) */ },
-  { 0x00050000101B1700, CL_WUPS_TITLE_WII, /* Kirby's Epic Yarn (USA) */ },
-  { 0x00050000101B1800, CL_WUPS_TITLE_WII, /* Kirby's Epic Yarn (EUR) */ },
-  { 0x00050000101B1900, CL_WUPS_TITLE_WII, /* MARIO SPORTS MIX （マリオスポーツミックス） (JPN) */ },
-  { 0x00050000101B1A00, CL_WUPS_TITLE_WII, /* Mario Sports Mix (USA) */ },
-  { 0x00050000101B1B00, CL_WUPS_TITLE_WII, /* Mario Sports Mix (EUR) */ },
-  { 0x00050000101B2300, CL_WUPS_TITLE_WII, /* 零 ～眞紅の蝶～ (Zero ~Crimson Butterfly~) (JPN) */ },
-  { 0x00050000101B2400, CL_WUPS_TITLE_WII, /* Project Zero 2 Wii Edition (EUR) */ },
-  { 0x00050000101B2500, CL_WUPS_TITLE_WII, /* エキサイト猛マシン (ExciteBots: Trick Racing) (JPN) */ },
-  { 0x00050000101B2600, CL_WUPS_TITLE_WII, /* Excitebots: Trick Racing (USA) */ },
-  { 0x00050000101B2700, CL_WUPS_TITLE_WII_U, /* LEGO®バットマン3 ザ・ゲーム ゴッサムから宇宙へ (LEGO® Batman™ 3 Beyond Gotham) (JPN) */ },
-  { 0x00050000101B2800, CL_WUPS_TITLE_WII_U, /* The Fall (EUR) */ },
-  { 0x00050000101B2900, CL_WUPS_TITLE_WII_U, /* Dragon Fantasy: The Black Tome of Ice (USA) */ },
-  { 0x00050000101B2A00, CL_WUPS_TITLE_WII_U, /* Dragon Fantasy: The Volumes of Westeria (USA) */ },
-  { 0x00050000101B2C00, CL_WUPS_TITLE_WII_U, /* Shütshimi (USA) */ },
-  { 0x00050000101B2E00, CL_WUPS_TITLE_WII_U, /* Tri-Strip (USA) */ },
-  { 0x00050000101B2F00, CL_WUPS_TITLE_WII_U, /* 任天堂ゲームセミナー2014 ドキドキ手紙リレー (Nintendo Game Seminar 2014 Doki Doki Tegami Relay) (JPN) */ },
-  { 0x00050000101B3000, CL_WUPS_TITLE_WII_U, /* 任天堂ゲームセミナー2014 ミチコジャンプ！ (Nintendo Game Seminar 2014 Michiko Jump!) (JPN) */ },
-  { 0x00050000101B3100, CL_WUPS_TITLE_WII_U, /* 任天堂ゲームセミナー2014 ジカンサタンサ (Nintendo Game Seminar 2014 Jikan Satansa) (JPN) */ },
-  { 0x00050000101B3200, CL_WUPS_TITLE_WII_U, /* ゾンビディフェンス (Zombie Defense) (JPN) */ },
-  { 0x00050000101B3400, CL_WUPS_TITLE_WII_U, /* ドラゴンクエストⅩ いにしえの竜の伝承 オンライン Version 3 (Dragon Quest X Lore of the Ancient Dragon) (JPN) */ },
-  { 0x00050000101B3600, CL_WUPS_TITLE_WII_U, /* 任天堂ゲームセミナー2014 アルクラッシュ (Nintendo Game Seminar 2014 Ark Rush) (JPN) */ },
-  { 0x00050000101B3700, CL_WUPS_TITLE_NDS, /* ファイアーエムブレム 新・暗黒竜と光の剣 (Fire Emblem: Shadow Dragon) (JPN) */ },
-  { 0x00050000101B3800, CL_WUPS_TITLE_NDS, /* Fire Emblem: Shadow Dragon (USA) */ },
-  { 0x00050000101B3900, CL_WUPS_TITLE_NDS, /* Fire Emblem: Shadow Dragon (EUR) */ },
-  { 0x00050000101B3A00, CL_WUPS_TITLE_NDS, /* メトロイドプライム ハンターズ (Metroid Prime Hunters) (JPN) */ },
-  { 0x00050000101B3B00, CL_WUPS_TITLE_NDS, /* Metroid Prime Hunters (USA) */ },
-  { 0x00050000101B3C00, CL_WUPS_TITLE_NDS, /* Metroid Prime Hunters (EUR) */ },
-  { 0x00050000101B3D00, CL_WUPS_TITLE_WII_U, /* DISNEY INFINITY 3.0: PLAY WITHOUT LIMITS (EUR) */ },
-  { 0x00050000101B3E00, CL_WUPS_TITLE_WII_U, /* DISNEY INFINITY 3.0: PLAY WITHOUT LIMITS (EUR) */ },
-  { 0x00050000101B4100, CL_WUPS_TITLE_WII_U, /* タッチ!amiibo いきなりファミコン名シーン (amiibo tap Nintendo's Greatest Bits) (JPN) */ },
-  { 0x00050000101B4200, CL_WUPS_TITLE_WII_U, /* amiibo tap Nintendo's Greatest Bits (USA) */ },
-  { 0x00050000101B4300, CL_WUPS_TITLE_WII_U, /* amiibo Touch & Play Nintendo Classics Highlights (EUR) */ },
-  { 0x00050000101B4400, CL_WUPS_TITLE_WII_U, /* Chariot (JPN) */ },
-  { 0x00050000101B4500, CL_WUPS_TITLE_N64, /* マリオカート64 (Mario Kart 64) (JPN) */ },
-  { 0x00050000101B4600, CL_WUPS_TITLE_N64, /* Mario Kart 64 (EUR/USA) */ },
-  { 0x00050000101B4700, CL_WUPS_TITLE_N64, /* 罪と罰 地球の継承者 (Sin & Punishment) (JPN) */ },
-  { 0x00050000101B4800, CL_WUPS_TITLE_N64, /* Sin & Punishment (EUR/USA) */ },
-  { 0x00050000101B4900, CL_WUPS_TITLE_WII_U, /* Blockara (USA) */ },
-  { 0x00050000101B4E00, CL_WUPS_TITLE_WII_U, /* Funk of Titans (EUR) */ },
-  { 0x00050000101B4F00, CL_WUPS_TITLE_WII_U, /* Asteroid Quarry (USA) */ },
-  { 0x00050000101B5000, CL_WUPS_TITLE_WII_U, /* Drop It: Block Paradise! (USA) */ },
-  { 0x00050000101B5100, CL_WUPS_TITLE_WII_U, /* Kirby and the Rainbow Paintbrush (EUR) */ },
-  { 0x00050000101B5400, CL_WUPS_TITLE_NES, /* ホーガンズアレイ (Hogan's Alley) (JPN) */ },
-  { 0x00050000101B5500, CL_WUPS_TITLE_NES, /* Hogan's Alley (USA) */ },
-  { 0x00050000101B5600, CL_WUPS_TITLE_NES, /* Hogan's Alley (EUR) */ },
-  { 0x00050000101B5700, CL_WUPS_TITLE_NES, /* VS.エキサイトバイク (VS. Excitebike) (JPN) */ },
-  { 0x00050000101B5800, CL_WUPS_TITLE_NES, /* VS. Excitebike (USA) */ },
-  { 0x00050000101B5900, CL_WUPS_TITLE_NES, /* レッキングクルー'98 (Wrecking Crew '98) (JPN) */ },
-  { 0x00050000101B5A00, CL_WUPS_TITLE_NES, /* StarTropics (USA) */ },
-  { 0x00050000101B5B00, CL_WUPS_TITLE_NES, /* StarTropics (EUR) */ },
-  { 0x00050000101B5C00, CL_WUPS_TITLE_NES, /* Zoda's Revenge: Star Tropics II (USA) */ },
-  { 0x00050000101B5D00, CL_WUPS_TITLE_NES, /* Zoda's Revenge: StarTropics II (EUR) */ },
-  { 0x00050000101B5E00, CL_WUPS_TITLE_WII_U, /* SPLASHY DUCK (EUR) */ },
-  { 0x00050000101B5F00, CL_WUPS_TITLE_WII_U, /* TABLETOP GALLERY (EUR) */ },
-  { 0x00050000101B6000, CL_WUPS_TITLE_WII_U, /* SPACE HULK (EUR) */ },
-  { 0x00050000101B6500, CL_WUPS_TITLE_WII_U, /* TENGAMI (JPN) */ },
-  { 0x00050000101B7400, CL_WUPS_TITLE_WII, /* 朧村正 (Muramasa: The Demon Blade) (JPN) */ },
-  { 0x00050000101B7700, CL_WUPS_TITLE_WII, /* HOSPITAL. ホスピタル 6人の医師 (Trauma Team) (JPN) */ },
-  { 0x00050000101B7800, CL_WUPS_TITLE_WII, /* Trauma Team (USA) */ },
-  { 0x00050000101B7C00, CL_WUPS_TITLE_WII, /* 影の塔 (Lost in Shadow) (JPN) */ },
-  { 0x00050000101B7D00, CL_WUPS_TITLE_WII, /* Lost in Shadow (USA) */ },
-  { 0x00050000101B7E00, CL_WUPS_TITLE_WII, /* A Shadow's Tale (EUR) */ },
-  { 0x00050000101B8400, CL_WUPS_TITLE_WII_U, /* Mortar Melon (USA) */ },
-  { 0x00050000101B8500, CL_WUPS_TITLE_WII_U, /* Skylanders SuperChargers (USA) */ },
-  { 0x00050000101B8800, CL_WUPS_TITLE_NDS, /* タッチ！カービィ (Kirby Canvas Curse) (JPN) */ },
-  { 0x00050000101B8900, CL_WUPS_TITLE_NDS, /* Kirby Canvas Curse (USA) */ },
-  { 0x00050000101B8A00, CL_WUPS_TITLE_NDS, /* Kirby: Power Paintbrush (EUR) */ },
-  { 0x00050000101B8B00, CL_WUPS_TITLE_NDS, /* ゼルダの伝説 大地の汽笛 (The Legend of Zelda: Spirit Tracks) (JPN) */ },
-  { 0x00050000101B8C00, CL_WUPS_TITLE_NDS, /* The Legend of Zelda: Spirit Tracks (USA) */ },
-  { 0x00050000101B8D00, CL_WUPS_TITLE_NDS, /* The Legend of Zelda: Spirit Tracks (EUR) */ },
-  { 0x00050000101B9000, CL_WUPS_TITLE_WII_U, /* JUST DANCE® 2016 (USA) */ },
-  { 0x00050000101B9100, CL_WUPS_TITLE_GBA, /* シャイニング・ソウルⅡ (Shining Soul II) (JPN) */ },
-  { 0x00050000101B9200, CL_WUPS_TITLE_GBA, /* くるりんパラダイス (Kururin Paradise) (JPN) */ },
-  { 0x00050000101B9600, CL_WUPS_TITLE_WII_U, /* Super Destronaut (USA) */ },
-  { 0x00050000101B9700, CL_WUPS_TITLE_WII_U, /* SDK Spriter (EUR) */ },
-  { 0x00050000101B9800, CL_WUPS_TITLE_WII_U, /* JUST DANCE® 2016 (EUR) */ },
-  { 0x00050000101B9900, CL_WUPS_TITLE_WII_U, /* LOST REAVERS (EUR) */ },
-  { 0x00050000101B9B00, CL_WUPS_TITLE_WII_U, /* Mutant Mudds Super Challenge (USA) */ },
-  { 0x00050000101B9C00, CL_WUPS_TITLE_GBA, /* Polarium Advance (EUR) */ },
-  { 0x00050000101B9D00, CL_WUPS_TITLE_GBA, /* Polarium Advance (USA) */ },
-  { 0x00050000101B9E00, CL_WUPS_TITLE_GBA, /* 通勤ヒトフデ (Polarium Advance) (JPN) */ },
-  { 0x00050000101B9F00, CL_WUPS_TITLE_WII_U, /* Extreme Exorcism (EUR) */ },
-  { 0x00050000101BA000, CL_WUPS_TITLE_WII_U, /* Severed (EUR) */ },
-  { 0x00050000101BA100, CL_WUPS_TITLE_WII_U, /* クイズで勉強、やる気が育つ。 学びゲット！ (Best way to motivate kids ManabiGet!) (JPN) */ },
-  { 0x00050000101BA400, CL_WUPS_TITLE_WII_U, /* Guitar Hero Live (USA) */ },
-  { 0x00050000101BA500, CL_WUPS_TITLE_WII_U, /* Extreme Exorcism (USA) */ },
-  { 0x00050000101BA700, CL_WUPS_TITLE_WII_U, /* PENTAPUZZLE (USA) */ },
-  { 0x00050000101BA900, CL_WUPS_TITLE_WII_U, /* Severed (USA) */ },
-  { 0x00050000101BAA00, CL_WUPS_TITLE_WII_U, /* Totem Topple (USA) */ },
-  { 0x00050000101BAE00, CL_WUPS_TITLE_N64, /* ゼルダの伝説 ムジュラの仮面 (The Legend of Zelda: Majora's Mask) (JPN) */ },
-  { 0x00050000101BAF00, CL_WUPS_TITLE_N64, /* The Legend of Zelda: Majora's Mask (USA) */ },
-  { 0x00050000101BB000, CL_WUPS_TITLE_N64, /* The Legend of Zelda: Majora's Mask (EUR) */ },
-  { 0x00050000101BB100, CL_WUPS_TITLE_N64, /* ヨッシーストーリー (Yoshi's Story) (JPN) */ },
-  { 0x00050000101BB200, CL_WUPS_TITLE_N64, /* Yoshi's Story (EUR/USA) */ },
-  { 0x00050000101BB300, CL_WUPS_TITLE_WII_U, /* ZaciSa: Defense of the Crayon Dimensions! (EUR) */ },
-  { 0x00050000101BB400, CL_WUPS_TITLE_WII_U, /* Teslagrad (JPN) */ },
-  { 0x00050000101BB700, CL_WUPS_TITLE_WII_U, /* Blocky Bot (EUR) */ },
-  { 0x00050000101BB800, CL_WUPS_TITLE_WII_U, /* Elliot Quest (EUR) */ },
-  { 0x00050000101BB900, CL_WUPS_TITLE_GBA, /* F-ZERO クライマックス (F-Zero Climax) (JPN) */ },
-  { 0x00050000101BBA00, CL_WUPS_TITLE_GBA, /* 伝説のスタフィー2 (Densetsu no Stafy 2) (JPN) */ },
-  { 0x00050000101BBB00, CL_WUPS_TITLE_GBA, /* シャイニング・ソウル (Shining Soul) (JPN) */ },
-  { 0x00050000101BBC00, CL_WUPS_TITLE_WII_U, /* Astral Breakers (USA) */ },
-  { 0x00050000101BBD00, CL_WUPS_TITLE_WII_U, /* Bubble Gum Popper (USA) */ },
-  { 0x00050000101BBF00, CL_WUPS_TITLE_WII_U, /* ねじ巻きナイト２ (Wind-up Knight 2) (JPN) */ },
-  { 0x00050000101BC000, CL_WUPS_TITLE_WII_U, /* ドットペイント (Pixel Paint) (JPN) */ },
-  { 0x00050000101BC100, CL_WUPS_TITLE_WII_U, /* ガールズ・ライク・ロボッツ (Girls Like Robots) (JPN) */ },
-  { 0x00050000101BC200, CL_WUPS_TITLE_WII_U, /* SANTA FACTORY (USA) */ },
-  { 0x00050000101BC300, CL_WUPS_TITLE_WII_U, /* Beatbuddy (EUR) */ },
-  { 0x00050000101BC400, CL_WUPS_TITLE_WII_U, /* Plenty of Fishies (EUR) */ },
-  { 0x00050000101BC500, CL_WUPS_TITLE_WII_U, /* Mortar Melon (EUR) */ },
-  { 0x00050000101BC600, CL_WUPS_TITLE_WII_U, /* Guitar Hero Live (EUR) */ },
-  { 0x00050000101BC700, CL_WUPS_TITLE_WII_U, /* Blocky Bot (USA) */ },
-  { 0x00050000101BC800, CL_WUPS_TITLE_WII_U, /* Paranautical Activity (USA) */ },
-  { 0x00050000101BC900, CL_WUPS_TITLE_WII_U, /* Aperion Cyberstorm (USA) */ },
-  { 0x00050000101BCA00, CL_WUPS_TITLE_WII_U, /* Napster (EUR) */ },
-  { 0x00050000101BCB00, CL_WUPS_TITLE_WII_U, /* Rhapsody (USA) */ },
-  { 0x00050000101BCC00, CL_WUPS_TITLE_WII_U, /* Dying Is Dangerous (USA) */ },
-  { 0x00050000101BCD00, CL_WUPS_TITLE_WII_U, /* Underground (USA) */ },
-  { 0x00050000101BCE00, CL_WUPS_TITLE_WII_U, /* Woah Dave! (USA) */ },
-  { 0x00050000101BCF00, CL_WUPS_TITLE_WII_U, /* Word Search by POWGI (USA) */ },
-  { 0x00050000101BD000, CL_WUPS_TITLE_WII, /* スーパーペーパーマリオ (Super Paper Mario) (JPN) */ },
-  { 0x00050000101BD100, CL_WUPS_TITLE_WII, /* Super Paper Mario (USA) */ },
-  { 0x00050000101BD200, CL_WUPS_TITLE_WII, /* Super Paper Mario (EUR) */ },
-  { 0x00050000101BD600, CL_WUPS_TITLE_WII, /* バイオハザード4 Wii Edition (resident evil 4 Wii edition) (JPN) */ },
-  { 0x00050000101BD700, CL_WUPS_TITLE_WII, /* RESIDENT EVIL 4 Wii EDITION (USA) */ },
-  { 0x00050000101BD800, CL_WUPS_TITLE_WII, /* resident evil 4 Wii edition (EUR) */ },
-  { 0x00050000101BD900, CL_WUPS_TITLE_WII, /* 宝島Ｚ　バルバロスの秘宝 (ZACK & WIKI Quest for Barbaros' Treasure) (JPN) */ },
-  { 0x00050000101BDA00, CL_WUPS_TITLE_WII, /* ZACK & WIKI: QUEST FOR BARBAROS' TREASURE (USA) */ },
-  { 0x00050000101BDB00, CL_WUPS_TITLE_WII, /* ZACK & WIKI Quest for Barbaros' Treasure (EUR) */ },
-  { 0x00050000101BDC00, CL_WUPS_TITLE_WII, /* マリオストライカーズ チャージド (Mario Strikers Charged Football) (JPN) */ },
-  { 0x00050000101BDD00, CL_WUPS_TITLE_WII, /* Mario Strikers Charged Football (EUR) */ },
-  { 0x00050000101BDE00, CL_WUPS_TITLE_WII, /* ワリオランドシェイク (Wario Land Shake It) (JPN) */ },
-  { 0x00050000101BDF00, CL_WUPS_TITLE_WII, /* Wario Land: Shake It (USA) */ },
-  { 0x00050000101BE000, CL_WUPS_TITLE_WII, /* Wario Land: The Shake Dimension (EUR) */ },
-  { 0x00050000101BE100, CL_WUPS_TITLE_WII, /* スーパーマリオスタジアム ファミリーベースボール (Mario Super Sluggers) (JPN) */ },
-  { 0x00050000101BE200, CL_WUPS_TITLE_WII, /* Mario Super Sluggers (USA) */ },
-  { 0x00050000101BE600, CL_WUPS_TITLE_WII, /* Mario Strikers Charged (USA) */ },
-  { 0x00050000101BE900, CL_WUPS_TITLE_WII_U, /* LEGO® MARVEL AVENGERS (EUR) */ },
-  { 0x00050000101BEB00, CL_WUPS_TITLE_WII_U, /* スターフォックス　ガード (Star Fox Guard) (JPN) */ },
-  { 0x00050000101BEC00, CL_WUPS_TITLE_WII_U, /* Star Fox Guard (USA) */ },
-  { 0x00050000101BED00, CL_WUPS_TITLE_WII_U, /* Star Fox Guard (EUR) */ },
-  { 0x00050000101BEF00, CL_WUPS_TITLE_WII_U, /* LEGO® Marvel's Avengers (USA) */ },
-  { 0x00050000101BF000, CL_WUPS_TITLE_WII_U, /* Race The Sun (USA) */ },
-  { 0x00050000101BF400, CL_WUPS_TITLE_WII_U, /* Shütshimi (EUR) */ },
-  { 0x00050000101BF600, CL_WUPS_TITLE_WII_U, /* Rodea the Sky Soldier (USA) */ },
-  { 0x00050000101BFC00, CL_WUPS_TITLE_WII_U, /* Skylanders SuperChargers (EUR) */ },
-  { 0x00050000101BFD00, CL_WUPS_TITLE_WII, /* スーパーマリオギャラクシー (Super Mario Galaxy) (JPN) */ },
-  { 0x00050000101BFE00, CL_WUPS_TITLE_WII, /* Super Mario Galaxy (USA) */ },
-  { 0x00050000101BFF00, CL_WUPS_TITLE_WII, /* Super Mario Galaxy (EUR) */ },
-  { 0x00050000101C0000, CL_WUPS_TITLE_WII, /* キキトリック (Kiki Trick) (JPN) */ },
-  { 0x00050000101C0100, CL_WUPS_TITLE_GBA, /* MEGA MAN BATTLE NETWORK 6 CYBEAST FALZAR (EUR) */ },
-  { 0x00050000101C0200, CL_WUPS_TITLE_GBA, /* MEGA MAN BATTLE NETWORK 6 CYBEAST FALZAR (USA) */ },
-  { 0x00050000101C0300, CL_WUPS_TITLE_GBA, /* ロックマン エグゼ 6 電脳獣ファルザー (Rockman EXE 6 Cybeast Falzar) (JPN) */ },
-  { 0x00050000101C0400, CL_WUPS_TITLE_GBA, /* MEGA MAN BATTLE NETWORK 6 CYBEAST GREGAR (EUR) */ },
-  { 0x00050000101C0500, CL_WUPS_TITLE_GBA, /* MEGA MAN BATTLE NETWORK 6 CYBEAST GREGAR (USA) */ },
-  { 0x00050000101C0600, CL_WUPS_TITLE_GBA, /* ロックマン エグゼ 6 電脳獣グレイガ (Rockman EXE 6 Cybeast Gregar) (JPN) */ },
-  { 0x00050000101C0700, CL_WUPS_TITLE_WII_U, /* Nova-111 (EUR) */ },
-  { 0x00050000101C0800, CL_WUPS_TITLE_WII_U, /* FullBlast (USA) */ },
-  { 0x00050000101C0A00, CL_WUPS_TITLE_WII_U, /* Nova-111 (USA) */ },
-  { 0x00050000101C0B00, CL_WUPS_TITLE_WII_U, /* The Swindle (USA) */ },
-  { 0x00050000101C0C00, CL_WUPS_TITLE_WII_U, /* The Swindle (EUR) */ },
-  { 0x00050000101C1F00, CL_WUPS_TITLE_NES, /* シティコネクション (Ciy Connection) (JPN) */ },
-  { 0x00050000101C2000, CL_WUPS_TITLE_NES, /* City Connection (USA) */ },
-  { 0x00050000101C2100, CL_WUPS_TITLE_WII_U, /* LOST REAVERS BETA TEST VERSION (JPN) */ },
-  { 0x00050000101C2200, CL_WUPS_TITLE_NES, /* Ninja Gaiden II: The Dark Sword of Chaos (USA) */ },
-  { 0x00050000101C2300, CL_WUPS_TITLE_NES, /* Ninja Gaiden II: The Dark Sword of Chaos (EUR) */ },
-  { 0x00050000101C2400, CL_WUPS_TITLE_NES, /* Ninja Gaiden III: The Ancient Ship of Doom (USA) */ },
-  { 0x00050000101C2500, CL_WUPS_TITLE_NES, /* Ninja Gaiden III: The Ancient Ship of Doom (EUR) */ },
-  { 0x00050000101C2600, CL_WUPS_TITLE_NES, /* TECMO BOWL (USA) */ },
-  { 0x00050000101C2700, CL_WUPS_TITLE_NES, /* TECMO BOWL (EUR) */ },
-  { 0x00050000101C2800, CL_WUPS_TITLE_NES, /* Double Dragon III: The Sacred Stones (USA) */ },
-  { 0x00050000101C2900, CL_WUPS_TITLE_NES, /* Double Dragon III: The Sacred Stones (EUR) */ },
-  { 0x00050000101C2A00, CL_WUPS_TITLE_SNES, /* Pac-Man 2: The New Adventures (USA) */ },
-  { 0x00050000101C2B00, CL_WUPS_TITLE_SNES, /* Pac-Man 2: The New Adventures (EUR) */ },
-  { 0x00050000101C2E00, CL_WUPS_TITLE_NES, /* メタルスレイダーグローリー ディレクターズカット (Metal Slader Glory) (JPN) */ },
-  { 0x00050000101C3000, CL_WUPS_TITLE_WII_U, /* The Perplexing Orb (USA) */ },
-  { 0x00050000101C3100, CL_WUPS_TITLE_WII_U, /* Freedom Planet (USA) */ },
-  { 0x00050000101C3300, CL_WUPS_TITLE_NDS, /* スーパーマリオ64DS (Super Mario 64 DS) (JPN) */ },
-  { 0x00050000101C3400, CL_WUPS_TITLE_NDS, /* Super Mario 64 DS (USA) */ },
-  { 0x00050000101C3500, CL_WUPS_TITLE_NDS, /* Super Mario 64 DS (EUR) */ },
-  { 0x00050000101C3600, CL_WUPS_TITLE_NDS, /* ゼルダの伝説 夢幻の砂時計 (The Legend of Zelda: Phantom Hourglass) (JPN) */ },
-  { 0x00050000101C3700, CL_WUPS_TITLE_NDS, /* The Legend of Zelda: Phantom Hourglass (USA) */ },
-  { 0x00050000101C3800, CL_WUPS_TITLE_NDS, /* The Legend of Zelda: Phantom Hourglass (EUR) */ },
-  { 0x00050000101C3900, CL_WUPS_TITLE_WII_U, /* Word Search by POWGI (EUR) */ },
-  { 0x00050000101C3A00, CL_WUPS_TITLE_GBA, /* ロックマン エグゼ 4.5  リアルオペレーション (Rockman EXE 4.5 Real Operation) (JPN) */ },
-  { 0x00050000101C3B00, CL_WUPS_TITLE_NDS, /* 逆転裁判 3 (Ace Attorney – Trials and Tribulations) (JPN) */ },
-  { 0x00050000101C3C00, CL_WUPS_TITLE_WII_U, /* PictoParty (EUR) */ },
-  { 0x00050000101C3D00, CL_WUPS_TITLE_GBA, /* 伝説のスタフィー3 (Densetsu no Stafy 3) (JPN) */ },
-  { 0x00050000101C3E00, CL_WUPS_TITLE_GBA, /* ソニック アドバンス 3 (Sonic Advance 3) (JPN) */ },
-  { 0x00050000101C3F00, CL_WUPS_TITLE_GBA, /* MOTHER3 (JPN) */ },
-  { 0x00050000101C4000, CL_WUPS_TITLE_WII_U, /* Rodea the Sky Soldier (EUR) */ },
-  { 0x00050000101C4100, CL_WUPS_TITLE_WII_U, /* FullBlast (EUR) */ },
-  { 0x00050000101C4200, CL_WUPS_TITLE_WII_U, /* The Peanuts® Movie: Snoopy's Grand Adventure (USA) */ },
-  { 0x00050000101C4300, CL_WUPS_TITLE_WII_U, /* Don't Starve: Giant Edition (USA) */ },
-  { 0x00050000101C4500, CL_WUPS_TITLE_WII_U, /* Year Walk 最後の啓示 (JPN) */ },
-  { 0x00050000101C4600, CL_WUPS_TITLE_WII_U, /* 99Seconds (JPN) */ },
-  { 0x00050000101C4700, CL_WUPS_TITLE_GBA, /* メダロット・ナビ クワガタ (Medarot Navi: Kuwagata) (JPN) */ },
-  { 0x00050000101C4800, CL_WUPS_TITLE_GBA, /* メダロット・ナビ カブト (Medarot Navi: Kabuto) (JPN) */ },
-  { 0x00050000101C4A00, CL_WUPS_TITLE_WII_U, /* Word Party (EUR) */ },
-  { 0x00050000101C4C00, CL_WUPS_TITLE_WII_U, /* Xenoblade Chronicles X (EUR) */ },
-  { 0x00050000101C4D00, CL_WUPS_TITLE_WII_U, /* Xenoblade Chronicles X (USA) */ },
-  { 0x00050000101C5400, CL_WUPS_TITLE_WII_U, /* The Bridge (USA) */ },
-  { 0x00050000101C5500, CL_WUPS_TITLE_WII_U, /* Word Party (USA) */ },
-  { 0x00050000101C5600, CL_WUPS_TITLE_WII_U, /* LOST REAVERS BETA TEST VERSION (EUR) */ },
-  { 0x00050000101C5700, CL_WUPS_TITLE_WII_U, /* Abyss Cosen (JPN) */ },
-  { 0x00050000101C5800, CL_WUPS_TITLE_WII_U, /* ポッ拳 POKKÉN TOURNAMENT (JPN) */ },
-  { 0x00050000101C5900, CL_WUPS_TITLE_WII_U, /* サイコロの森 3-in-1 (Tabletop Gallery) (JPN) */ },
-  { 0x00050000101C5A00, CL_WUPS_TITLE_WII_U, /* Mighty No. 9 (EUR) */ },
-  { 0x00050000101C5B00, CL_WUPS_TITLE_WII_U, /* Secret Files Tunguska (EUR) */ },
-  { 0x00050000101C5C00, CL_WUPS_TITLE_N64, /* マリオパーティ2 (Mario Party 2) (JPN) */ },
-  { 0x00050000101C5D00, CL_WUPS_TITLE_N64, /* Mario Party 2 (EUR/USA) */ },
-  { 0x00050000101C5E00, CL_WUPS_TITLE_N64, /* カスタムロボV2 (Custom Robo V2) (JPN) */ },
-  { 0x00050000101C5F00, CL_WUPS_TITLE_WII_U, /* Sanatory Hallways (EUR) */ },
-  { 0x00050000101C6000, CL_WUPS_TITLE_WII_U, /* Epic Dumpster Bear (EUR) */ },
-  { 0x00050000101C6100, CL_WUPS_TITLE_WII_U, /* ミニマリオ ＆ フレンズ amiiboチャレンジ (Mini Mario & Friends amiibo Challenge) (JPN) */ },
-  { 0x00050000101C6200, CL_WUPS_TITLE_WII_U, /* Mini Mario & Friends amiibo Challenge (USA) */ },
-  { 0x00050000101C6300, CL_WUPS_TITLE_WII_U, /* Mini Mario & Friends amiibo Challenge (EUR) */ },
-  { 0x00050000101C6400, CL_WUPS_TITLE_WII_U, /* Animal Crossing: amiibo Festival (USA) */ },
-  { 0x00050000101C6500, CL_WUPS_TITLE_WII_U, /* Animal Crossing: amiibo Festival (EUR) */ },
-  { 0x00050000101C6900, CL_WUPS_TITLE_WII_U, /* TABLETOP GALLERY (USA) */ },
-  { 0x00050000101C6A00, CL_WUPS_TITLE_WII_U, /* Octodad: Dadliest Catch (USA) */ },
-  { 0x00050000101C6B00, CL_WUPS_TITLE_WII_U, /* PEG SOLITAIRE (USA) */ },
-  { 0x00050000101C6C00, CL_WUPS_TITLE_WII_U, /* Typoman (USA) */ },
-  { 0x00050000101C6D00, CL_WUPS_TITLE_WII_U, /* Race The Sun (EUR) */ },
-  { 0x00050000101C6E00, CL_WUPS_TITLE_WII_U, /* Swords & Soldiers II (EUR) */ },
-  { 0x00050000101C7200, CL_WUPS_TITLE_WII_U, /* Placards (USA) */ },
-  { 0x00050000101C7300, CL_WUPS_TITLE_WII_U, /* The Stonecutter (USA) */ },
-  { 0x00050000101C7400, CL_WUPS_TITLE_WII_U, /* Momonga Pinball Adventures (EUR) */ },
-  { 0x00050000101C7600, CL_WUPS_TITLE_WII_U, /* Pumped BMX + (EUR) */ },
-  { 0x00050000101C7B00, CL_WUPS_TITLE_WII_U, /* Chronicles of Teddy Harmony of Exidus (USA) */ },
-  { 0x00050000101C7D00, CL_WUPS_TITLE_WII_U, /* Pumped BMX + (USA) */ },
-  { 0x00050000101C7E00, CL_WUPS_TITLE_WII_U, /* Whispering Willows (USA) */ },
-  { 0x00050000101C7F00, CL_WUPS_TITLE_WII_U, /* Toto Temple Deluxe (EUR) */ },
-  { 0x00050000101C8100, CL_WUPS_TITLE_WII_U, /* WICKED MONSTERS BLAST! HD  PLUS (USA) */ },
-  { 0x00050000101C8200, CL_WUPS_TITLE_WII_U, /* Momonga Pinball Adventures (USA) */ },
-  { 0x00050000101C8300, CL_WUPS_TITLE_NDS, /* マリオvs.ドンキーコング2 ミニミニ大行進！ (Mario vs. Donkey Kong 2: March of the Minis) (JPN) */ },
-  { 0x00050000101C8400, CL_WUPS_TITLE_NDS, /* Mario vs. Donkey Kong 2: March of the Minis (USA) */ },
-  { 0x00050000101C8500, CL_WUPS_TITLE_NDS, /* Mario vs. Donkey Kong 2: March of the Minis (EUR) */ },
-  { 0x00050000101C8600, CL_WUPS_TITLE_NDS, /* あつめて！カービィ (Kirby Mass Attack) (JPN) */ },
-  { 0x00050000101C8700, CL_WUPS_TITLE_NDS, /* Kirby Mass Attack (USA) */ },
-  { 0x00050000101C8800, CL_WUPS_TITLE_NDS, /* Kirby Mass Attack (EUR) */ },
-  { 0x00050000101C8900, CL_WUPS_TITLE_WII_U, /* 妖怪ウォッチダンス JUST DANCEスペシャルバージョン (Yo-kai Watch Dance: Just Dance Special Version) (JPN) */ },
-  { 0x00050000101C8A00, CL_WUPS_TITLE_WII_U, /* Aperion Cyberstorm (EUR) */ },
-  { 0x00050000101C8B00, CL_WUPS_TITLE_WII_U, /* WICKED MONSTERS BLAST! HD PLUS (EUR) */ },
-  { 0x00050000101C8D00, CL_WUPS_TITLE_WII_U, /* Monster High New Ghoul in School (USA) */ },
-  { 0x00050000101C8E00, CL_WUPS_TITLE_WII_U, /* Drop It: Block Paradise! (EUR) */ },
-  { 0x00050000101C9300, CL_WUPS_TITLE_WII_U, /* ゼルダの伝説 ブレス オブ ザ ワイルド (The Legend of Zelda Breath of the Wild) (JPN) */ },
-  { 0x00050000101C9400, CL_WUPS_TITLE_WII_U, /* The Legend of Zelda Breath of the Wild (USA) */ },
-  { 0x00050000101C9500, CL_WUPS_TITLE_WII_U, /* The Legend of Zelda Breath of the Wild (EUR) */ },
-  { 0x00050000101C9600, CL_WUPS_TITLE_WII_U, /* Mighty No. 9 (USA) */ },
-  { 0x00050000101C9800, CL_WUPS_TITLE_GBA, /* 千年家族 (Sennen Kazoku) (JPN) */ },
-  { 0x00050000101C9900, CL_WUPS_TITLE_GBA, /* 川のぬし釣り3＆4 (Legend of the River King 3 & 4) (JPN) */ },
-  { 0x00050000101C9A00, CL_WUPS_TITLE_WII_U, /* Don't Starve: Giant Edition (EUR) */ },
-  { 0x00050000101C9B00, CL_WUPS_TITLE_WII_U, /* The Binding of Isaac: Rebirth (EUR) */ },
-  { 0x00050000101CA000, CL_WUPS_TITLE_WII_U, /* 1001 Spikes (EUR) */ },
-  { 0x00050000101CA100, CL_WUPS_TITLE_WII_U, /* Bigley's Revenge (USA) */ },
-  { 0x00050000101CA200, CL_WUPS_TITLE_WII_U, /* Lucentek - Activate (USA) */ },
-  { 0x00050000101CA300, CL_WUPS_TITLE_WII_U, /* Neon Battle (USA) */ },
-  { 0x00050000101CA600, CL_WUPS_TITLE_WII_U, /* Year Walk (USA) */ },
-  { 0x00050000101CA700, CL_WUPS_TITLE_WII_U, /* PONCHO (EUR) */ },
-  { 0x00050000101CA800, CL_WUPS_TITLE_WII_U, /* Mutant Mudds Super Challenge (EUR) */ },
-  { 0x00050000101CA900, CL_WUPS_TITLE_WII_U, /* Monster High New Ghoul in School (EUR) */ },
-  { 0x00050000101CAA00, CL_WUPS_TITLE_WII_U, /* マッドアタック！ マックスVS泥々星人 (Mutant Mudds Deluxe) (JPN) */ },
-  { 0x00050000101CAF00, CL_WUPS_TITLE_GBA, /* Drill Dozer (EUR) */ },
-  { 0x00050000101CB000, CL_WUPS_TITLE_GBA, /* Drill Dozer (USA) */ },
-  { 0x00050000101CB100, CL_WUPS_TITLE_GBA, /* Game & Watch Gallery Advance (EUR) */ },
-  { 0x00050000101CB200, CL_WUPS_TITLE_GBA, /* Game & Watch Gallery 4 (USA) */ },
-  { 0x00050000101CB300, CL_WUPS_TITLE_GBA, /* ゲームボーイギャラリー4 (Game & Watch Gallery 4) (JPN) */ },
-  { 0x00050000101CB400, CL_WUPS_TITLE_WII_U, /* forma.8 Event Preview (USA) */ },
-  { 0x00050000101CB500, CL_WUPS_TITLE_WII_U, /* (Event Preview) Freedom Planet (USA) */ },
-  { 0x00050000101CB600, CL_WUPS_TITLE_WII_U, /* Event Preview Version Lovely P (USA) */ },
-  { 0x00050000101CB700, CL_WUPS_TITLE_WII_U, /* Mutant Mudds Super Challenge (Event Preview) (USA) */ },
-  { 0x00050000101CB900, CL_WUPS_TITLE_WII_U, /* (Event Preview) Runbow (USA) */ },
-  { 0x00050000101CBA00, CL_WUPS_TITLE_WII_U, /* (Event Preview) Soul Axiom (USA) */ },
-  { 0x00050000101CBB00, CL_WUPS_TITLE_WII_U, /* (Event Preview) Typoman (USA) */ },
-  { 0x00050000101CBC00, CL_WUPS_TITLE_WII_U, /* forma.8 (EUR) */ },
-  { 0x00050000101CBD00, CL_WUPS_TITLE_WII_U, /* The Bridge (EUR) */ },
-  { 0x00050000101CBE00, CL_WUPS_TITLE_WII_U, /* Extreme Exorcism (Event Preview Version) (USA) */ },
-  { 0x00050000101CBF00, CL_WUPS_TITLE_WII_U, /* RIVE Event Preview (USA) */ },
-  { 0x00050000101CC000, CL_WUPS_TITLE_WII_U, /* PONCHO (USA) */ },
-  { 0x00050000101CC100, CL_WUPS_TITLE_GBA, /* スクリューブレイカー 轟振どりるれろ (Drill Dozer) (JPN) */ },
-  { 0x00050000101CC200, CL_WUPS_TITLE_NDS, /* ポケモンレンジャー (Pokémon Ranger) (JPN) */ },
-  { 0x00050000101CC300, CL_WUPS_TITLE_NDS, /* Pokémon Ranger (USA) */ },
-  { 0x00050000101CC400, CL_WUPS_TITLE_NDS, /* Pokémon Ranger (EUR) */ },
-  { 0x00050000101CC500, CL_WUPS_TITLE_NDS, /* ポケモン不思議のダンジョン 青の救助隊 (Pokémon Mystery Dungeon: Blue Rescue Team) (JPN) */ },
-  { 0x00050000101CC700, CL_WUPS_TITLE_NDS, /* Pokémon Mystery Dungeon: Blue Rescue Team (USA) */ },
-  { 0x00050000101CC800, CL_WUPS_TITLE_NDS, /* Pokémon Mystery Dungeon: Blue Rescue Team (EUR) */ },
-  { 0x00050000101CC900, CL_WUPS_TITLE_WII_U, /* Freedom Planet (EUR) */ },
-  { 0x00050000101CCD00, CL_WUPS_TITLE_WII_U, /* The Rivers of Alice : Extended Version (USA) */ },
-  { 0x00050000101CCF00, CL_WUPS_TITLE_WII_U, /* Never Alone (Kisima Ingitchuna) (USA) */ },
-  { 0x00050000101CD100, CL_WUPS_TITLE_WII_U, /* (Event Preview) Soul Axiom (EUR) */ },
-  { 0x00050000101CD200, CL_WUPS_TITLE_WII_U, /* Extreme Exorcism (Event Preview Version) (EUR) */ },
-  { 0x00050000101CD300, CL_WUPS_TITLE_WII_U, /* Mutant Mudds Super Challenge (Event Preview) (EUR) */ },
-  { 0x00050000101CD400, CL_WUPS_TITLE_WII_U, /* Typoman Event Preview (EUR) */ },
-  { 0x00050000101CD500, CL_WUPS_TITLE_WII_U, /* (Event Preview) Freedom Planet (EUR) */ },
-  { 0x00050000101CD600, CL_WUPS_TITLE_WII_U, /* RIVE Event Preview (EUR) */ },
-  { 0x00050000101CD700, CL_WUPS_TITLE_WII_U, /* Event Preview Version Lovely P (EUR) */ },
-  { 0x00050000101CD800, CL_WUPS_TITLE_WII_U, /* forma.8 Event Preview (EUR) */ },
-  { 0x00050000101CD900, CL_WUPS_TITLE_WII_U, /* (Event Preview) Runbow (EUR) */ },
-  { 0x00050000101CDB00, CL_WUPS_TITLE_WII_U, /* Splatoon Pre-Launch Review (JPN) */ },
-  { 0x00050000101CDC00, CL_WUPS_TITLE_WII_U, /* Splatoon Pre-Launch Review (USA) */ },
-  { 0x00050000101CDD00, CL_WUPS_TITLE_WII_U, /* Splatoon Pre-Launch Review (EUR) */ },
-  { 0x00050000101CDE00, CL_WUPS_TITLE_WII_U, /* Splatoon (Demo) (EUR/JAP/USA) */ },
-  { 0x00050000101CDF00, CL_WUPS_TITLE_WII_U, /* LEGO®ジュラシック・ワールド (LEGO® Jurassic World™) (JPN) */ },
-  { 0x00050000101CE000, CL_WUPS_TITLE_WII_U, /* Typoman (EUR) */ },
-  { 0x00050000101CE100, CL_WUPS_TITLE_WII_U, /* Canvaleon (USA) */ },
-  { 0x00050000101CE300, CL_WUPS_TITLE_WII_U, /* ネバーアローン Never Alone (Kisima Ingitchuna) (JPN) */ },
-  { 0x00050000101CE600, CL_WUPS_TITLE_WII_U, /* Swords & Soldiers (JPN) */ },
-  { 0x00050000101CE800, CL_WUPS_TITLE_WII_U, /* Never Alone (Kisima Ingitchuna) (EUR) */ },
-  { 0x00050000101CEE00, CL_WUPS_TITLE_WII_U, /* Electronic Super Joy (USA) */ },
-  { 0x00050000101CF100, CL_WUPS_TITLE_WII_U, /* Island Flight Simulator (USA) */ },
-  { 0x00050000101CF200, CL_WUPS_TITLE_WII_U, /* Island Flight Simulator (EUR) */ },
-  { 0x00050000101CF500, CL_WUPS_TITLE_WII_U, /* Quadcopter Pilot Challenge (USA) */ },
-  { 0x00050000101CF700, CL_WUPS_TITLE_WII_U, /* Wind-up Knight 2 (USA) */ },
-  { 0x00050000101CF800, CL_WUPS_TITLE_WII_U, /* Brave Tank Hero (EUR) */ },
-  { 0x00050000101CF900, CL_WUPS_TITLE_WII_U, /* Word Puzzles by POWGI (EUR) */ },
-  { 0x00050000101CFA00, CL_WUPS_TITLE_WII_U, /* Word Puzzles by POWGI (USA) */ },
-  { 0x00050000101CFB00, CL_WUPS_TITLE_WII_U, /* Brave Tank Hero (USA) */ },
-  { 0x00050000101CFC00, CL_WUPS_TITLE_WII_U, /* KEYTARI: 8-bit Music Maker (USA) */ },
-  { 0x00050000101CFD00, CL_WUPS_TITLE_WII_U, /* Near Earth Objects (USA) */ },
-  { 0x00050000101CFF00, CL_WUPS_TITLE_WII_U, /* Job the Leprechaun (USA) */ },
-  { 0x00050000101D0000, CL_WUPS_TITLE_WII_U, /* Solitaire Dungeon Escape (USA) */ },
-  { 0x00050000101D0100, CL_WUPS_TITLE_WII_U, /* The Quiet Collection (USA) */ },
-  { 0x00050000101D0300, CL_WUPS_TITLE_WII_U, /* Project Zero: Maiden of Black Water (EUR) */ },
-  { 0x00050000101D0600, CL_WUPS_TITLE_WII_U, /* Fatal Frame: Maiden of Black Water (USA) */ },
-  { 0x00050000101D0700, CL_WUPS_TITLE_WII_U, /* Canvaleon (EUR) */ },
-  { 0x00050000101D0800, CL_WUPS_TITLE_WII_U, /* Outside the Realm (USA) */ },
-  { 0x00050000101D0900, CL_WUPS_TITLE_WII_U, /* Gunman Clive HD Collection (USA) */ },
-  { 0x00050000101D0A00, CL_WUPS_TITLE_NDS, /* Pokémon Mystery Dungeon: Red Rescue Team (EUR) */ },
-  { 0x00050000101D0B00, CL_WUPS_TITLE_NDS, /* ポケモン不思議のダンジョン 赤の救助隊 (Pokémon Mystery Dungeon: Red Rescue Team) (JPN) */ },
-  { 0x00050000101D0C00, CL_WUPS_TITLE_NDS, /* Pokémon Mystery Dungeon: Red Rescue Team (USA) */ },
-  { 0x00050000101D0D00, CL_WUPS_TITLE_GBA, /* グランボ (Granbo) (JPN) */ },
-  { 0x00050000101D0E00, CL_WUPS_TITLE_GBA, /* 川のぬし釣り5 ～不思議の森から～ (Legend of the River King 5) (JPN) */ },
-  { 0x00050000101D1000, CL_WUPS_TITLE_WII_U, /* Barbie and her Sisters Puppy Rescue (USA) */ },
-  { 0x00050000101D1100, CL_WUPS_TITLE_WII_U, /* Giana Sisters: Twisted Dreams Director's Cut (USA) */ },
-  { 0x00050000101D1200, CL_WUPS_TITLE_WII_U, /* Animal Gods (USA) */ },
-  { 0x00050000101D1300, CL_WUPS_TITLE_WII_U, /* Blue-Collar Astronaut (USA) */ },
-  { 0x00050000101D1400, CL_WUPS_TITLE_WII_U, /* Endless Golf (USA) */ },
-  { 0x00050000101D1600, CL_WUPS_TITLE_WII_U, /* Xeodrifter™ (USA) */ },
-  { 0x00050000101D1700, CL_WUPS_TITLE_WII_U, /* Booty Diver (USA) */ },
-  { 0x00050000101D1800, CL_WUPS_TITLE_WII_U, /* Girls Like Robots (USA) */ },
-  { 0x00050000101D1A00, CL_WUPS_TITLE_WII_U, /* Aenigma Os (USA) */ },
-  { 0x00050000101D1D00, CL_WUPS_TITLE_WII_U, /* Barbie and her Sisters Puppy Rescue (EUR) */ },
-  { 0x00050000101D1F00, CL_WUPS_TITLE_NDS, /* おいでよ どうぶつの森 (Animal Crossing: Wild World) (JPN) */ },
-  { 0x00050000101D2000, CL_WUPS_TITLE_NDS, /* Animal Crossing: Wild World (USA) */ },
-  { 0x00050000101D2100, CL_WUPS_TITLE_NDS, /* Animal Crossing: Wild World (EUR) */ },
-  { 0x00050000101D2200, CL_WUPS_TITLE_NDS, /* マリオパーティDS (Mario Party DS) (JPN) */ },
-  { 0x00050000101D2300, CL_WUPS_TITLE_NDS, /* Mario Party DS (USA) */ },
-  { 0x00050000101D2400, CL_WUPS_TITLE_NDS, /* Mario Party DS (EUR) */ },
-  { 0x00050000101D2500, CL_WUPS_TITLE_GBA, /* チョコボランド (Chocobo Land: A Game of Dice) (JPN) */ },
-  { 0x00050000101D2600, CL_WUPS_TITLE_GBA, /* ファイナルファンタジーI・II アドバンス (Final Fantasy I & II Advance) (JPN) */ },
-  { 0x00050000101D2700, CL_WUPS_TITLE_GBA, /* 沈黙の遺跡　～エストポリス外伝～ (Lufia ‑ The Ruins of Lore) (JPN) */ },
-  { 0x00050000101D2800, CL_WUPS_TITLE_WII_U, /* DON'T CRASH (USA) */ },
-  { 0x00050000101D2900, CL_WUPS_TITLE_WII_U, /* PIXEL SLIME U (USA) */ },
-  { 0x00050000101D2A00, CL_WUPS_TITLE_WII_U, /* Land it Rocket (USA) */ },
-  { 0x00050000101D2B00, CL_WUPS_TITLE_WII_U, /* テトロボット　AND CO. (Tetrobot and Co.) (JPN) */ },
-  { 0x00050000101D2C00, CL_WUPS_TITLE_WII_U, /* チャリ走 Ultra DX 世界ツアー (Bike Rider UltraDX WORLD TOUR) (JPN) */ },
-  { 0x00050000101D2D00, CL_WUPS_TITLE_WII_U, /* みんなで宇宙ツアー チャリ走DX2 (Bike Rider UltraDX GALAXY TOUR) (JPN) */ },
-  { 0x00050000101D2F00, CL_WUPS_TITLE_WII_U, /* バードマニアパーティ (Bird Mania Party) (JPN) */ },
-  { 0x00050000101D3000, CL_WUPS_TITLE_WII_U, /* 太鼓の達人 あつめて★ともだち大作戦！ (Taiko no Tatsujin Atsumete★ TomodachiDaisakusen!) (JPN) */ },
-  { 0x00050000101D3100, CL_WUPS_TITLE_WII_U, /* Darts UP (JPN) */ },
-  { 0x00050000101D3200, CL_WUPS_TITLE_WII_U, /* 99Moves (JPN) */ },
-  { 0x00050000101D3300, CL_WUPS_TITLE_WII_U, /* 6180 the moon (EUR) */ },
-  { 0x00050000101D3700, CL_WUPS_TITLE_WII_U, /* Ninja Strike: Dangerous Dash (USA) */ },
-  { 0x00050000101D3900, CL_WUPS_TITLE_WII_U, /* The Quiet Collection (EUR) */ },
-  { 0x00050000101D3A00, CL_WUPS_TITLE_WII_U, /* Ninja Strike: Dangerous Dash (EUR) */ },
-  { 0x00050000101D3B00, CL_WUPS_TITLE_WII_U, /* Level 22 (EUR) */ },
-  { 0x00050000101D3C00, CL_WUPS_TITLE_WII_U, /* Level 22 (USA) */ },
-  { 0x00050000101D3F00, CL_WUPS_TITLE_WII_U, /* Project Zero: Maiden of Black Water - Trial version (EUR) */ },
-  { 0x00050000101D4200, CL_WUPS_TITLE_WII_U, /* Brunswick Pro Bowling (USA) */ },
-  { 0x00050000101D4500, CL_WUPS_TITLE_WII_U, /* Grumpy Reaper (USA) */ },
-  { 0x00050000101D4600, CL_WUPS_TITLE_WII_U, /* Frankenstein - Master of Death (EUR) */ },
-  { 0x00050000101D4700, CL_WUPS_TITLE_WII_U, /* STARWHAL (EUR) */ },
-  { 0x00050000101D4800, CL_WUPS_TITLE_WII_U, /* Whispering Willows (EUR) */ },
-  { 0x00050000101D4A00, CL_WUPS_TITLE_WII_U, /* Rakoo & Friends (USA) */ },
-  { 0x00050000101D4B00, CL_WUPS_TITLE_WII_U, /* Year Walk (EUR) */ },
-  { 0x00050000101D4C00, CL_WUPS_TITLE_WII_U, /* Sketch Wars (USA) */ },
-  { 0x00050000101D4D00, CL_WUPS_TITLE_WII_U, /* Joe's Diner (EUR) */ },
-  { 0x00050000101D4E00, CL_WUPS_TITLE_WII_U, /* Jones on Fire (EUR) */ },
-  { 0x00050000101D5000, CL_WUPS_TITLE_WII_U, /* The Peanuts® Movie: Snoopy's Grand Adventure (EUR) */ },
-  { 0x00050000101D5100, CL_WUPS_TITLE_WII_U, /* Stone Shire (EUR) */ },
-  { 0x00050000101D5300, CL_WUPS_TITLE_WII_U, /* Cutie Pets Pick Berries (USA) */ },
-  { 0x00050000101D5500, CL_WUPS_TITLE_WII_U, /* Joe's Diner (USA) */ },
-  { 0x00050000101D5600, CL_WUPS_TITLE_WII_U, /* Jones on Fire (USA) */ },
-  { 0x00050000101D5800, CL_WUPS_TITLE_GBA, /* Rayman 3 (EUR) */ },
-  { 0x00050000101D5900, CL_WUPS_TITLE_GBA, /* Rayman 3 (USA) */ },
-  { 0x00050000101D5A00, CL_WUPS_TITLE_GBA, /* Rayman Advance (EUR) */ },
-  { 0x00050000101D5B00, CL_WUPS_TITLE_GBA, /* Rayman Advance (USA) */ },
-  { 0x00050000101D5C00, CL_WUPS_TITLE_GBA, /* ファイナルファンタジーVI アドバンス (Final Fantasy VI Advance) (JPN) */ },
-  { 0x00050000101D5D00, CL_WUPS_TITLE_GBA, /* ファイナルファンタジーV アドバンス (Final Fantasy V Advance) (JPN) */ },
-  { 0x00050000101D5E00, CL_WUPS_TITLE_GBA, /* ファイナルファンタジーIV アドバンス (Final Fantasy IV Advance) (JPN) */ },
-  { 0x00050000101D5F00, CL_WUPS_TITLE_WII_U, /* FreezeME (USA) */ },
-  { 0x00050000101D6000, CL_WUPS_TITLE_WII_U, /* FAST Racing NEO (EUR) */ },
-  { 0x00050000101D6100, CL_WUPS_TITLE_WII_U, /* Gunman Clive HD Collection (EUR) */ },
-  { 0x00050000101D6200, CL_WUPS_TITLE_WII_U, /* Test Your Mind (USA) */ },
-  { 0x00050000101D6300, CL_WUPS_TITLE_WII_U, /* Ascent of Kings (USA) */ },
-  { 0x00050000101D6400, CL_WUPS_TITLE_WII_U, /* Kung Fu FIGHT! (USA) */ },
-  { 0x00050000101D6700, CL_WUPS_TITLE_WII_U, /* Star Sky (EUR) */ },
-  { 0x00050000101D6A00, CL_WUPS_TITLE_WII_U, /* Splatoon（スプラトゥーン） 試射版 (Splatoon Testfire) (JPN) */ },
-  { 0x00050000101D6B00, CL_WUPS_TITLE_WII_U, /* Splatoon Testfire (USA) */ },
-  { 0x00050000101D6C00, CL_WUPS_TITLE_WII_U, /* Splatoon Testfire (EUR) */ },
-  { 0x00050000101D6D00, CL_WUPS_TITLE_WII_U, /* Runbow (EUR) */ },
-  { 0x00050000101D6E00, CL_WUPS_TITLE_WII_U, /* Now I know my ABCs (USA) */ },
-  { 0x00050000101D6F00, CL_WUPS_TITLE_WII_U, /* Cutie Clash (USA) */ },
-  { 0x00050000101D7300, CL_WUPS_TITLE_WII_U, /* Molly Maggot (USA) */ },
-  { 0x00050000101D7400, CL_WUPS_TITLE_WII_U, /* Totem Topple (EUR) */ },
-  { 0x00050000101D7500, CL_WUPS_TITLE_WII_U, /* Minecraft: Wii U Edition (EUR) */ },
-  { 0x00050000101D7600, CL_WUPS_TITLE_WII_U, /* Slots - Pharaoh's Riches (USA) */ },
-  { 0x00050000101D7700, CL_WUPS_TITLE_WII_U, /* Explody Bomb (USA) */ },
-  { 0x00050000101D7800, CL_WUPS_TITLE_WII_U, /* Hold Your Fire (USA) */ },
-  { 0x00050000101D7A00, CL_WUPS_TITLE_WII_U, /* 6-HAND VIDEO POKER (USA) */ },
-  { 0x00050000101D7E00, CL_WUPS_TITLE_WII_U, /* Mini-Games Madness Vol #1 (USA) */ },
-  { 0x00050000101D7F00, CL_WUPS_TITLE_WII_U, /* 153 Hand Video Poker (USA) */ },
-  { 0x00050000101D8000, CL_WUPS_TITLE_WII_U, /* Q.U.B.E: Director's Cut (USA) */ },
-  { 0x00050000101D8300, CL_WUPS_TITLE_WII_U, /* Electronic Super Joy (EUR) */ },
-  { 0x00050000101D8900, CL_WUPS_TITLE_WII_U, /* Slender: The Arrival (EUR) */ },
-  { 0x00050000101D8A00, CL_WUPS_TITLE_WII_U, /* Star Sky (USA) */ },
-  { 0x00050000101D8B00, CL_WUPS_TITLE_WII_U, /* ヒラメキパズル テトグラム (Pentapuzzle) (JPN) */ },
-  { 0x00050000101D8C00, CL_WUPS_TITLE_WII_U, /* ブルームーン (Star Sky) (JPN) */ },
-  { 0x00050000101D8D00, CL_WUPS_TITLE_WII_U, /* Rock 'N Racing Off Road DX (USA) */ },
-  { 0x00050000101D8F00, CL_WUPS_TITLE_WII_U, /* LOST REAVERS BETA TEST VERSION (USA) */ },
-  { 0x00050000101D9100, CL_WUPS_TITLE_WII_U, /* Dragon Skills (USA) */ },
-  { 0x00050000101D9200, CL_WUPS_TITLE_WII_U, /* The Rivers of Alice : Extended Version (EUR) */ },
-  { 0x00050000101D9300, CL_WUPS_TITLE_WII_U, /* ショベルナイト (Shovel Knight) (JPN) */ },
-  { 0x00050000101D9500, CL_WUPS_TITLE_WII_U, /* STEEL RIVALS (USA) */ },
-  { 0x00050000101D9600, CL_WUPS_TITLE_WII_U, /* Rock 'N Racing Off Road DX (EUR) */ },
-  { 0x00050000101D9700, CL_WUPS_TITLE_WII_U, /* Kick & Fennick (EUR) */ },
-  { 0x00050000101D9900, CL_WUPS_TITLE_GBA, /* ファイナルファンタジータクティクス アドバンス (Final Fantasy Tactics Advance) (JPN) */ },
-  { 0x00050000101D9B00, CL_WUPS_TITLE_WII_U, /* Discovery (USA) */ },
-  { 0x00050000101D9C00, CL_WUPS_TITLE_WII_U, /* Funky Physics (USA) */ },
-  { 0x00050000101D9D00, CL_WUPS_TITLE_WII_U, /* Minecraft: Wii U Edition (USA) */ },
-  { 0x00050000101D9E00, CL_WUPS_TITLE_WII_U, /* Bike Rider UltraDX WORLD TOUR (EUR) */ },
-  { 0x00050000101D9F00, CL_WUPS_TITLE_WII_U, /* Job the Leprechaun (EUR) */ },
-  { 0x00050000101DA100, CL_WUPS_TITLE_NDS, /* マリオバスケ 3on3 (Mario Hoops 3-on-3) (JPN) */ },
-  { 0x00050000101DA200, CL_WUPS_TITLE_NDS, /* Mario Hoops 3-on-3 (USA) */ },
-  { 0x00050000101DA300, CL_WUPS_TITLE_NDS, /* Mario Slam Basketball (EUR) */ },
-  { 0x00050000101DA400, CL_WUPS_TITLE_NDS, /* ファミコンウォーズDS (Advance Wars: Dual Strike) (JPN) */ },
-  { 0x00050000101DA500, CL_WUPS_TITLE_NDS, /* Advance Wars: Dual Strike (USA) */ },
-  { 0x00050000101DA600, CL_WUPS_TITLE_NDS, /* Advance Wars: Dual Strike (EUR) */ },
-  { 0x00050000101DA700, CL_WUPS_TITLE_N64, /* ポケモンスナップ (Pokémon Snap) (JPN) */ },
-  { 0x00050000101DA800, CL_WUPS_TITLE_N64, /* Pokémon Snap (USA) */ },
-  { 0x00050000101DA900, CL_WUPS_TITLE_N64, /* Pokémon Snap (EUR) */ },
-  { 0x00050000101DAA00, CL_WUPS_TITLE_WII_U, /* LEGO® STAR WARS™ The Force Awakens (EUR) */ },
-  { 0x00050000101DAB00, CL_WUPS_TITLE_WII_U, /* LEGO® STAR WARS™ The Force Awakens (USA) */ },
-  { 0x00050000101DAC00, CL_WUPS_TITLE_WII_U, /* Swap Fire (USA) */ },
-  { 0x00050000101DAD00, CL_WUPS_TITLE_WII_U, /* Tumblestone (USA) */ },
-  { 0x00050000101DAF00, CL_WUPS_TITLE_WII_U, /* Chronicles of Teddy Harmony of Exidus (EUR) */ },
-  { 0x00050000101DB000, CL_WUPS_TITLE_WII_U, /* Oddworld New 'n' Tasty (USA) */ },
-  { 0x00050000101DB100, CL_WUPS_TITLE_WII_U, /* PictoParty (USA) */ },
-  { 0x00050000101DB200, CL_WUPS_TITLE_WII_U, /* Shantae: Half-Genie Hero (USA) */ },
-  { 0x00050000101DB600, CL_WUPS_TITLE_WII_U, /* タイニーシーフ (Tiny Thief) (JPN) */ },
-  { 0x00050000101DB800, CL_WUPS_TITLE_WII_U, /* VoxelMaker (USA) */ },
-  { 0x00050000101DBB00, CL_WUPS_TITLE_WII_U, /* Oddworld New 'n' Tasty (EUR) */ },
-  { 0x00050000101DBC00, CL_WUPS_TITLE_WII_U, /* Star Ghost (EUR) */ },
-  { 0x00050000101DBE00, CL_WUPS_TITLE_WII_U, /* Minecraft: Wii U Edition (JPN) */ },
-  { 0x00050000101DBF00, CL_WUPS_TITLE_WII_U, /* Angry Video Game Nerd Adventures (EUR) */ },
-  { 0x00050000101DC000, CL_WUPS_TITLE_WII_U, /* Vektor Wars (USA) */ },
-  { 0x00050000101DC100, CL_WUPS_TITLE_WII_U, /* Octodad: Dadliest Catch (EUR) */ },
-  { 0x00050000101DC200, CL_WUPS_TITLE_WII_U, /* Vektor Wars (EUR) */ },
-  { 0x00050000101DC300, CL_WUPS_TITLE_WII_U, /* Kick and Fennick (USA) */ },
-  { 0x00050000101DCA00, CL_WUPS_TITLE_WII_U, /* VoxelMaker (EUR) */ },
-  { 0x00050000101DCC00, CL_WUPS_TITLE_WII_U, /* スターフォックス　ガード 特別体験版 (Star Fox Guard Special Demo) (JPN) */ },
-  { 0x00050000101DCD00, CL_WUPS_TITLE_WII_U, /* Star Fox Guard Special Demo (USA) */ },
-  { 0x00050000101DCE00, CL_WUPS_TITLE_WII_U, /* Star Fox Guard: Special Demo Version (EUR) */ },
-  { 0x00050000101DCF00, CL_WUPS_TITLE_WII_U, /* Perpetual Blast (USA) */ },
-  { 0x00050000101DD000, CL_WUPS_TITLE_WII_U, /* Star Ghost (USA) */ },
-  { 0x00050000101DD300, CL_WUPS_TITLE_WII_U, /* Rock 'N Racing Off Road (JPN) */ },
-  { 0x00050000101DD400, CL_WUPS_TITLE_WII_U, /* Fullblast (JPN) */ },
-  { 0x00050000101DD500, CL_WUPS_TITLE_WII_U, /* エリエットクエスト (Elliot Quest) (JPN) */ },
-  { 0x00050000101DD600, CL_WUPS_TITLE_WII_U, /* Bit Trip Presents...  Runner2 リズム星人の爆走 (JPN) */ },
-  { 0x00050000101DD700, CL_WUPS_TITLE_WII_U, /* Runbow (JPN) */ },
-  { 0x00050000101DD900, CL_WUPS_TITLE_WII_U, /* Mighty No. 9 (JPN) */ },
-  { 0x00050000101DDA00, CL_WUPS_TITLE_WII_U, /* ガンマンストーリーHDコレクション (Gunman Story HD Collection) (JPN) */ },
-  { 0x00050000101DDC00, CL_WUPS_TITLE_WII_U, /* ディズニーインフィニティ3.0 (Disney INFINITY 3.0) (JPN) */ },
-  { 0x00050000101DDD00, CL_WUPS_TITLE_WII_U, /* Swords & Soldiers II (JPN) */ },
-  { 0x00050000101DDF00, CL_WUPS_TITLE_WII_U, /* Hive Jump (USA) */ },
-  { 0x00050000101DE000, CL_WUPS_TITLE_WII_U, /* Chroma Blast (USA) */ },
-  { 0x00050000101DE400, CL_WUPS_TITLE_WII_U, /* ザ　バインディング　オブ アイザック：リバース (The Binding of Isaac: Rebirth) (JPN) */ },
-  { 0x00050000101DE500, CL_WUPS_TITLE_WII_U, /* 1001 Spikes (JPN) */ },
-  { 0x00050000101DE700, CL_WUPS_TITLE_WII_U, /* Cutie Pets Jump Rope (USA) */ },
-  { 0x00050000101DEE00, CL_WUPS_TITLE_WII_U, /* AVOIDER (USA) */ },
-  { 0x00050000101DF400, CL_WUPS_TITLE_WII_U, /* POKKÉN TOURNAMENT (USA) */ },
-  { 0x00050000101DF500, CL_WUPS_TITLE_WII_U, /* POKKÉN TOURNAMENT (EUR) */ },
-  { 0x00050000101DFA00, CL_WUPS_TITLE_WII_U, /* Draw 2 Survive (USA) */ },
-  { 0x00050000101DFD00, CL_WUPS_TITLE_WII_U, /* Snowball (USA) */ },
-  { 0x00050000101DFE00, CL_WUPS_TITLE_WII_U, /* ニヒラブラ (Nihilumbra) (JPN) */ },
-  { 0x00050000101DFF00, CL_WUPS_TITLE_WII_U, /* プチコンBIG (Petitcom BIG) (JPN) */ },
-  { 0x00050000101E0000, CL_WUPS_TITLE_WII_U, /* U-EXPLORE SPACE ADVENTURES (JPN) */ },
-  { 0x00050000101E0100, CL_WUPS_TITLE_WII_U, /* Minecraft Story Mode (USA) */ },
-  { 0x00050000101E0600, CL_WUPS_TITLE_NDS, /* FINAL FANTASY TACTICS ADVANCE (EUR) */ },
-  { 0x00050000101E0700, CL_WUPS_TITLE_NDS, /* FINAL FANTASY Tactics Advance (USA) */ },
-  { 0x00050000101E0900, CL_WUPS_TITLE_WII_U, /* Lovely Planet (USA) */ },
-  { 0x00050000101E0A00, CL_WUPS_TITLE_WII_U, /* Lovely Planet (EUR) */ },
-  { 0x00050000101E0C00, CL_WUPS_TITLE_NDS, /* ポケモン不思議のダンジョン 空の探検隊 (Pokémon Mystery Dungeon: Explorers of Sky) (JPN) */ },
-  { 0x00050000101E0D00, CL_WUPS_TITLE_NDS, /* Pokémon Mystery Dungeon: Explorers of Sky (USA) */ },
-  { 0x00050000101E0E00, CL_WUPS_TITLE_NDS, /* Pokémon Mystery Dungeon: Explorers of Sky (EUR) */ },
-  { 0x00050000101E0F00, CL_WUPS_TITLE_NDS, /* ポケモンレンジャー バトナージ (Pokémon Ranger: Shadow of Almia) (JPN) */ },
-  { 0x00050000101E1000, CL_WUPS_TITLE_NDS, /* Pokémon Ranger: Shadows of Almia (USA) */ },
-  { 0x00050000101E1100, CL_WUPS_TITLE_NDS, /* Pokémon Ranger: Shadows of Almia (EUR) */ },
-  { 0x00050000101E1200, CL_WUPS_TITLE_WII_U, /* PixelJunk Monsters (EUR) */ },
-  { 0x00050000101E1300, CL_WUPS_TITLE_WII_U, /* Frag doch mal...die Maus! (EUR) */ },
-  { 0x00050000101E1500, CL_WUPS_TITLE_WII_U, /* Fire (EUR) */ },
-  { 0x00050000101E1800, CL_WUPS_TITLE_WII_U, /* Human Resource Machine (USA) */ },
-  { 0x00050000101E1900, CL_WUPS_TITLE_WII_U, /* Rynn's Adventure: Trouble in the Enchanted Forest (USA) */ },
-  { 0x00050000101E1A00, CL_WUPS_TITLE_WII_U, /* Human Resource Machine (EUR) */ },
-  { 0x00050000101E1B00, CL_WUPS_TITLE_WII_U, /* Shadow Puppeteer (EUR) */ },
-  { 0x00050000101E1E00, CL_WUPS_TITLE_WII_U, /* PSIBO (USA) */ },
-  { 0x00050000101E1F00, CL_WUPS_TITLE_WII_U, /* B3 Game Expo For Bees (USA) */ },
-  { 0x00050000101E2200, CL_WUPS_TITLE_TG16, /* 改造町人シュビビンマン (Kaizou Chounin Shubibinman) (JPN) */ },
-  { 0x00050000101E2300, CL_WUPS_TITLE_TG16, /* うさぎの国のカンガルーレース ワラビー!! (Wallaby) (JPN) */ },
-  { 0x00050000101E2400, CL_WUPS_TITLE_TG16, /* ガイフレーム (GAI FLAME) (JPN) */ },
-  { 0x00050000101E2500, CL_WUPS_TITLE_TG16, /* モトローダーII (MOTOROADER II) (JPN) */ },
-  { 0x00050000101E2600, CL_WUPS_TITLE_TG16, /* ラングリッサー ～光輝の末裔～ (Langrisser) (JPN) */ },
-  { 0x00050000101E2700, CL_WUPS_TITLE_TG16, /* 改造町人シュビビンマン3 －異界のプリンセス－ (Kaizou Chounin Shubibinman 3 Ikai no Princess) (JPN) */ },
-  { 0x00050000101E2800, CL_WUPS_TITLE_TG16, /* 超兄貴 (Cho-Aniki) (JPN) */ },
-  { 0x00050000101E2900, CL_WUPS_TITLE_TG16, /* 愛・超兄貴 (Ai Cho-Aniki) (JPN) */ },
-  { 0x00050000101E2C00, CL_WUPS_TITLE_WII_U, /* Bit Dungeon+ (EUR) */ },
-  { 0x00050000101E2D00, CL_WUPS_TITLE_WII_U, /* REPLAY : VHS IS NOT DEAD (EUR) */ },
-  { 0x00050000101E2E00, CL_WUPS_TITLE_WII_U, /* Christmas Adventure of Rocket P. (USA) */ },
-  { 0x00050000101E3000, CL_WUPS_TITLE_WII_U, /* REPLAY : VHS IS NOT DEAD (USA) */ },
-  { 0x00050000101E3200, CL_WUPS_TITLE_WII_U, /* Jewel Quest (USA) */ },
-  { 0x00050000101E3300, CL_WUPS_TITLE_WII_U, /* Olympia Rising (EUR) */ },
-  { 0x00050000101E3400, CL_WUPS_TITLE_WII_U, /* Olympia Rising (USA) */ },
-  { 0x00050000101E3500, CL_WUPS_TITLE_WII_U, /* Spheroids (EUR) */ },
-  { 0x00050000101E3600, CL_WUPS_TITLE_WII_U, /* Spheroids (USA) */ },
-  { 0x00050000101E3700, CL_WUPS_TITLE_WII_U, /* Cutie Pets Go Fishing (USA) */ },
-  { 0x00050000101E3800, CL_WUPS_TITLE_WII_U, /* Dual Core (USA) */ },
-  { 0x00050000101E4000, CL_WUPS_TITLE_WII_U, /* アスディバインハーツ (Asdivine Hearts) (JPN) */ },
-  { 0x00050000101E4100, CL_WUPS_TITLE_WII_U, /* FAST Racing NEO (JPN) */ },
-  { 0x00050000101E4200, CL_WUPS_TITLE_WII_U, /* Master Reboot (JPN) */ },
-  { 0x00050000101E4300, CL_WUPS_TITLE_WII_U, /* モモンガ ピンボール アドベンチャー (Momonga Pinball Adventures) (JPN) */ },
-  { 0x00050000101E4800, CL_WUPS_TITLE_WII_U, /* Sudoku and Permudoku (USA) */ },
-  { 0x00050000101E4B00, CL_WUPS_TITLE_WII_U, /* Bird Mania Party (EUR) */ },
-  { 0x00050000101E4C00, CL_WUPS_TITLE_WII_U, /* Bird Mania Party (USA) */ },
-  { 0x00050000101E5000, CL_WUPS_TITLE_WII_U, /* The Gem Collector (USA) */ },
-  { 0x00050000101E5300, CL_WUPS_TITLE_WII_U, /* マリオ＆ソニック ＡＴ リオオリンピック (Mario & Sonic at the Rio 2016 Olympic Games) (USA) */ },
-  { 0x00050000101E5400, CL_WUPS_TITLE_WII_U, /* Mario & Sonic at the Rio 2016 Olympic Games (EUR) */ },
-  { 0x00050000101E5500, CL_WUPS_TITLE_WII_U, /* Escape From Flare Industries (USA) */ },
-  { 0x00050000101E5600, CL_WUPS_TITLE_WII_U, /* Adventures of Pip (EUR) */ },
-  { 0x00050000101E5800, CL_WUPS_TITLE_WII_U, /* Inside My Radio (EUR) */ },
-  { 0x00050000101E5A00, CL_WUPS_TITLE_WII_U, /* Inside My Radio (USA) */ },
-  { 0x00050000101E5E00, CL_WUPS_TITLE_WII_U, /* Chasing Dead (EUR) */ },
-  { 0x00050000101E6200, CL_WUPS_TITLE_WII_U, /* Shooting Range (USA) */ },
-  { 0x00050000101E6300, CL_WUPS_TITLE_WII_U, /* Archery (USA) */ },
-  { 0x00050000101E6400, CL_WUPS_TITLE_N64, /* エキサイトバイク64 (Excitebike 64) (JPN) */ },
-  { 0x00050000101E6500, CL_WUPS_TITLE_N64, /* Excitebike 64 (EUR/USA) */ },
-  { 0x00050000101E6600, CL_WUPS_TITLE_N64, /* オウガバトル64 (Ogre Battle 64) (JPN) */ },
-  { 0x00050000101E6700, CL_WUPS_TITLE_N64, /* Ogre Battle 64: Person of Lordly Caliber (EUR/USA) */ },
-  { 0x00050000101E6800, CL_WUPS_TITLE_NDS, /* わがままファッション GIRLS MODE (Style Boutique) (JPN) */ },
-  { 0x00050000101E6900, CL_WUPS_TITLE_NDS, /* Style Savvy (USA) */ },
-  { 0x00050000101E6A00, CL_WUPS_TITLE_NDS, /* Nintendo presents: Style Boutique (EUR) */ },
-  { 0x00050000101E6C00, CL_WUPS_TITLE_NDS, /* 立体ピクロス (Picross 3D) (JPN) */ },
-  { 0x00050000101E6D00, CL_WUPS_TITLE_NDS, /* Picross 3D (USA) */ },
-  { 0x00050000101E6E00, CL_WUPS_TITLE_NDS, /* Picross 3D (EUR) */ },
-  { 0x00050000101E6F00, CL_WUPS_TITLE_NDS, /* ポケモンレンジャー 光の軌跡 (Pokémon Ranger: Guardian Signs) (JPN) */ },
-  { 0x00050000101E7000, CL_WUPS_TITLE_NDS, /* Pokémon Ranger: Guardian Signs (USA) */ },
-  { 0x00050000101E7100, CL_WUPS_TITLE_NDS, /* Pokémon Ranger: Guardian Signs (EUR) */ },
-  { 0x00050000101E7300, CL_WUPS_TITLE_WII_U, /* The Deer God (USA) */ },
-  { 0x00050000101E7400, CL_WUPS_TITLE_WII_U, /* Grumpy Reaper (EUR) */ },
-  { 0x00050000101E7500, CL_WUPS_TITLE_WII_U, /* Dragon Skills (EUR) */ },
-  { 0x00050000101E7800, CL_WUPS_TITLE_WII_U, /* SKEASY (USA) */ },
-  { 0x00050000101E7900, CL_WUPS_TITLE_WII_U, /* SPLASHY DUCK (USA) */ },
-  { 0x00050000101E7B00, CL_WUPS_TITLE_WII_U, /* Asdivine Hearts (USA) */ },
-  { 0x00050000101E7C00, CL_WUPS_TITLE_WII_U, /* TAP TAP ARCADE (EUR) */ },
-  { 0x00050000101E7D00, CL_WUPS_TITLE_WII_U, /* TAP TAP ARCADE (USA) */ },
-  { 0x00050000101E7E00, CL_WUPS_TITLE_WII_U, /* TOUCH SELECTIONS (EUR) */ },
-  { 0x00050000101E7F00, CL_WUPS_TITLE_WII_U, /* TOUCH SELECTIONS (USA) */ },
-  { 0x00050000101E8000, CL_WUPS_TITLE_WII_U, /* FreezeME (EUR) */ },
-  { 0x00050000101E8300, CL_WUPS_TITLE_WII_U, /* Discovery (EUR) */ },
-  { 0x00050000101E8400, CL_WUPS_TITLE_WII_U, /* Dying Is Dangerous (EUR) */ },
-  { 0x00050000101E8500, CL_WUPS_TITLE_WII_U, /* TEMPLE OF YOG (EUR) */ },
-  { 0x00050000101E8800, CL_WUPS_TITLE_WII_U, /* COLOR BOMBS (EUR) */ },
-  { 0x00050000101E8900, CL_WUPS_TITLE_WII_U, /* Sudoku & Permudoku (EUR) */ },
-  { 0x00050000101E8A00, CL_WUPS_TITLE_WII_U, /* Ascent of Kings (EUR) */ },
-  { 0x00050000101E8B00, CL_WUPS_TITLE_WII_U, /* Kung Fu FIGHT! (EUR) */ },
-  { 0x00050000101E8D00, CL_WUPS_TITLE_WII_U, /* Futuridium EP Deluxe (EUR) */ },
-  { 0x00050000101E8E00, CL_WUPS_TITLE_WII_U, /* Futuridium EP Deluxe (USA) */ },
-  { 0x00050000101E9300, CL_WUPS_TITLE_WII_U, /* Gear Gauntlet (USA) */ },
-  { 0x00050000101E9400, CL_WUPS_TITLE_WII_U, /* Gear Gauntlet (EUR) */ },
-  { 0x00050000101E9500, CL_WUPS_TITLE_WII_U, /* Humanitarian Helicopter (USA) */ },
-  { 0x00050000101E9700, CL_WUPS_TITLE_WII_U, /* U Host (EUR) */ },
-  { 0x00050000101E9A00, CL_WUPS_TITLE_WII_U, /* Astral Breakers (JPN) */ },
-  { 0x00050000101E9B00, CL_WUPS_TITLE_WII_U, /* Ninja Pizza Girl (JPN) */ },
-  { 0x00050000101E9C00, CL_WUPS_TITLE_WII_U, /* キューブライフ： アイランドサバイバル (Cube Life Island Survival) (JPN) */ },
-  { 0x00050000101E9F00, CL_WUPS_TITLE_WII_U, /* The Book of Unwritten Tales 2 (EUR) */ },
-  { 0x00050000101EA000, CL_WUPS_TITLE_WII_U, /* LEGO®スター・ウォーズ／ フォースの覚醒 (LEGO® STAR WARS™ The Force Awakens) (JPN) */ },
-  { 0x00050000101EA100, CL_WUPS_TITLE_WII_U, /* LEGO®マーベル アベンジャーズ (LEGO® MARVEL's Avengers) (JPN) */ },
-  { 0x00050000101EA200, CL_WUPS_TITLE_WII_U, /* The Book of Unwritten Tales 2 (USA) */ },
-  { 0x00050000101EA400, CL_WUPS_TITLE_WII_U, /* A Day at the Carnival by Thornbury Software LLC (USA) */ },
-  { 0x00050000101EA500, CL_WUPS_TITLE_WII_U, /* Noitu Love: Devolution (USA) */ },
-  { 0x00050000101EA900, CL_WUPS_TITLE_WII_U, /* Armored ACORNs: Action Squirrel Squad (USA) */ },
-  { 0x00050000101EAA00, CL_WUPS_TITLE_WII_U, /* JUST DANCE® 2017 (EUR) */ },
-  { 0x00050000101EAB00, CL_WUPS_TITLE_WII_U, /* Dreamals (EUR) */ },
-  { 0x00050000101EAE00, CL_WUPS_TITLE_WII_U, /* Lucentek Beyond (USA) */ },
-  { 0x00050000101EAF00, CL_WUPS_TITLE_WII_U, /* Color Symphony 2 (USA) */ },
-  { 0x00050000101EB200, CL_WUPS_TITLE_WII_U, /* JUST DANCE® 2017 (USA) */ },
-  { 0x00050000101EB300, CL_WUPS_TITLE_WII_U, /* The Beggar's Ride (USA) */ },
-  { 0x00050000101EB400, CL_WUPS_TITLE_WII_U, /* Volcanic Field 2 (USA) */ },
-  { 0x00050000101EB500, CL_WUPS_TITLE_WII_U, /* DREAMALS (USA) */ },
-  { 0x00050000101EB600, CL_WUPS_TITLE_WII_U, /* ACT IT OUT! A Game of Charades (EUR) */ },
-  { 0x00050000101EB700, CL_WUPS_TITLE_WII_U, /* Color Symphony 2 (EUR) */ },
-  { 0x00050000101EBB00, CL_WUPS_TITLE_N64, /* F-ZERO X (JPN) */ },
-  { 0x00050000101EBC00, CL_WUPS_TITLE_N64, /* F-Zero X (EUR/USA) */ },
-  { 0x00050000101EBD00, CL_WUPS_TITLE_WII, /* ピクミン２ (Pikmin 2) (JPN) */ },
-  { 0x00050000101EBE00, CL_WUPS_TITLE_WII, /* PIKMIN 2 (USA) */ },
-  { 0x00050000101EBF00, CL_WUPS_TITLE_WII, /* PIKMIN 2 (EUR) */ },
-  { 0x00050000101EC000, CL_WUPS_TITLE_WII, /* ピクミン (Pikmin) (JPN) */ },
-  { 0x00050000101EC100, CL_WUPS_TITLE_WII, /* PIKMIN (USA) */ },
-  { 0x00050000101EC200, CL_WUPS_TITLE_WII, /* PIKMIN (EUR) */ },
-  { 0x00050000101EC500, CL_WUPS_TITLE_WII_U, /* ACT IT OUT! A Game of Charades (USA) */ },
-  { 0x00050000101EC600, CL_WUPS_TITLE_WII_U, /* Defense Dome (EUR) */ },
-  { 0x00050000101EC700, CL_WUPS_TITLE_WII_U, /* The Beggar's Ride (EUR) */ },
-  { 0x00050000101EC900, CL_WUPS_TITLE_WII, /* おどるメイドインワリオ (Wario Ware Smooth Moves) (JPN) */ },
-  { 0x00050000101ECA00, CL_WUPS_TITLE_WII, /* WARIO WARE : SMOOTH MOVES (USA) */ },
-  { 0x00050000101ECB00, CL_WUPS_TITLE_WII, /* WARIO WARE : SMOOTH MOVES (EUR) */ },
-  { 0x00050000101ECC00, CL_WUPS_TITLE_WII, /* バイオハザード  アンブレラ・クロニクルズ (Resident Evil: The Umbrella Chronicles) (JPN) */ },
-  { 0x00050000101ECD00, CL_WUPS_TITLE_WII, /* Resident Evil: The Umbrella Chronicles (USA) */ },
-  { 0x00050000101ECF00, CL_WUPS_TITLE_WII_U, /* Buddy & Me: Dream Edition (USA) */ },
-  { 0x00050000101ED000, CL_WUPS_TITLE_WII_U, /* SpaceRoads (USA) */ },
-  { 0x00050000101ED100, CL_WUPS_TITLE_WII, /* Wiiであそぶ ドンキーコングジャングルビート (Donkey Kong Jungle Beat) (JPN) */ },
-  { 0x00050000101ED200, CL_WUPS_TITLE_WII, /* DONKEY KONG JUNGLE BEAT (USA) */ },
-  { 0x00050000101ED300, CL_WUPS_TITLE_WII, /* DONKEY KONG JUNGLE BEAT (EUR) */ },
-  { 0x00050000101ED600, CL_WUPS_TITLE_WII_U, /* SphereZor (USA) */ },
-  { 0x00050000101ED700, CL_WUPS_TITLE_WII_U, /* Tokyo Mirage Sessions ♯FE (EUR) */ },
-  { 0x00050000101ED800, CL_WUPS_TITLE_WII_U, /* Tokyo Mirage Sessions #FE (USA) */ },
-  { 0x00050000101EF400, CL_WUPS_TITLE_WII_U, /* Demonic Karma Summoner (USA) */ },
-  { 0x00050000101EF500, CL_WUPS_TITLE_WII_U, /* Emojikara: A Clever Emoji Match Game (USA) */ },
-  { 0x00050000101EFF00, CL_WUPS_TITLE_WII_U, /* Asdivine Hearts (EUR) */ },
-  { 0x00050000101F0200, CL_WUPS_TITLE_WII_U, /* Back to Bed (USA) */ },
-  { 0x00050000101F0300, CL_WUPS_TITLE_WII_U, /* Star Splash: Shattered Star (USA) */ },
-  { 0x00050000101F0A00, CL_WUPS_TITLE_WII_U, /* バンダイナムコからのお届け物 (Lost Reaver Notice) (JPN) */ },
-  { 0x00050000101F0B00, CL_WUPS_TITLE_WII_U, /* Quest of Dungeons (EUR) */ },
-  { 0x00050000101F0D00, CL_WUPS_TITLE_WII, /* Rayman Raving Rabbids (USA) */ },
-  { 0x00050000101F0E00, CL_WUPS_TITLE_WII, /* Rayman Raving Rabbids (EUR) */ },
-  { 0x00050000101F0F00, CL_WUPS_TITLE_WII_U, /* Paranautical Activity (EUR) */ },
-  { 0x00050000101F1100, CL_WUPS_TITLE_WII_U, /* Noitu Love: Devolution (EUR) */ },
-  { 0x00050000101F1300, CL_WUPS_TITLE_WII_U, /* Armikrog (USA) */ },
-  { 0x00050000101F1400, CL_WUPS_TITLE_WII_U, /* Quest of Dungeons (USA) */ },
-  { 0x00050000101F1600, CL_WUPS_TITLE_WII_U, /* STEEL RIVALS (EUR) */ },
-  { 0x00050000101F2700, CL_WUPS_TITLE_WII_U, /* Star Sky 2 (EUR) */ },
-  { 0x00050000101F2800, CL_WUPS_TITLE_WII_U, /* 8Bit Hero (USA) */ },
-  { 0x00050000101F2A00, CL_WUPS_TITLE_WII_U, /* Mahjong Deluxe 3 (USA) */ },
-  { 0x00050000101F2B00, CL_WUPS_TITLE_WII_U, /* Miko Mole (USA) */ },
-  { 0x00050000101F2C00, CL_WUPS_TITLE_WII_U, /* MOP Operation Clean up (USA) */ },
-  { 0x00050000101F2D00, CL_WUPS_TITLE_WII_U, /* Run Run and Die (USA) */ },
-  { 0x00050000101F3A00, CL_WUPS_TITLE_WII_U, /* テラリア (Terraria) (JPN) */ },
-  { 0x00050000101F3E00, CL_WUPS_TITLE_WII_U, /* Star Sky 2 (USA) */ },
-  { 0x00050000101F3F00, CL_WUPS_TITLE_WII_U, /* Super Meat Boy (USA) */ },
-  { 0x00050000101F4000, CL_WUPS_TITLE_WII_U, /* Super Meat Boy (EUR) */ },
-  { 0x00050000101F4200, CL_WUPS_TITLE_WII_U, /* Queen's Garden (EUR) */ },
-  { 0x00050000101F4300, CL_WUPS_TITLE_WII_U, /* Sweetest Thing (EUR) */ },
-  { 0x00050000101F4700, CL_WUPS_TITLE_WII_U, /* Queen's Garden (USA) */ },
-  { 0x00050000101F4800, CL_WUPS_TITLE_WII_U, /* Sweetest Thing (USA) */ },
-  { 0x00050000101F4900, CL_WUPS_TITLE_WII_U, /* Tallowmere (USA) */ },
-  { 0x00050000101F4A00, CL_WUPS_TITLE_WII_U, /* Buddy & Me: Dream Edition (EUR) */ },
-  { 0x00050000101F4C00, CL_WUPS_TITLE_WII_U, /* Reptilian Rebellion (USA) */ },
-  { 0x00050000101F4D00, CL_WUPS_TITLE_WII_U, /* Skylanders™ Imaginators (USA) */ },
-  { 0x00050000101F4F00, CL_WUPS_TITLE_WII_U, /* Dracula's Legacy (EUR) */ },
-  { 0x00050000101F5000, CL_WUPS_TITLE_WII_U, /* Dracula's Legacy (USA) */ },
-  { 0x00050000101F5400, CL_WUPS_TITLE_WII_U, /* Reptilian Rebellion (EUR) */ },
-  { 0x00050000101F5500, CL_WUPS_TITLE_WII_U, /* Letter Quest Grimm's Journey Remastered (USA) */ },
-  { 0x00050000101F5700, CL_WUPS_TITLE_WII_U, /* Jotun: Valhalla Edition (USA) */ },
-  { 0x00050000101F5900, CL_WUPS_TITLE_WII_U, /* PENTAPUZZLE (EUR) */ },
-  { 0x00050000101F5A00, CL_WUPS_TITLE_WII_U, /* Defend Your Crypt (EUR) */ },
-  { 0x00050000101F5D00, CL_WUPS_TITLE_WII_U, /* PixelMaker (USA) */ },
-  { 0x00050000101F5E00, CL_WUPS_TITLE_WII_U, /* Defend your Crypt (USA) */ },
-  { 0x00050000101F5F00, CL_WUPS_TITLE_WII_U, /* Hot Rod Racer (USA) */ },
-  { 0x00050000101F6000, CL_WUPS_TITLE_WII_U, /* SURFIN' SAM ATTACK OF THE AQUALITES (USA) */ },
-  { 0x00050000101F6200, CL_WUPS_TITLE_WII_U, /* Adventure Party Cats and Caverns (USA) */ },
-  { 0x00050000101F6300, CL_WUPS_TITLE_WII_U, /* Run Run and Die (EUR) */ },
-  { 0x00050000101F6400, CL_WUPS_TITLE_WII_U, /* Letter Quest Grimm's Journey Remastered (EUR) */ },
-  { 0x00050000101F6600, CL_WUPS_TITLE_WII_U, /* Gravity+ (USA) */ },
-  { 0x00050000101F6800, CL_WUPS_TITLE_WII_U, /* Volgarr the Viking (USA) */ },
-  { 0x00050000101F6900, CL_WUPS_TITLE_WII_U, /* PING 1.5+ (EUR) */ },
-  { 0x00050000101F6A00, CL_WUPS_TITLE_WII_U, /* Jewel Quest (EUR) */ },
-  { 0x00050000101F6B00, CL_WUPS_TITLE_WII_U, /* PIXEL SLIME U (EUR) */ },
-  { 0x00050000101F6E00, CL_WUPS_TITLE_WII_U, /* Tumblestone (EUR) */ },
-  { 0x00050000101F6F00, CL_WUPS_TITLE_WII_U, /* Jotun Valhalla Edition (EUR) */ },
-  { 0x00050000101F7000, CL_WUPS_TITLE_WII_U, /* Paranautical Activity (EUR) */ },
-  { 0x00050000101F7200, CL_WUPS_TITLE_WII_U, /* ブロック ビルダー (Discovery) (JPN) */ },
-  { 0x00050000101F7300, CL_WUPS_TITLE_WII_U, /* シャンティ - リスキィ・ブーツの逆襲 - (Shantae Risky's Revenge Director's Cut) (JPN) */ },
-  { 0x00050000101F7400, CL_WUPS_TITLE_WII_U, /* Hot Rod Racer (EUR) */ },
-  { 0x00050000101F7500, CL_WUPS_TITLE_WII_U, /* Midnight 2 (USA) */ },
-  { 0x00050000101F7600, CL_WUPS_TITLE_WII_U, /* Dual Core (EUR) */ },
-  { 0x00050000101F7700, CL_WUPS_TITLE_WII_U, /* PixelMaker (EUR) */ },
-  { 0x00050000101F7800, CL_WUPS_TITLE_WII_U, /* Ziggurat (EUR) */ },
-  { 0x00050000101F7900, CL_WUPS_TITLE_WII_U, /* Axiom Verge (USA) */ },
-  { 0x00050000101F7C00, CL_WUPS_TITLE_WII_U, /* TAP TAP ARCADE 2 (USA) */ },
-  { 0x00050000101F7D00, CL_WUPS_TITLE_WII_U, /* PSIBO (EUR) */ },
-  { 0x00050000101F7F00, CL_WUPS_TITLE_WII_U, /* シャンティ -海賊の呪い- (Shantae and the Pirate's Curse) (JPN) */ },
-  { 0x00050000101F8100, CL_WUPS_TITLE_WII_U, /* Gravity+ (EUR) */ },
-  { 0x00050000101F8400, CL_WUPS_TITLE_WII_U, /* JACKPOT 777 (EUR) */ },
-  { 0x00050000101F8500, CL_WUPS_TITLE_WII_U, /* ECTOPLAZA (USA) */ },
-  { 0x00050000101F8800, CL_WUPS_TITLE_WII_U, /* Toby: The Secret Mine (USA) */ },
-  { 0x00050000101F8900, CL_WUPS_TITLE_WII_U, /* Twin Robots (EUR) */ },
-  { 0x00050000101F8A00, CL_WUPS_TITLE_WII_U, /* Dungeon Hearts DX (USA) */ },
-  { 0x00050000101F8B00, CL_WUPS_TITLE_WII_U, /* Pirate Pop Plus (USA) */ },
-  { 0x00050000101F8C00, CL_WUPS_TITLE_WII_U, /* Twin Robots (USA) */ },
-  { 0x00050000101F8D00, CL_WUPS_TITLE_WII_U, /* TAP TAP ARCADE 2 (EUR) */ },
-  { 0x00050000101F8F00, CL_WUPS_TITLE_WII_U, /* 6180 the moon (JPN) */ },
-  { 0x00050000101F9000, CL_WUPS_TITLE_WII_U, /* Citadale (USA) */ },
-  { 0x00050000101F9200, CL_WUPS_TITLE_WII_U, /* JACKPOT 777 (USA) */ },
-  { 0x00050000101F9400, CL_WUPS_TITLE_WII_U, /* Super Destronaut 2: Go Duck Yourself (USA) */ },
-  { 0x00050000101F9500, CL_WUPS_TITLE_WII_U, /* Mega Maze (USA) */ },
-  { 0x00050000101F9700, CL_WUPS_TITLE_WII_U, /* Darksiders Warmastered Edition (EUR) */ },
-  { 0x00050000101F9800, CL_WUPS_TITLE_WII_U, /* B3 Game Expo For Bees (EUR) */ },
-  { 0x00050000101F9900, CL_WUPS_TITLE_WII_U, /* Aenigma Os (EUR) */ },
-  { 0x00050000101F9A00, CL_WUPS_TITLE_WII_U, /* Citadale (EUR) */ },
-  { 0x00050000101F9C00, CL_WUPS_TITLE_WII_U, /* Ziggurat (USA) */ },
-  { 0x00050000101F9D00, CL_WUPS_TITLE_WII_U, /* The Girl and the Robot (USA) */ },
-  { 0x00050000101FA000, CL_WUPS_TITLE_WII_U, /* Ohayou! Beginner's Japanese (USA) */ },
-  { 0x00050000101FA100, CL_WUPS_TITLE_WII_U, /* forma.8 (USA) */ },
-  { 0x00050000101FA600, CL_WUPS_TITLE_WII_U, /* Darksiders Warmastered Edition (USA) */ },
-  { 0x00050000101FA800, CL_WUPS_TITLE_WII_U, /* 140 (USA) */ },
-  { 0x00050000101FA900, CL_WUPS_TITLE_WII_U, /* Blasting Agent: Ultimate Edition (EUR) */ },
-  { 0x00050000101FAA00, CL_WUPS_TITLE_WII_U, /* Blasting Agent: Ultimate Edition (USA) */ },
-  { 0x00050000101FAB00, CL_WUPS_TITLE_WII_U, /* Collateral Thinking (USA) */ },
-  { 0x00050000101FAC00, CL_WUPS_TITLE_WII_U, /* INVANOID (USA) */ },
-  { 0x00050000101FAD00, CL_WUPS_TITLE_WII_U, /* SHOOTY SPACE (USA) */ },
-  { 0x00050000101FAF00, CL_WUPS_TITLE_WII_U, /* Midnight 2 (EUR) */ },
-  { 0x00050000101FB000, CL_WUPS_TITLE_WII_U, /* Super Destronaut 2: Go Duck Yourself (EUR) */ },
-  { 0x00050000101FB100, CL_WUPS_TITLE_WII_U, /* Skylanders™ Imaginators (EUR) */ },
-  { 0x00050000101FB400, CL_WUPS_TITLE_WII_U, /* Shadow Archer (USA) */ },
-  { 0x00050000101FB500, CL_WUPS_TITLE_WII_U, /* 140 (EUR) */ },
-  { 0x00050000101FB800, CL_WUPS_TITLE_WII_U, /* Hurry Up! Bird Hunter (USA) */ },
-  { 0x00050000101FBB00, CL_WUPS_TITLE_WII_U, /* Blackjack 21 (USA) */ },
-  { 0x00050000101FBD00, CL_WUPS_TITLE_WII_U, /* Educational Pack of Kids Games (USA) */ },
-  { 0x00050000101FBF00, CL_WUPS_TITLE_WII_U, /* Games for Toddlers (USA) */ },
-  { 0x00050000101FC000, CL_WUPS_TITLE_WII_U, /* BLOC (USA) */ },
-  { 0x00050000101FC400, CL_WUPS_TITLE_WII_U, /* Piano Teacher (USA) */ },
-  { 0x00050000101FC500, CL_WUPS_TITLE_WII_U, /* Skunky B's Super Slots Saga #1 (USA) */ },
-  { 0x00050000101FC600, CL_WUPS_TITLE_WII_U, /* Super Hero Math + Addition (USA) */ },
-  { 0x00050000101FC700, CL_WUPS_TITLE_WII_U, /* The First Skunk Bundle (USA) */ },
-  { 0x00050000101FCA00, CL_WUPS_TITLE_WII_U, /* SteamWorld Collection (EUR) */ },
-  { 0x00050000101FCE00, CL_WUPS_TITLE_WII_U, /* Word Logic by POWGI (USA) */ },
-  { 0x00050000101FD100, CL_WUPS_TITLE_WII_U, /* Grumpy Reaper (JPN) */ },
-  { 0x00050000101FD200, CL_WUPS_TITLE_WII_U, /* スーパーロボマウス (SUPER ROBO MOUSE) (JPN) */ },
-  { 0x00050000101FD300, CL_WUPS_TITLE_WII_U, /* ブロークドロップＵ (BLOK DROP U) (JPN) */ },
-  { 0x00050000101FD400, CL_WUPS_TITLE_WII_U, /* FreezeME (JPN) */ },
-  { 0x00050000101FD800, CL_WUPS_TITLE_WII_U, /* Prism Pets (USA) */ },
-  { 0x00050000101FDA00, CL_WUPS_TITLE_WII_U, /* Hurry Up! Bird Hunter (EUR) */ },
-  { 0x00050000101FDB00, CL_WUPS_TITLE_WII_U, /* Toby: The Secret Mine (EUR) */ },
-  { 0x00050000101FDE00, CL_WUPS_TITLE_WII_U, /* STEEL LORDS (EUR) */ },
-  { 0x00050000101FE200, CL_WUPS_TITLE_WII_U, /* CUP CRITTERS (USA) */ },
-  { 0x00050000101FE300, CL_WUPS_TITLE_WII_U, /* CUP CRITTERS (EUR) */ },
-  { 0x00050000101FE500, CL_WUPS_TITLE_WII_U, /* STEEL LORDS (USA) */ },
-  { 0x00050000101FE600, CL_WUPS_TITLE_WII_U, /* Amazonビデオ (Amazon Video) (JPN) */ },
-  { 0x00050000101FE700, CL_WUPS_TITLE_N64, /* 爆BOMBERMAN (Bomberman 64) (JPN) */ },
-  { 0x00050000101FE800, CL_WUPS_TITLE_N64, /* BOMBERMAN 64 (EUR/USA) */ },
-  { 0x00050000101FE900, CL_WUPS_TITLE_N64, /* 牧場物語2 (Harvest Moon 64) (JPN) */ },
-  { 0x00050000101FEA00, CL_WUPS_TITLE_N64, /* Harvest Moon 64 (EUR/USA) */ },
-  { 0x00050000101FEC00, CL_WUPS_TITLE_WII_U, /* Toon Tanks (EUR) */ },
-  { 0x00050000101FED00, CL_WUPS_TITLE_WII_U, /* FAST Racing NEO (EUR) */ },
-  { 0x00050000101FF000, CL_WUPS_TITLE_WII_U, /* VRog (EUR) */ },
-  { 0x00050000101FF200, CL_WUPS_TITLE_WII_U, /* Exile's End (USA) */ },
-  { 0x00050000101FF900, CL_WUPS_TITLE_WII_U, /* Test Your Mind (EUR) */ },
-  { 0x00050000101FFA00, CL_WUPS_TITLE_WII_U, /* Word Logic by POWGI (EUR) */ },
-  { 0x00050000101FFB00, CL_WUPS_TITLE_WII_U, /* BRICK BREAKER (USA) */ },
-  { 0x00050000101FFC00, CL_WUPS_TITLE_WII_U, /* GHOST BLADE HD (USA) */ },
-  { 0x00050000101FFD00, CL_WUPS_TITLE_WII_U, /* MAHJONG (USA) */ },
-  { 0x00050000101FFE00, CL_WUPS_TITLE_WII_U, /* TETRAMINOS (USA) */ },
-  { 0x00050000101FFF00, CL_WUPS_TITLE_WII_U, /* SOLITAIRE (USA) */ },
-  { 0x0005000010200000, CL_WUPS_TITLE_WII_U, /* SOLITAIRE (EUR) */ },
-  { 0x0005000010200100, CL_WUPS_TITLE_WII_U, /* Grand Prix Rock 'N Racing (USA) */ },
-  { 0x0005000010200200, CL_WUPS_TITLE_WII_U, /* Collateral Thinking (EUR) */ },
-  { 0x0005000010200300, CL_WUPS_TITLE_WII_U, /* Armikrog (EUR) */ },
-  { 0x0005000010200400, CL_WUPS_TITLE_WII_U, /* Teslapunk (EUR) */ },
-  { 0x0005000010200700, CL_WUPS_TITLE_WII_U, /* Twisted Fusion (EUR) */ },
-  { 0x0005000010200800, CL_WUPS_TITLE_WII_U, /* Axiom Verge (EUR) */ },
-  { 0x0005000010200900, CL_WUPS_TITLE_WII_U, /* MAHJONG (EUR) */ },
-  { 0x0005000010200A00, CL_WUPS_TITLE_WII_U, /* BRICK BREAKER (EUR) */ },
-  { 0x0005000010200B00, CL_WUPS_TITLE_WII_U, /* TETRAMINOS (EUR) */ },
-  { 0x0005000010200D00, CL_WUPS_TITLE_WII_U, /* MikroGame: Rotator (USA) */ },
-  { 0x0005000010200E00, CL_WUPS_TITLE_WII_U, /* PANDA LOVE (USA) */ },
-  { 0x0005000010200F00, CL_WUPS_TITLE_WII_U, /* PANDA LOVE (EUR) */ },
-  { 0x0005000010201000, CL_WUPS_TITLE_WII_U, /* SHOOT THE BALL (USA) */ },
-  { 0x0005000010201100, CL_WUPS_TITLE_WII_U, /* SHOOT THE BALL (EUR) */ },
-  { 0x0005000010201500, CL_WUPS_TITLE_WII_U, /* TITANS TOWER (USA) */ },
-  { 0x0005000010201600, CL_WUPS_TITLE_WII_U, /* TITANS TOWER (EUR) */ },
-  { 0x0005000010201800, CL_WUPS_TITLE_WII_U, /* SHOOTY SPACE (EUR) */ },
-  { 0x0005000010201A00, CL_WUPS_TITLE_WII_U, /* スターフォックス　ゼロ ザ・バトル・ビギンズ+トレーニング (StarFox Zero The Battle Begins + Training) (JPN) */ },
-  { 0x0005000010201B00, CL_WUPS_TITLE_WII_U, /* Star Fox Zero: The Battle Begins + Training (USA) */ },
-  { 0x0005000010201C00, CL_WUPS_TITLE_WII_U, /* Star Fox Zero The Battle Begins + Training (EUR) */ },
-  { 0x0005000010201D00, CL_WUPS_TITLE_WII_U, /* Block Zombies! (USA) */ },
-  { 0x0005000010201F00, CL_WUPS_TITLE_WII_U, /* Grand Prix Rock 'N Racing (EUR) */ },
-  { 0x0005000010202000, CL_WUPS_TITLE_WII_U, /* Back to Bed (EUR) */ },
-  { 0x0005000010202100, CL_WUPS_TITLE_WII_U, /* Overworld Defender Remix (USA) */ },
-  { 0x0005000010202500, CL_WUPS_TITLE_WII_U, /* Alice in Wonderland (USA) */ },
-  { 0x0005000010202600, CL_WUPS_TITLE_WII_U, /* Laser Blaster (USA) */ },
-  { 0x0005000010202700, CL_WUPS_TITLE_WII_U, /* Rorrim (USA) */ },
-  { 0x0005000010202800, CL_WUPS_TITLE_WII_U, /* Sky Force Anniversary (USA) */ },
-  { 0x0005000010202900, CL_WUPS_TITLE_WII_U, /* Amazon ビデオ BETA (Amazon Video BETA) (JPN) */ },
-  { 0x0005000010202A00, CL_WUPS_TITLE_WII_U, /* Amazon Video (USA) */ },
-  { 0x0005000010202B00, CL_WUPS_TITLE_WII_U, /* Laser Blaster (EUR) */ },
-  { 0x0005000010202C00, CL_WUPS_TITLE_WII_U, /* Block Zombies! (EUR) */ },
-  { 0x0005000010202D00, CL_WUPS_TITLE_WII_U, /* 360 Breakout (USA) */ },
-  { 0x0005000010202E00, CL_WUPS_TITLE_WII_U, /* 360 Breakout (EUR) */ },
-  { 0x0005000010203200, CL_WUPS_TITLE_WII_U, /* Shantae: Half-Genie Hero (EUR) */ },
-  { 0x0005000010203300, CL_WUPS_TITLE_WII_U, /* Pirate Pop Plus (EUR) */ },
-  { 0x0005000010203500, CL_WUPS_TITLE_WII_U, /* Sky Force Anniversary (EUR) */ },
-  { 0x0005000010203600, CL_WUPS_TITLE_WII_U, /* Rorrim (EUR) */ },
-  { 0x0005000010203700, CL_WUPS_TITLE_WII_U, /* Dreamals: Dream Quest (EUR) */ },
-  { 0x0005000010203800, CL_WUPS_TITLE_WII_U, /* Ninja Pizza Girl (EUR) */ },
-  { 0x0005000010203900, CL_WUPS_TITLE_WII_U, /* Alice in Wonderland (EUR) */ },
-  { 0x0005000010203B00, CL_WUPS_TITLE_WII_U, /* Dreamals: Dream Quest (USA) */ },
-  { 0x0005000010203D00, CL_WUPS_TITLE_WII_U, /* Space Hunted: The Lost Levels (USA) */ },
-  { 0x0005000010203E00, CL_WUPS_TITLE_WII_U, /* SteamWorld Collection (USA) */ },
-  { 0x0005000010204200, CL_WUPS_TITLE_WII_U, /* Mr. Pumpkin Adventure (USA) */ },
-  { 0x0005000010204400, CL_WUPS_TITLE_WII_U, /* Plantera (EUR) */ },
-  { 0x0005000010204500, CL_WUPS_TITLE_WII_U, /* LOST REAVERS NOTICE (EUR) */ },
-  { 0x0005000010204800, CL_WUPS_TITLE_WII_U, /* Plantera (USA) */ },
-  { 0x0005000010204A00, CL_WUPS_TITLE_WII_U, /* Exile's End (EUR) */ },
-  { 0x0005000010204C00, CL_WUPS_TITLE_WII_U, /* クロニクルズオブテディ ハーモニーオブエキシデス (Chronicles of Teddy Harmony of Exidus) (JPN) */ },
-  { 0x0005000010204D00, CL_WUPS_TITLE_WII_U, /* トルクル (TorqueL) (JPN) */ },
-  { 0x0005000010204F00, CL_WUPS_TITLE_WII_U, /* LOST REAVERS NOTICE (USA) */ },
-  { 0x0005000010205000, CL_WUPS_TITLE_WII_U, /* Cubit The Robot HD (USA) */ },
-  { 0x0005000010205400, CL_WUPS_TITLE_WII_U, /* Double Breakout (EUR) */ },
-  { 0x0005000010205500, CL_WUPS_TITLE_WII_U, /* MikroGame: Rotator (EUR) */ },
-  { 0x0005000010205600, CL_WUPS_TITLE_WII_U, /* Run Run and Die (JPN) */ },
-  { 0x0005000010205700, CL_WUPS_TITLE_WII_U, /* Double Breakout (USA) */ },
-  { 0x0005000010205800, CL_WUPS_TITLE_WII_U, /* SKORB (USA) */ },
-  { 0x0005000010205B00, CL_WUPS_TITLE_WII_U, /* Retro Road Rumble (USA) */ },
-  { 0x0005000010205C00, CL_WUPS_TITLE_WII_U, /* Runbow Deluxe Edition (USA) */ },
-  { 0x0005000010205F00, CL_WUPS_TITLE_WII_U, /* Aqua TV (EUR) */ },
-  { 0x0005000010206600, CL_WUPS_TITLE_WII_U, /* Annihilation (USA) */ },
-  { 0x0005000010206A00, CL_WUPS_TITLE_WII_U, /* Ohayou! Beginner's Japanese (EUR) */ },
-  { 0x0005000010206B00, CL_WUPS_TITLE_WII_U, /* Mr. Pumpkin Adventure (EUR) */ },
-  { 0x0005000010206C00, CL_WUPS_TITLE_WII_U, /* Pinball Breakout (USA) */ },
-  { 0x0005000010207300, CL_WUPS_TITLE_WII_U, /* Koi DX (EUR) */ },
-  { 0x0005000010207500, CL_WUPS_TITLE_WII_U, /* Koi DX (USA) */ },
-  { 0x0005000010207600, CL_WUPS_TITLE_WII_U, /* Space Hunted (USA) */ },
-  { 0x0005000010207700, CL_WUPS_TITLE_WII_U, /* Y.A.S.G (USA) */ },
-  { 0x0005000010207A00, CL_WUPS_TITLE_WII_U, /* ACE OF SEAFOOD (JPN) */ },
-  { 0x0005000010207B00, CL_WUPS_TITLE_WII_U, /* Shadow Archer (EUR) */ },
-  { 0x0005000010207C00, CL_WUPS_TITLE_WII_U, /* A.C.E. - Alien Cleanup Elite (USA) */ },
-  { 0x0005000010208300, CL_WUPS_TITLE_WII_U, /* Pinball Breakout (EUR) */ },
-  { 0x0005000010208500, CL_WUPS_TITLE_WII_U, /* Octocopter: Super Sub Squid Escape (EUR) */ },
-  { 0x0005000010208700, CL_WUPS_TITLE_WII_U, /* Octocopter: Super Sub Squid Escape (USA) */ },
-  { 0x0005000010208900, CL_WUPS_TITLE_WII_U, /* Words Up! Academy (USA) */ },
-  { 0x0005000010208E00, CL_WUPS_TITLE_WII_U, /* A.C.E. (EUR) */ },
-  { 0x0005000010209000, CL_WUPS_TITLE_WII_U, /* The Gem Collector (EUR) */ },
-  { 0x0005000010209300, CL_WUPS_TITLE_WII_U, /* Teslapunk (JPN) */ },
-  { 0x0005000010209600, CL_WUPS_TITLE_WII_U, /* VRog (USA) */ },
-  { 0x0005000010209900, CL_WUPS_TITLE_WII_U, /* Cars 3: Driven to Win (USA) */ },
-  { 0x0005000010209D00, CL_WUPS_TITLE_WII_U, /* Sudoku Party (EUR) */ },
-  { 0x0005000010209E00, CL_WUPS_TITLE_WII_U, /* Sudoku Party (USA) */ },
-  { 0x000500001020A100, CL_WUPS_TITLE_WII_U, /* ブルームーン２ (Star Sky 2) (JPN) */ },
-  { 0x000500001020A200, CL_WUPS_TITLE_WII_U, /* Minecraft: Story Mode - The Complete Adventure (USA) */ },
-  { 0x000500001020A300, CL_WUPS_TITLE_WII_U, /* Minecraft: Story Mode - The Complete Adventure (EUR) */ },
-  { 0x000500001020A400, CL_WUPS_TITLE_WII_U, /* Cars 3: Driven to Win (EUR) */ },
-  { 0x000500001020A800, CL_WUPS_TITLE_WII_U, /* Use Your Words (USA) */ },
-  { 0x000500001020A900, CL_WUPS_TITLE_TG16, /* バトルロードランナー (Battle Lode Runner) (JPN) */ },
-  { 0x000500001020AA00, CL_WUPS_TITLE_TG16, /* ボンバーマン '93 (BOMBERMAN '93) (JPN) */ },
-  { 0x000500001020AB00, CL_WUPS_TITLE_TG16, /* 邪聖剣ネクロマンサー (NECROMANCER) (JPN) */ },
-  { 0x000500001020AC00, CL_WUPS_TITLE_WII_U, /* ガイアの紋章 (EMBLEM OF GAIA) (JPN) */ },
-  { 0x000500001020AD00, CL_WUPS_TITLE_TG16, /* 飛装騎兵カイザード (X・SERD) (JPN) */ },
-  { 0x000500001020AE00, CL_WUPS_TITLE_TG16, /* どらごんEGG！ (DRAGON EGG) (JPN) */ },
-  { 0x000500001020AF00, CL_WUPS_TITLE_TG16, /* モトローダーMC (MOTOROADER MC) (JPN) */ },
-  { 0x000500001020B000, CL_WUPS_TITLE_WII_U, /* Bridge Constructor Playground (EUR) */ },
-  { 0x000500001020B100, CL_WUPS_TITLE_WII_U, /* Bridge Constructor Playground (USA) */ },
-  { 0x000500001020B200, CL_WUPS_TITLE_WII_U, /* Vaccine (USA) */ },
-  { 0x000500001020B300, CL_WUPS_TITLE_WII_U, /* Vaccine (EUR) */ },
-  { 0x000500001020B600, CL_WUPS_TITLE_WII_U, /* GHOST BLADE HD (EUR) */ },
-  { 0x000500001020B800, CL_WUPS_TITLE_WII_U, /* Scribble (EUR) */ },
-  { 0x000500001020B900, CL_WUPS_TITLE_WII_U, /* Breakout Defense (EUR) */ },
-  { 0x000500001020BA00, CL_WUPS_TITLE_WII_U, /* Breakout Defense (USA) */ },
-  { 0x000500001020BB00, CL_WUPS_TITLE_WII_U, /* Scribble (USA) */ },
-  { 0x000500001020C000, CL_WUPS_TITLE_WII_U, /* I C REDD (USA) */ },
-  { 0x000500001020C100, CL_WUPS_TITLE_WII_U, /* I C REDD (EUR) */ },
-  { 0x000500001020C300, CL_WUPS_TITLE_WII_U, /* RADIANTFLUX: HYPERFRACTAL (USA) */ },
-  { 0x000500001020C400, CL_WUPS_TITLE_WII_U, /* RADIANTFLUX: HYPERFRACTAL (EUR) */ },
-  { 0x000500001020C600, CL_WUPS_TITLE_WII_U, /* Six Sides of the World (EUR) */ },
-  { 0x000500001020C700, CL_WUPS_TITLE_WII_U, /* BLOC (EUR) */ },
-  { 0x000500001020C800, CL_WUPS_TITLE_WII_U, /* Tachyon Project (JPN) */ },
-  { 0x000500001020C900, CL_WUPS_TITLE_WII_U, /* Spheroids (JPN) */ },
-  { 0x000500001020CA00, CL_WUPS_TITLE_WII_U, /* Earthlock: Festival of Magic (EUR) */ },
-  { 0x000500001020CB00, CL_WUPS_TITLE_WII_U, /* Toon War (USA) */ },
-  { 0x000500001020CC00, CL_WUPS_TITLE_WII_U, /* WinKings (USA) */ },
-  { 0x000500001020CE00, CL_WUPS_TITLE_WII_U, /* Mutant Alien Moles of the Dead (USA) */ },
-  { 0x000500001020CF00, CL_WUPS_TITLE_WII_U, /* SHOOT THE BALL (JPN) */ },
-  { 0x000500001020D100, CL_WUPS_TITLE_WII_U, /* Pic-a-Pix Colour (EUR) */ },
-  { 0x000500001020D200, CL_WUPS_TITLE_WII_U, /* Words Up! Academy (EUR) */ },
-  { 0x000500001020D400, CL_WUPS_TITLE_WII_U, /* Candy Hoarder (EUR) */ },
-  { 0x000500001020D500, CL_WUPS_TITLE_WII_U, /* Maze Break (EUR) */ },
-  { 0x000500001020D600, CL_WUPS_TITLE_WII_U, /* Use Your Words (EUR) */ },
-  { 0x000500001020D700, CL_WUPS_TITLE_WII_U, /* Pic-a-Pix Color (USA) */ },
-  { 0x000500001020D800, CL_WUPS_TITLE_WII_U, /* Aqua TV (USA) */ },
-  { 0x000500001020D900, CL_WUPS_TITLE_WII_U, /* Maze Break (USA) */ },
-  { 0x000500001020DC00, CL_WUPS_TITLE_WII_U, /* WinKings (EUR) */ },
-  { 0x000500001020DE00, CL_WUPS_TITLE_WII_U, /* プランテラ ガーデンライフ (Plantera) (JPN) */ },
-  { 0x000500001020DF00, CL_WUPS_TITLE_WII_U, /* Star Splash: Shattered Star (EUR) */ },
-  { 0x000500001020E000, CL_WUPS_TITLE_WII_U, /* BRICK RACE (USA) */ },
-  { 0x000500001020E100, CL_WUPS_TITLE_WII_U, /* BRICK RACE (EUR) */ },
-  { 0x000500001020E200, CL_WUPS_TITLE_WII_U, /* COLOR CUBES (EUR) */ },
-  { 0x000500001020E500, CL_WUPS_TITLE_WII_U, /* かいぞくポップ (Pirate Pop Plus) (JPN) */ },
-  { 0x000500001020E600, CL_WUPS_TITLE_WII_U, /* WALL BALL (EUR) */ },
-  { 0x000500001020E700, CL_WUPS_TITLE_WII_U, /* Back to Bed (JPN) */ },
-  { 0x000500001020E900, CL_WUPS_TITLE_WII_U, /* Grand Prix Rock 'N Racing (JPN) */ },
-  { 0x000500001020EA00, CL_WUPS_TITLE_WII_U, /* CUP CRITTERS (JPN) */ },
-  { 0x000500001020EB00, CL_WUPS_TITLE_WII_U, /* Double Breakout II (EUR) */ },
-  { 0x000500001020EC00, CL_WUPS_TITLE_WII_U, /* COLOR CUBES (USA) */ },
-  { 0x000500001020ED00, CL_WUPS_TITLE_WII_U, /* WALL BALL (USA) */ },
-  { 0x000500001020EF00, CL_WUPS_TITLE_WII_U, /* Preston Sterling (EUR) */ },
-  { 0x000500001020F100, CL_WUPS_TITLE_WII_U, /* Cubit The Robot HD (EUR) */ },
-  { 0x000500001020F400, CL_WUPS_TITLE_WII_U, /* Swap Blocks (USA) */ },
-  { 0x000500001020F500, CL_WUPS_TITLE_WII_U, /* Absolutely Unstoppable MineRun (EUR) */ },
-  { 0x000500001020F800, CL_WUPS_TITLE_WII_U, /* Preston Sterling (USA) */ },
-  { 0x000500001020FB00, CL_WUPS_TITLE_WII_U, /* Triple Breakout (EUR) */ },
-  { 0x000500001020FC00, CL_WUPS_TITLE_WII_U, /* Mutant Alien Moles of the Dead (EUR) */ },
-  { 0x000500001020FD00, CL_WUPS_TITLE_WII_U, /* Absolutely Unstoppable MineRun (USA) */ },
-  { 0x000500001020FE00, CL_WUPS_TITLE_WII_U, /* Double Breakout II (USA) */ },
-  { 0x000500001020FF00, CL_WUPS_TITLE_WII_U, /* Triple Breakout (USA) */ },
-  { 0x0005000010210200, CL_WUPS_TITLE_WII_U, /* レヴナントサーガ (Revenant Saga) (JPN) */ },
-  { 0x0005000010210300, CL_WUPS_TITLE_WII_U, /* Citadale The Legends Trilogy (EUR) */ },
-  { 0x0005000010210400, CL_WUPS_TITLE_WII_U, /* Space Hunted (EUR) */ },
-  { 0x0005000010210500, CL_WUPS_TITLE_WII_U, /* Y.A.S.G (EUR) */ },
-  { 0x0005000010210600, CL_WUPS_TITLE_WII_U, /* ドットアーティスト (PixelMaker) (JPN) */ },
-  { 0x0005000010210700, CL_WUPS_TITLE_WII_U, /* The Stonecutter (EUR) */ },
-  { 0x0005000010210800, CL_WUPS_TITLE_WII_U, /* The Girl and the Robot (EUR) */ },
-  { 0x0005000010210A00, CL_WUPS_TITLE_WII_U, /* Jolt Family Robot Racer (EUR) */ },
-  { 0x0005000010210B00, CL_WUPS_TITLE_WII_U, /* Jolt Family Robot Racer (USA) */ },
-  { 0x0005000010210C00, CL_WUPS_TITLE_WII_U, /* JUST DANCE® 2018 (EUR) */ },
-  { 0x0005000010210E00, CL_WUPS_TITLE_WII_U, /* ORBIT (USA) */ },
-  { 0x0005000010211000, CL_WUPS_TITLE_WII_U, /* Coqui The Game (USA) */ },
-  { 0x0005000010211100, CL_WUPS_TITLE_WII_U, /* ORBIT (EUR) */ },
-  { 0x0005000010211200, CL_WUPS_TITLE_WII_U, /* Revenant Saga (EUR) */ },
-  { 0x0005000010211300, CL_WUPS_TITLE_WII_U, /* JUST DANCE® 2018 (USA) */ },
-  { 0x0005000010211400, CL_WUPS_TITLE_WII_U, /* Daikon Set (USA) */ },
-  { 0x0005000010211500, CL_WUPS_TITLE_WII_U, /* FIFTEEN (USA) */ },
-  { 0x0005000010211600, CL_WUPS_TITLE_WII_U, /* PINBALL (USA) */ },
-  { 0x0005000010211700, CL_WUPS_TITLE_WII_U, /* SPHERE SLICE (USA) */ },
-  { 0x0005000010211800, CL_WUPS_TITLE_WII_U, /* Eba & Egg: A Hatch Trip (EUR) */ },
-  { 0x0005000010211900, CL_WUPS_TITLE_WII_U, /* FIFTEEN (EUR) */ },
-  { 0x0005000010211A00, CL_WUPS_TITLE_WII_U, /* PINBALL (EUR) */ },
-  { 0x0005000010211B00, CL_WUPS_TITLE_WII_U, /* SPHERE SLICE (EUR) */ },
-  { 0x0005000010211E00, CL_WUPS_TITLE_WII_U, /* A Drawing's Journey (EUR) */ },
-  { 0x0005000010211F00, CL_WUPS_TITLE_WII_U, /* ドラゴンクエストⅩ 5000年の旅路 遙かなる故郷へ オンライン Version 4 (Dragon Quest X The 5000 Year Voyage to a Faraway Hometown) (JPN) */ },
-  { 0x0005000010212000, CL_WUPS_TITLE_WII_U, /* デッドハウス 再生 (Vaccine) (JPN) */ },
-  { 0x0005000010212100, CL_WUPS_TITLE_WII_U, /* Bit Dungeon+ (JPN) */ },
-  { 0x0005000010212200, CL_WUPS_TITLE_WII_U, /* キューブライフ： ピクセルアクションヒーローズ (Cube Life: Pixel Action Heroes) (JPN) */ },
-  { 0x0005000010212400, CL_WUPS_TITLE_WII_U, /* タロミア (Tallowmere) (JPN) */ },
-  { 0x0005000010212500, CL_WUPS_TITLE_WII_U, /* Armored ACORNs: Action Squirrel Squad (EUR) */ },
-  { 0x0005000010212600, CL_WUPS_TITLE_WII_U, /* Earthlock: Festival of Magic (USA) */ },
-  { 0x0005000010212800, CL_WUPS_TITLE_WII_U, /* BOX UP (EUR) */ },
-  { 0x0005000010212A00, CL_WUPS_TITLE_WII_U, /* GALAXY BLASTER (EUR) */ },
-  { 0x0005000010212B00, CL_WUPS_TITLE_WII_U, /* BOX UP (USA) */ },
-  { 0x0005000010212D00, CL_WUPS_TITLE_WII_U, /* GALAXY BLASTER (USA) */ },
-  { 0x0005000010212F00, CL_WUPS_TITLE_WII_U, /* Revenant Saga (USA) */ },
-  { 0x0005000010213100, CL_WUPS_TITLE_WII_U, /* Toon War (EUR) */ },
-  { 0x0005000010213400, CL_WUPS_TITLE_WII_U, /* PixelMaker Studio (USA) */ },
-  { 0x0005000010213500, CL_WUPS_TITLE_WII_U, /* Super Ultra Star Shooter (EUR) */ },
-  { 0x0005000010213600, CL_WUPS_TITLE_WII_U, /* Swap Blocks (EUR) */ },
-  { 0x0005000010213700, CL_WUPS_TITLE_WII_U, /* Schlag den Star - Das Spiel (EUR) */ },
-  { 0x0005000010213B00, CL_WUPS_TITLE_WII_U, /* Cubeshift (USA) */ },
-  { 0x0005000010213C00, CL_WUPS_TITLE_WII_U, /* Super Ultra Star Shooter (USA) */ },
-  { 0x0005000010213D00, CL_WUPS_TITLE_WII_U, /* Draw a Stickman: EPIC 2 (USA) */ },
-  { 0x0005000010214100, CL_WUPS_TITLE_WII_U, /* 少女とロボット (The Girl and the Robot) (JPN) */ },
-  { 0x0005000010214200, CL_WUPS_TITLE_WII_U, /* PixelMaker Studio (EUR) */ },
-  { 0x0005000010214B00, CL_WUPS_TITLE_WII_U, /* Annihilation (EUR) */ },
-  { 0x0005000010215000, CL_WUPS_TITLE_WII_U, /* Völgarr the Viking (EUR) */ },
-  { 0x0005000010215800, CL_WUPS_TITLE_WII_U, /* RTO (EUR) */ },
-  { 0x0005000010215900, CL_WUPS_TITLE_TG16, /* BATTLE LODE RUNNER (EUR) */ },
-  { 0x0005000010215A00, CL_WUPS_TITLE_TG16, /* BATTLE LODE RUNNER (USA) */ },
-  { 0x0005000010215B00, CL_WUPS_TITLE_TG16, /* BOMBERMAN '93 (EUR) */ },
-  { 0x0005000010215C00, CL_WUPS_TITLE_TG16, /* BOMBERMAN '93 (USA) */ },
-  { 0x0005000010215D00, CL_WUPS_TITLE_TG16, /* NECROMANCER (EUR) */ },
-  { 0x0005000010215E00, CL_WUPS_TITLE_TG16, /* NECROMANCER (USA) */ },
-  { 0x0005000010215F00, CL_WUPS_TITLE_WII_U, /* Spellcaster's Assistant (EUR) */ },
-  { 0x0005000010216000, CL_WUPS_TITLE_WII_U, /* Breakout Defense 2 (EUR) */ },
-  { 0x0005000010216100, CL_WUPS_TITLE_WII_U, /* Spellcaster's Assistant (USA) */ },
-  { 0x0005000010216200, CL_WUPS_TITLE_WII_U, /* Fat Dragons (USA) */ },
-  { 0x0005000010216300, CL_WUPS_TITLE_WII_U, /* RTO (USA) */ },
-  { 0x0005000010216400, CL_WUPS_TITLE_WII_U, /* Breakout Defense 2 (USA) */ },
-  { 0x0005000010216500, CL_WUPS_TITLE_WII_U, /* RTO 2 (EUR) */ },
-  { 0x0005000010216600, CL_WUPS_TITLE_WII_U, /* RTO 2 (USA) */ },
-  { 0x0005000010216700, CL_WUPS_TITLE_WII_U, /* Fat Dragons (EUR) */ },
-  { 0x0005000010216800, CL_WUPS_TITLE_WII_U, /* Masked Forces (EUR) */ },
-  { 0x0005000010216900, CL_WUPS_TITLE_WII_U, /* Masked Forces (USA) */ },
-  { 0x0005000010216B00, CL_WUPS_TITLE_WII_U, /* Cycle of Eternity (EUR) */ },
-  { 0x0005000010216C00, CL_WUPS_TITLE_WII_U, /* Cycle of Eternity (USA) */ },
-  { 0x0005000010216D00, CL_WUPS_TITLE_WII_U, /* Shadow Archery (USA) */ },
-  { 0x0005000010216E00, CL_WUPS_TITLE_WII_U, /* Shadow Archery (EUR) */ },
-  { 0x0005000010216F00, CL_WUPS_TITLE_WII_U, /* Unalive (EUR) */ },
-  { 0x0005000010217000, CL_WUPS_TITLE_WII_U, /* JUST DANCE® 2019 (EUR) */ },
-  { 0x0005000010217100, CL_WUPS_TITLE_WII_U, /* Unalive (USA) */ },
-  { 0x0005000010217200, CL_WUPS_TITLE_WII_U, /* Rainbow Snake (EUR) */ },
-  { 0x0005000010217300, CL_WUPS_TITLE_WII_U, /* JUST DANCE® 2019 (USA) */ },
-  { 0x0005000010217400, CL_WUPS_TITLE_WII_U, /* Rainbow Snake (USA) */ },
-  { 0x0005000010217900, CL_WUPS_TITLE_WII_U, /* CosmiBall (USA) */ },
-  { 0x0005000010217A00, CL_WUPS_TITLE_WII_U, /* Forest Escape (EUR) */ },
-  { 0x0005000010217B00, CL_WUPS_TITLE_WII_U, /* Forest Escape (USA) */ },
-  { 0x0005000010217C00, CL_WUPS_TITLE_WII_U, /* Sinister Assistant (EUR) */ },
-  { 0x0005000010217D00, CL_WUPS_TITLE_WII_U, /* Shadow Archer Special (EUR) */ },
-  { 0x0005000010217F00, CL_WUPS_TITLE_WII_U, /* Sinister Assistant (USA) */ },
-  { 0x0005000010218000, CL_WUPS_TITLE_WII_U, /* Insect Planet TD (USA) */ },
-  { 0x0005000010218100, CL_WUPS_TITLE_WII_U, /* SCOOP! AROUND THE WORLD IN 80 SPACES (USA) */ },
-  { 0x0005000010218200, CL_WUPS_TITLE_WII_U, /* Insect Planet TD (EUR) */ },
-  { 0x0005000010218300, CL_WUPS_TITLE_WII_U, /* Petite Zombies (EUR) */ },
-  { 0x0005000010218500, CL_WUPS_TITLE_WII_U, /* Petite Zombies (USA) */ },
-  { 0x0005000010218700, CL_WUPS_TITLE_WII_U, /* Call of Nightmare (USA) */ },
-  { 0x0005000010218800, CL_WUPS_TITLE_WII_U, /* Last Soldier (USA) */ },
-  { 0x0005000010218900, CL_WUPS_TITLE_WII_U, /* Crush Insects (USA) */ },
-  { 0x0005000010218B00, CL_WUPS_TITLE_WII_U, /* El Silla Arcade Edition (USA) */ },
-  { 0x0005000010218C00, CL_WUPS_TITLE_WII_U, /* El Silla Arcade Edition (EUR) */ },
-  { 0x0005000010219300, CL_WUPS_TITLE_WII_U, /* Azure Snake (EUR) */ },
-  { 0x0005000010219400, CL_WUPS_TITLE_WII_U, /* Azure Snake (USA) */ },
-  { 0x0005000010219B00, CL_WUPS_TITLE_WII_U, /* Horror Stories (EUR) */ },
-  { 0x0005000010219C00, CL_WUPS_TITLE_WII_U, /* Space Hunted: The Lost Levels (EUR) */ },
-  { 0x0005000010219A00, CL_WUPS_TITLE_WII_U, /* Horror Stories (USA) */ },
-  { 0x000500001021A000, CL_WUPS_TITLE_WII_U, /* Space Intervention (EUR) */ },
-  { 0x000500001021A100, CL_WUPS_TITLE_WII_U, /* Space Intervention (USA) */ },
-  { 0x000500001021A200, CL_WUPS_TITLE_WII_U, /* MOUNTAIN PEAK BATTLE MESS (USA) */ },
-  { 0x000500001021A300, CL_WUPS_TITLE_WII_U, /* MOUNTAIN PEAK BATTLE MESS (EUR) */ },
-  { 0x000500001021A600, CL_WUPS_TITLE_WII_U, /* Regina & Mac (USA) */ },
-  { 0x000500001021A700, CL_WUPS_TITLE_WII_U, /* Regina & Mac (EUR) */ },
-  { 0x000500001021A800, CL_WUPS_TITLE_WII_U, /* CRYSTORLD (USA) */ },
-  { 0x000500001021AA00, CL_WUPS_TITLE_WII_U, /* Shakedown: Hawaii™ (USA) */ },
-  { 0x000500001021AB00, CL_WUPS_TITLE_WII_U, /* Shmup Collection (EUR) */ },
-  { 0x000500001021AC00, CL_WUPS_TITLE_WII_U, /* Finding Teddy 2 Definitive Edition (EUR) */ },
-  { 0x000500001021AE00, CL_WUPS_TITLE_WII_U, /* Keen Dreams: Definitive Edition (EUR) */ },
-  { 0x000500001021B200, CL_WUPS_TITLE_WII_U, /* Captain U (USA) */ },
-  { 0x000500001021BC00, CL_WUPS_TITLE_WII_U, /* Shadow Archer Special (USA) */ },
-  { 0x000500001021BE00, CL_WUPS_TITLE_WII_U, /* SUPER Food Frenzy (EUR) */ },
-  { 0x000500001021C000, CL_WUPS_TITLE_WII_U, /* Seasonal Assistant (USA) */ },
-  { 0x000500001021C100, CL_WUPS_TITLE_WII_U, /* Seasonal Assistant (EUR) */ },
-  { 0x000500001021C300, CL_WUPS_TITLE_WII_U, /* SturmFront - The Mutant War (USA) */ },
-  { 0x000500001021C500, CL_WUPS_TITLE_WII_U, /* SturmFront - The Mutant War (EUR) */ },
-  { 0x000500001021C600, CL_WUPS_TITLE_WII_U, /* Captain U (EUR) */ },
-  { 0x000500001021C900, CL_WUPS_TITLE_WII_U, /* Reversi 32 (EUR) */ },
-  { 0x000500001021CF00, CL_WUPS_TITLE_WII_U, /* RTO 3 (USA) */ },
-  { 0x000500001021D000, CL_WUPS_TITLE_WII_U, /* Silver Falls Undertakers (USA) */ },
-  { 0x000500001021D300, CL_WUPS_TITLE_WII_U, /* Silver Falls White Inside Its Umbra (USA) */ },
-  { 0x000500001021D400, CL_WUPS_TITLE_WII_U, /* RTO 3 (EUR) */ },
-  { 0x000500001F600600, CL_WUPS_TITLE_WII_U, /* スーパーマリオメーカー(メディア) Super Mario Maker (Media) (JPN) */ },
-  { 0x000500001F600700, CL_WUPS_TITLE_WII_U, /* Super Mario Maker (Media) (USA) */ },
-  { 0x000500001F600800, CL_WUPS_TITLE_WII_U, /* Super Mario Maker (Media) (EUR) */ },
-  { 0x000500001F600900, CL_WUPS_TITLE_WII_U, /* ペーパーマリオ　カラースプラッシュ (PAPER MARIO Color Splash) (JPN) */ },
-  { 0x000500001F600A00, CL_WUPS_TITLE_WII_U, /* Paper Mario Color Splash (USA) */ },
-  { 0x000500001F600B00, CL_WUPS_TITLE_WII_U, /* Paper Mario Color Splash (EUR) */ },
-  { 0x000500001FBF1000, CL_WUPS_TITLE_WII_U, /* FBF10 [patched2] (all) */ },
+  { "vessel", CL_WUPS_TITLE_N64 },
+  { "hachihachi", CL_WUPS_TITLE_NDS },
+};
 
-  { 0, 0 }
+/**
+ * Per-title memory hints. Entries should only be added once the addresses
+ * have been confirmed across several boots of the title. None have been
+ * yet, so every title gets only the per-system defaults below, and its ROM
+ * image is found by scanning, then by the location cached from the last
+ * session.
+ */
+static const cl_wups_title_hint_t cl_wups_title_hints[] =
+{
+  { 0 }
 };
 
+/* Results of title_detect_system, so each title is only fingerprinted once */
+#define CL_WUPS_DETECT_CACHE_SIZE 16
+
+typedef struct
+{
+  uint64_t id;
+  unsigned type;
+} cl_wups_detect_cache_t;
+
+static cl_wups_detect_cache_t cl_wups_detect_cache[CL_WUPS_DETECT_CACHE_SIZE];
+static unsigned cl_wups_detect_cache_next = 0;
+
+static uint32_t cl_wups_title_hash(uint32_t key, uint32_t seed)
+{
+  uint32_t h = key ^ (seed * 0x9E3779B9);
+
+  h ^= h >> 16;
+  h *= 0x85EBCA6B;
+  h ^= h >> 13;
+  h *= 0xC2B2AE35;
+  h ^= h >> 16;
+
+  return h;
+}
+
+/* Maps a hash onto [0, range) without a division */
+static uint32_t cl_wups_title_reduce(uint32_t hash, uint32_t range)
+{
+  return (uint32_t)(((uint64_t)hash * range) >> 32);
+}
+
+/**
+ * Points a title database at a blob in memory, after checking that the blob
+ * is large enough to hold everything its header describes.
+ */
+static bool cl_wups_titledb_open(cl_wups_titledb_t *db, const void *data,
+                                 size_t size)
+{
+  const uint8_t *bytes = (const uint8_t*)data;
+  cl_wups_titledb_header_t header;
+  size_t disps_size, ids_size, types_size;
+
+  if (size < sizeof(header))
+    return false;
+  memcpy(&header, bytes, sizeof(header));
+  if (header.magic != CL_WUPS_TITLEDB_MAGIC ||
+      header.version != CL_WUPS_TITLEDB_VERSION ||
+      !header.count || !header.bucket_count)
+    return false;
+
+  disps_size = ((header.bucket_count + 1) & ~1u) * sizeof(uint16_t);
+  ids_size = header.count * sizeof(uint32_t);
+  types_size = (header.count + 1) / 2;
+  if (size < sizeof(header) + disps_size + ids_size + types_size)
+    return false;
+
+  db->id_high = header.id_high;
+  db->count = header.count;
+  db->bucket_count = header.bucket_count;
+  db->disps = (const uint16_t*)(bytes + sizeof(header));
+  db->ids = (const uint32_t*)(bytes + sizeof(header) + disps_size);
+  db->types = bytes + sizeof(header) + disps_size + ids_size;
+
+  return true;
+}
+
+/**
+ * Lookup is two hashes, one table read and one compare, for both hits and
+ * misses.
+ */
+static unsigned cl_wups_titledb_lookup(const cl_wups_titledb_t *db,
+                                       uint64_t title_id)
+{
+  uint32_t id_low = (uint32_t)title_id;
+  uint32_t bucket, slot;
+
+  if (!db->count || (title_id >> 32) != db->id_high)
+    return CL_WUPS_TITLE_UNKNOWN;
+
+  bucket = cl_wups_title_reduce(cl_wups_title_hash(id_low, 0), db->bucket_count);
+  slot = cl_wups_title_reduce(cl_wups_title_hash(id_low, db->disps[bucket] + 1u),
+                              db->count);
+  if (db->ids[slot] != id_low)
+    return CL_WUPS_TITLE_UNKNOWN;
+
+  return (db->types[slot / 2] >> ((slot & 1) * 4)) & 0xF;
+}
+
 /**
  * It appears that this physical address, somewhere in a 32MB overlay area,
  * always contains the start of emulated Nintendo 64 RAM in the Wii U VC
@@ -2897,21 +171,164 @@ static const cl_wups_title_t cl_wups_titles[] =
  */
 bool title_is_n64(void)
 {
-  return (*((uint32_t*)CL_WUPS_N64_RAMPTR) & 0xFFFF8000) == 0x3c1a8000;
+  /* The overlay area is not mapped until the emulator sets it up */
+  return guest_valid(CL_WUPS_N64_RAMPTR) &&
+         (guest_read32(CL_WUPS_N64_RAMPTR) & 0xFFFF8000) == 0x3c1a8000;
+}
+
+bool title_init(void)
+{
+  return cl_wups_titledb_open(&cl_wups_titledb_builtin, titles_bin,
+                              titles_bin_size);
+}
+
+bool title_load_overlay(void)
+{
+  FILE *file;
+  long size;
+  void *data;
+
+  if (cl_wups_titledb_overlay_tried)
+    return cl_wups_titledb_overlay.count != 0;
+  cl_wups_titledb_overlay_tried = true;
+
+  file = fopen(CL_WUPS_TITLEDB_OVERLAY_PATH, "rb");
+  if (!file)
+    return false;
+  if (fseek(file, 0, SEEK_END) || (size = ftell(file)) <= 0 ||
+      fseek(file, 0, SEEK_SET))
+  {
+    fclose(file);
+    return false;
+  }
+
+  data = memalign(0x40, size);
+  if (!data || fread(data, 1, size, file) != (size_t)size ||
+      !cl_wups_titledb_open(&cl_wups_titledb_overlay, data, size))
+  {
+    memset(&cl_wups_titledb_overlay, 0, sizeof(cl_wups_titledb_overlay));
+    free(data);
+    fclose(file);
+    return false;
+  }
+  fclose(file);
+
+  return true;
 }
 
 unsigned title_get_system(uint64_t title_id)
 {
-  const cl_wups_title_t *title = &cl_wups_titles[0];
+  unsigned system = cl_wups_titledb_lookup(&cl_wups_titledb_overlay, title_id);
+
+  if (system != CL_WUPS_TITLE_UNKNOWN)
+    return system;
 
-  while (title->type)
+  return cl_wups_titledb_lookup(&cl_wups_titledb_builtin, title_id);
+}
+
+/**
+ * Matches the names of the modules loaded by the foreground process against
+ * the known Virtual Console emulators.
+ */
+static unsigned cl_wups_detect_modules(void)
+{
+  OSDynLoad_NotifyData *infos;
+  int count = OSDynLoad_GetNumberOfRPLs();
+  unsigned type = CL_WUPS_TITLE_UNKNOWN;
+
+  if (count <= 0)
+    return CL_WUPS_TITLE_UNKNOWN;
+  infos = (OSDynLoad_NotifyData*)calloc(count, sizeof(OSDynLoad_NotifyData));
+  if (!infos)
+    return CL_WUPS_TITLE_UNKNOWN;
+
+  if (OSDynLoad_GetRPLInfo(0, count, infos))
   {
-    if (title->id == title_id)
-      return title->type;
-    else
-      title++;
+    for (int i = 0; i < count && type == CL_WUPS_TITLE_UNKNOWN; i++)
+    {
+      char name[64];
+      unsigned j;
+
+      if (!infos[i].name)
+        continue;
+      for (j = 0; infos[i].name[j] && j < sizeof(name) - 1; j++)
+        name[j] = tolower((unsigned char)infos[i].name[j]);
+      name[j] = '\0';
+
+      for (const auto &emulator : cl_wups_emulators)
+      {
+        if (strstr(name, emulator.module))
+        {
+          type = emulator.type;
+          break;
+        }
+      }
+    }
   }
+  free(infos);
 
-  return 0;
+  return type;
 }
 
+unsigned title_detect_system(uint64_t title_id)
+{
+  cl_wups_detect_cache_t *entry;
+  unsigned type;
+
+  for (const auto &cached : cl_wups_detect_cache)
+    if (cached.id == title_id)
+      return cached.type;
+
+  type = cl_wups_detect_modules();
+  entry = &cl_wups_detect_cache[cl_wups_detect_cache_next];
+  entry->id = title_id;
+  entry->type = type;
+  cl_wups_detect_cache_next = (cl_wups_detect_cache_next + 1) % CL_WUPS_DETECT_CACHE_SIZE;
+
+  return type;
+}
+
+bool title_get_hint(uint64_t title_id, unsigned system,
+                    cl_wups_title_hint_t *hint)
+{
+  memset(hint, 0, sizeof(*hint));
+  hint->id = title_id;
+
+  switch (system)
+  {
+  case CL_WUPS_TITLE_NES:
+    hint->rom_data = CL_WUPS_NES_ROM_HINT;
+    break;
+  case CL_WUPS_TITLE_N64:
+    hint->ram_base = CL_WUPS_N64_RAMPTR;
+    break;
+  case CL_WUPS_TITLE_NDS:
+    hint->ram_ptr = CL_WUPS_NDS_ASPTR;
+    break;
+  }
+
+  for (const cl_wups_title_hint_t *entry = cl_wups_title_hints; entry->id; entry++)
+  {
+    if (entry->id != title_id)
+      continue;
+    if (entry->rom_data)
+    {
+      hint->rom_data = entry->rom_data;
+      hint->rom_size = entry->rom_size;
+    }
+    if (entry->ram_base)
+      hint->ram_base = entry->ram_base;
+    if (entry->iram_base)
+      hint->iram_base = entry->iram_base;
+    if (entry->sram_base)
+    {
+      hint->sram_base = entry->sram_base;
+      hint->sram_size = entry->sram_size;
+    }
+    if (entry->ram_ptr)
+      hint->ram_ptr = entry->ram_ptr;
+    break;
+  }
+
+  return hint->rom_data != 0;
+}
@@ -5,12 +5,84 @@
 
 #define CL_WUPS_N64_RAMPTR 0xF547F014
 
+/* Holds a pointer to the emulated NDS address space in "hachihachi" */
+#define CL_WUPS_NDS_ASPTR 0xF56139D8
+
+/* Magic at the start of an N64 ROM header */
+#define CL_WUPS_N64_ROM_MAGIC 0x80371240
+
+/* First word of the encoded Nintendo logo, at 0xC0 in an NDS ROM header */
+#define CL_WUPS_NDS_ROM_MAGIC 0x24FFAE51
+#define CL_WUPS_NDS_ROM_MAGIC_OFFSET 0xC0
+
+/**
+ * "NES" followed by a null byte, where a standard iNES header has 0x1A.
+ * The NES emulator usually loads the image at CL_WUPS_NES_ROM_HINT.
+ */
+#define CL_WUPS_NES_ROM_MAGIC 0x4E455300
+#define CL_WUPS_NES_ROM_HINT 0x10000050
+
+/* NES console work RAM; like cartridge RAM, only known from hints */
+#define CL_WUPS_NES_WRAM_SIZE 0x800
+
+/* SNES console work RAM, only known from hints; the ROM header sizes SRAM */
+#define CL_WUPS_SNES_WRAM_SIZE 0x20000
+
+/* The GBA header has the same logo as the NDS one, at 0x04 */
+#define CL_WUPS_GBA_ROM_MAGIC CL_WUPS_NDS_ROM_MAGIC
+#define CL_WUPS_GBA_ROM_MAGIC_OFFSET 0x04
+
+/* GBA on-board work RAM at 0x02000000 and in-chip work RAM at 0x03000000 */
+#define CL_WUPS_GBA_EWRAM_SIZE 0x40000
+#define CL_WUPS_GBA_IWRAM_SIZE 0x8000
+
+/* TurboGrafx-16 work RAM, in bank 0xF8, only known from hints */
+#define CL_WUPS_TG16_WRAM_SIZE 0x2000
+
+/* MSX main RAM, as four 16 KB pages filling the Z80 address space */
+#define CL_WUPS_MSX_RAM_SIZE 0x10000
+
+/**
+ * Optional title database on the SD card, built with tools/titledb.py, that
+ * adds to or overrides entries in the built-in one.
+ */
+#define CL_WUPS_TITLEDB_OVERLAY_PATH \
+  "fs:/vol/external01/wiiu/environments/aroma/plugins/config/classicslive_titles.bin"
+
+/**
+ * Known memory locations for a title, used to skip searching for them. Any
+ * field left as 0 is unknown. Per-system defaults are filled in first, then
+ * overridden by per-title entries.
+ */
 typedef struct
 {
   uint64_t id;
-  unsigned type;
-} cl_wups_title_t;
 
+  /**
+   * Host address and size of the ROM image. The image found there is checked
+   * the same way as a scan result; a size of 0 accepts any valid image.
+   */
+  uint32_t rom_data;
+  uint32_t rom_size;
+
+  /* Host address of emulated RAM, if it is fixed */
+  uint32_t ram_base;
+
+  /* Host address of a second block of emulated RAM, for systems with two */
+  uint32_t iram_base;
+
+  /* Host address and size of emulated cartridge save RAM, if it is fixed */
+  uint32_t sram_base;
+  uint32_t sram_size;
+
+  /**
+   * Host address of a pointer to the emulated address space, if RAM is not
+   * fixed. Guest addresses are offsets from the pointed-to address.
+   */
+  uint32_t ram_ptr;
+} cl_wups_title_hint_t;
+
+/* Stored in the generated title database; keep tools/titledb.py in sync */
 enum
 {
   CL_WUPS_TITLE_UNKNOWN = 0,
@@ -57,6 +129,36 @@ enum
  */
 bool title_is_n64(void);
 
+/**
+ * Loads the built-in title database. Must be called before
+ * title_get_system().
+ */
+bool title_init(void);
+
+/**
+ * Loads the title database overlay from the SD card, if one exists. The file
+ * is only read on the first call; later calls return the first result.
+ */
+bool title_load_overlay(void);
+
+/**
+ * Returns the CL_WUPS_TITLE_* system of a title, checking the overlay before
+ * the built-in database.
+ */
 unsigned title_get_system(uint64_t title_id);
 
+/**
+ * Classifies a title missing from the title database by looking for a known
+ * Virtual Console emulator among the modules of the foreground process. The
+ * result is cached per title ID.
+ */
+unsigned title_detect_system(uint64_t title_id);
+
+/**
+ * Fills in the memory hints known for a title of the given system.
+ * @return Whether the ROM location is known.
+ */
+bool title_get_hint(uint64_t title_id, unsigned system,
+                    cl_wups_title_hint_t *hint);
+
 #endif
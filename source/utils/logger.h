@@ -0,0 +1,9 @@
+#ifndef CL_WUPS_LOGGER_H
+#define CL_WUPS_LOGGER_H
+
+#include <coreinit/debug.h>
+
+/* Reports an error to the system log, with the function and line it is from */
+#define DEBUG_FUNCTION_LINE_ERR(fmt, ...) OSReport("Error: %s:%d: " fmt "\n", __FUNCTION__, __LINE__, ##__VA_ARGS__)
+
+#endif
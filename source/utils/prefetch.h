@@ -0,0 +1,11 @@
+#ifndef CL_WUPS_PREFETCH_H
+#define CL_WUPS_PREFETCH_H
+
+/* Starts loading the cache block holding an address, without waiting for it */
+#if defined(__powerpc__)
+#define CL_WUPS_PREFETCH(a) __asm__ volatile("dcbt 0, %0" : : "r"(a))
+#else
+#define CL_WUPS_PREFETCH(a) __builtin_prefetch(a)
+#endif
+
+#endif
@@ -0,0 +1,90 @@
+/**
+ * Measures the throughput of the MD5 functions hash.cpp provides over a
+ * buffer the size of a large ROM image. When libretro-common is checked out,
+ * its utils/md5.c is built with renamed symbols and measured over the same
+ * data, and both digests must agree.
+ *
+ * Usage: bench_md5
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "hash.h"
+
+#define CL_WUPS_BENCH_SIZE (32 * 1024 * 1024)
+#define CL_WUPS_BENCH_ROUNDS 3
+
+#ifdef CL_WUPS_BENCH_LIBRETRO
+extern "C"
+{
+  void retro_MD5_Init(MD5_CTX *ctx);
+  void retro_MD5_Update(MD5_CTX *ctx, const void *data, unsigned long size);
+  void retro_MD5_Final(unsigned char *result, MD5_CTX *ctx);
+}
+#endif
+
+template <typename Init, typename Update, typename Final>
+static double cl_wups_bench_time(const std::vector<uint8_t> &buffer,
+                                 Init init, Update update, Final final,
+                                 unsigned char *digest)
+{
+  double best = 0;
+
+  for (unsigned round = 0; round < CL_WUPS_BENCH_ROUNDS; round++)
+  {
+    auto start = std::chrono::steady_clock::now();
+    MD5_CTX ctx;
+
+    init(&ctx);
+    update(&ctx, buffer.data(), buffer.size());
+    final(digest, &ctx);
+
+    std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+    double rate = buffer.size() / elapsed.count() / (1024 * 1024);
+
+    if (rate > best)
+      best = rate;
+  }
+
+  return best;
+}
+
+int main(void)
+{
+  std::vector<uint8_t> buffer(CL_WUPS_BENCH_SIZE);
+  unsigned char digest[16];
+  uint32_t state = 0x2545F491;
+
+  for (auto &byte : buffer)
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    byte = (uint8_t)state;
+  }
+
+  printf("%u MB, best of %u rounds\n", CL_WUPS_BENCH_SIZE >> 20,
+         CL_WUPS_BENCH_ROUNDS);
+  printf("hash.cpp:       %7.1f MB/s\n",
+         cl_wups_bench_time(buffer, MD5_Init, MD5_Update, MD5_Final, digest));
+
+#ifdef CL_WUPS_BENCH_LIBRETRO
+  unsigned char reference[16];
+
+  printf("libretro-common: %6.1f MB/s\n",
+         cl_wups_bench_time(buffer, retro_MD5_Init, retro_MD5_Update,
+                            retro_MD5_Final, reference));
+  if (memcmp(digest, reference, sizeof(digest)))
+  {
+    fprintf(stderr, "Digests disagree.\n");
+    return 1;
+  }
+#else
+  printf("libretro-common: not checked out, not compared\n");
+#endif
+
+  return 0;
+}
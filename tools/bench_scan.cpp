@@ -0,0 +1,85 @@
+/**
+ * Measures the throughput of the ROM scan kernel behind scan_block() against
+ * a loop doing one load and compare per word, over synthetic buffers the size
+ * of the N64 and NDS search ranges that don't contain the magic.
+ *
+ * Usage: bench_scan
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "guest.h"
+#include "scan.h"
+#include "title.h"
+
+#define CL_WUPS_BENCH_ROUNDS 3
+
+static const uint32_t *cl_wups_bench_naive(const uint32_t *start,
+                                           const uint32_t *end, uint32_t magic)
+{
+  for (const uint32_t *i = start; i < end; i++)
+    if (guest_load32(i) == magic)
+      return i;
+
+  return end;
+}
+
+template <typename Scan>
+static double cl_wups_bench_time(const std::vector<uint32_t> &buffer,
+                                 Scan &&scan)
+{
+  const uint32_t *start = buffer.data();
+  const uint32_t *end = start + buffer.size();
+  double best = 0;
+
+  for (unsigned round = 0; round < CL_WUPS_BENCH_ROUNDS; round++)
+  {
+    auto begin = std::chrono::steady_clock::now();
+
+    if (scan(start, end) != end)
+      abort();
+
+    std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - begin;
+    double rate = buffer.size() * sizeof(uint32_t) / elapsed.count() / 1e6;
+
+    if (rate > best)
+      best = rate;
+  }
+
+  return best;
+}
+
+static void cl_wups_bench_range(const char *name, uint32_t size)
+{
+  std::vector<uint32_t> buffer(size / sizeof(uint32_t));
+  uint32_t state = 0x12345678;
+
+  /* Random words, with any that happen to match the magic changed */
+  for (auto &word : buffer)
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    word = state;
+    if (guest_load32(&word) == CL_WUPS_N64_ROM_MAGIC)
+      word = 0;
+  }
+
+  printf("%-4s %4u MB: kernel %8.1f MB/s, naive %8.1f MB/s\n", name,
+         size >> 20,
+         cl_wups_bench_time(buffer, [](const uint32_t *start, const uint32_t *end)
+           { return scan_block(start, end, CL_WUPS_N64_ROM_MAGIC); }),
+         cl_wups_bench_time(buffer, [](const uint32_t *start, const uint32_t *end)
+           { return cl_wups_bench_naive(start, end, CL_WUPS_N64_ROM_MAGIC); }));
+}
+
+int main(void)
+{
+  cl_wups_bench_range("N64", scan_system_n64.end - scan_system_n64.start);
+  cl_wups_bench_range("NDS", scan_system_nds.end - scan_system_nds.start);
+
+  return 0;
+}
@@ -0,0 +1,122 @@
+/**
+ * Compares title_get_system(), which looks titles up through the minimal
+ * perfect hash in the title database, with a linear walk over the same
+ * titles like the original built-in table used. Both are timed over every
+ * known title (hits) and over as many unknown IDs (misses).
+ *
+ * Usage: bench_titles [titles.tsv]
+ */
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "title.h"
+
+#define CL_WUPS_BENCH_ROUNDS 200
+
+typedef struct
+{
+  uint64_t id;
+  unsigned type;
+} cl_wups_bench_title_t;
+
+static unsigned cl_wups_bench_linear(const cl_wups_bench_title_t *titles,
+                                     uint64_t title_id)
+{
+  const cl_wups_bench_title_t *title = &titles[0];
+
+  while (title->type)
+  {
+    if (title->id == title_id)
+      return title->type;
+    else
+      title++;
+  }
+
+  return 0;
+}
+
+template <typename Lookup>
+static double cl_wups_bench_time(const std::vector<uint64_t> &ids,
+                                 Lookup &&lookup, unsigned *sum)
+{
+  auto start = std::chrono::steady_clock::now();
+
+  for (unsigned round = 0; round < CL_WUPS_BENCH_ROUNDS; round++)
+    for (uint64_t id : ids)
+      *sum += lookup(id);
+
+  std::chrono::duration<double, std::nano> elapsed =
+    std::chrono::steady_clock::now() - start;
+
+  return elapsed.count() / ((double)ids.size() * CL_WUPS_BENCH_ROUNDS);
+}
+
+int main(int argc, char **argv)
+{
+  const char *path = argc > 1 ? argv[1] : "../data/titles.tsv";
+  std::vector<cl_wups_bench_title_t> titles;
+  std::vector<uint64_t> hits, misses;
+  std::set<uint64_t> known;
+  std::ifstream file(path);
+  std::string line;
+  unsigned sum_hash = 0, sum_linear = 0;
+
+  if (!title_init())
+  {
+    fprintf(stderr, "Could not open the built-in title database.\n");
+    return 1;
+  }
+  if (!file)
+  {
+    fprintf(stderr, "Could not open %s.\n", path);
+    return 1;
+  }
+
+  while (std::getline(file, line))
+  {
+    if (line.empty() || line[0] == '#')
+      continue;
+    uint64_t id = strtoull(line.c_str(), nullptr, 16);
+    titles.push_back({ id, title_get_system(id) });
+    hits.push_back(id);
+    known.insert(id);
+  }
+  titles.push_back({ 0, 0 });
+
+  /* Nearby IDs of the same kind, which share the high word */
+  for (uint64_t id : hits)
+    if (!known.count(id + 0x80))
+      misses.push_back(id + 0x80);
+
+  for (uint64_t id : hits)
+    if (cl_wups_bench_linear(titles.data(), id) != title_get_system(id) ||
+        !title_get_system(id))
+    {
+      fprintf(stderr, "Lookups disagree on %016llX.\n", (unsigned long long)id);
+      return 1;
+    }
+  for (uint64_t id : misses)
+    if (title_get_system(id))
+    {
+      fprintf(stderr, "Unknown title %016llX was found.\n", (unsigned long long)id);
+      return 1;
+    }
+
+  printf("%zu titles, %zu misses, %u rounds\n", hits.size(), misses.size(),
+         CL_WUPS_BENCH_ROUNDS);
+  printf("hits:   perfect hash %7.2f ns, linear walk %9.2f ns\n",
+         cl_wups_bench_time(hits, title_get_system, &sum_hash),
+         cl_wups_bench_time(hits, [&](uint64_t id)
+           { return cl_wups_bench_linear(titles.data(), id); }, &sum_linear));
+  printf("misses: perfect hash %7.2f ns, linear walk %9.2f ns\n",
+         cl_wups_bench_time(misses, title_get_system, &sum_hash),
+         cl_wups_bench_time(misses, [&](uint64_t id)
+           { return cl_wups_bench_linear(titles.data(), id); }, &sum_linear));
+
+  return sum_hash == sum_linear ? 0 : 1;
+}
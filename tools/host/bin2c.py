@@ -0,0 +1,35 @@
+#!/usr/bin/env python3
+"""Embeds a binary file for host builds, the way bin2o does for the plugin.
+
+Writes <prefix>.h and <prefix>.cpp declaring and defining <name>_bin and
+<name>_bin_size, where <name> is the input file name without its extension.
+"""
+
+import os
+import sys
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage: bin2c.py <input> <output prefix>")
+
+    path, prefix = sys.argv[1], sys.argv[2]
+    name = os.path.splitext(os.path.basename(path))[0] + "_bin"
+    with open(path, "rb") as f:
+        data = f.read()
+
+    with open(prefix + ".h", "w") as f:
+        f.write("#pragma once\n#include <cstdint>\n")
+        f.write("extern const uint8_t %s[];\n" % name)
+        f.write("extern const uint32_t %s_size;\n" % name)
+
+    with open(prefix + ".cpp", "w") as f:
+        f.write('#include "%s.h"\n' % os.path.basename(prefix))
+        f.write("alignas(4) const uint8_t %s[] =\n{\n" % name)
+        for i in range(0, len(data), 16):
+            f.write("  %s,\n" % ", ".join("0x%02X" % b for b in data[i:i + 16]))
+        f.write("};\nconst uint32_t %s_size = %u;\n" % (name, len(data)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,36 @@
+#ifndef CL_WUPS_HOST_COREINIT_DYNLOAD_H
+#define CL_WUPS_HOST_COREINIT_DYNLOAD_H
+
+#include <cstdint>
+
+/**
+ * Host stand-in for wut's coreinit/dynload.h. No modules are loaded on the
+ * host, so title_detect_system() always finds nothing.
+ */
+
+typedef struct
+{
+  char *name;
+  uint32_t textAddr;
+  uint32_t textOffset;
+  uint32_t textSize;
+  uint32_t dataAddr;
+  uint32_t dataOffset;
+  uint32_t dataSize;
+  uint32_t readAddr;
+  uint32_t readOffset;
+  uint32_t readSize;
+} OSDynLoad_NotifyData;
+
+static inline int OSDynLoad_GetNumberOfRPLs(void)
+{
+  return 0;
+}
+
+static inline bool OSDynLoad_GetRPLInfo(uint32_t first, uint32_t count,
+                                        OSDynLoad_NotifyData *infos)
+{
+  return false;
+}
+
+#endif
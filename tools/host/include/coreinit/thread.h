@@ -0,0 +1,46 @@
+#ifndef CL_WUPS_HOST_COREINIT_THREAD_H
+#define CL_WUPS_HOST_COREINIT_THREAD_H
+
+#include <cstdint>
+
+#include <coreinit/time.h>
+
+/**
+ * Host stand-in for the parts of wut's coreinit/thread.h the plugin uses.
+ * Threads run on std::thread; affinity and priority are ignored.
+ */
+
+typedef int (*OSThreadEntryPointFn)(int argc, const char **argv);
+
+typedef uint8_t OSThreadAttributes;
+
+enum
+{
+  OS_THREAD_ATTRIB_AFFINITY_CPU0 = 1 << 0,
+  OS_THREAD_ATTRIB_AFFINITY_CPU1 = 1 << 1,
+  OS_THREAD_ATTRIB_AFFINITY_CPU2 = 1 << 2,
+  OS_THREAD_ATTRIB_AFFINITY_ANY = 7,
+  OS_THREAD_ATTRIB_DETACHED = 1 << 3,
+};
+
+typedef struct OSThread
+{
+  OSThreadEntryPointFn entry;
+  int argc;
+  char *argv;
+  void *host;
+  int result;
+} OSThread;
+
+bool OSCreateThread(OSThread *thread, OSThreadEntryPointFn entry, int argc,
+                    char *argv, void *stack, uint32_t stack_size,
+                    int32_t priority, OSThreadAttributes attributes);
+int32_t OSResumeThread(OSThread *thread);
+bool OSJoinThread(OSThread *thread, int *result);
+bool OSIsThreadTerminated(OSThread *thread);
+void OSSetThreadName(OSThread *thread, const char *name);
+uint32_t OSGetCoreId(void);
+void OSYieldThread(void);
+void OSSleepTicks(OSTime ticks);
+
+#endif
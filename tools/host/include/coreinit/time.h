@@ -0,0 +1,25 @@
+#ifndef CL_WUPS_HOST_COREINIT_TIME_H
+#define CL_WUPS_HOST_COREINIT_TIME_H
+
+#include <cstdint>
+
+/**
+ * Host stand-in for wut's coreinit/time.h, keeping the console's timer rate
+ * of 62.15625 MHz so tick arithmetic behaves the same.
+ */
+
+typedef int64_t OSTime;
+typedef int32_t OSTick;
+
+#define OSTimerClockSpeed 62156250ll
+
+#define OSSecondsToTicks(val) ((uint64_t)(val) * (uint64_t)OSTimerClockSpeed)
+#define OSMillisecondsToTicks(val) (((uint64_t)(val) * (uint64_t)OSTimerClockSpeed) / 1000ull)
+#define OSNanosecondsToTicks(val) ((((uint64_t)(val) * ((uint64_t)OSTimerClockSpeed / 31250ull)) / 32000ull))
+#define OSTicksToMilliseconds(val) (((uint64_t)(val) * 1000ull) / (uint64_t)OSTimerClockSpeed)
+#define OSTicksToMicroseconds(val) (((uint64_t)(val) * 1000000ull) / (uint64_t)OSTimerClockSpeed)
+
+OSTime OSGetTime(void);
+OSTick OSGetTick(void);
+
+#endif
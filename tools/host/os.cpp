@@ -0,0 +1,97 @@
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include <coreinit/thread.h>
+#include <coreinit/time.h>
+
+/* Implementations of the host stand-ins in host/include/coreinit */
+
+typedef struct
+{
+  std::thread thread;
+  std::atomic<bool> done;
+} cl_wups_host_thread_t;
+
+OSTime OSGetTime(void)
+{
+  auto now = std::chrono::steady_clock::now().time_since_epoch();
+
+  return (OSTime)OSNanosecondsToTicks(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
+
+OSTick OSGetTick(void)
+{
+  return (OSTick)OSGetTime();
+}
+
+bool OSCreateThread(OSThread *thread, OSThreadEntryPointFn entry, int argc,
+                    char *argv, void *stack, uint32_t stack_size,
+                    int32_t priority, OSThreadAttributes attributes)
+{
+  thread->entry = entry;
+  thread->argc = argc;
+  thread->argv = argv;
+  thread->host = nullptr;
+  thread->result = 0;
+
+  return true;
+}
+
+int32_t OSResumeThread(OSThread *thread)
+{
+  auto *host = new cl_wups_host_thread_t;
+
+  host->done = false;
+  thread->host = host;
+  host->thread = std::thread([thread, host]
+  {
+    thread->result = thread->entry(thread->argc, (const char**)thread->argv);
+    host->done = true;
+  });
+
+  return 0;
+}
+
+bool OSJoinThread(OSThread *thread, int *result)
+{
+  auto *host = (cl_wups_host_thread_t*)thread->host;
+
+  if (!host)
+    return false;
+  host->thread.join();
+  delete host;
+  thread->host = nullptr;
+  if (result)
+    *result = thread->result;
+
+  return true;
+}
+
+bool OSIsThreadTerminated(OSThread *thread)
+{
+  auto *host = (cl_wups_host_thread_t*)thread->host;
+
+  return !host || host->done;
+}
+
+void OSSetThreadName(OSThread *thread, const char *name)
+{
+}
+
+uint32_t OSGetCoreId(void)
+{
+  return 0;
+}
+
+void OSYieldThread(void)
+{
+  std::this_thread::yield();
+}
+
+void OSSleepTicks(OSTime ticks)
+{
+  std::this_thread::sleep_for(
+    std::chrono::microseconds(OSTicksToMicroseconds(ticks)));
+}
@@ -0,0 +1,72 @@
+/**
+ * Runs ROM and RAM discovery against memory dumps taken from a console, to
+ * check what the plugin would find for a title without running it. Each
+ * dump is mapped at the address it was taken from, which must be
+ * page-aligned, and the heap address is that of the foreground process heap
+ * in MEM2 (MEMGetBaseHeapHandle(MEM_BASE_HEAP_MEM2) on the console).
+ *
+ * Usage: scan_dump <heap address> <address>:<dump file>...
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "guest.h"
+#include "scan.h"
+
+template <const scan_system_t &System>
+static void cl_wups_dump_rom(const char *name)
+{
+  scan_cursor_t cursor = {};
+
+  if (scan_rom<System>(&cursor))
+    printf("%-10s ROM at %08X, %u bytes (phase %u)\n", name,
+           guest_addr(cursor.rom), cursor.size, cursor.phase);
+  else
+    printf("%-10s ROM not found\n", name);
+}
+
+static void cl_wups_dump_ram(const char *name, uint32_t size,
+                             scan_ram_probe_t probe)
+{
+  uint32_t ram = scan_ram(size, probe);
+
+  if (ram)
+    printf("%-10s RAM at %08X, %u bytes\n", name, ram, size);
+  else
+    printf("%-10s RAM not found\n", name);
+}
+
+int main(int argc, char **argv)
+{
+  if (argc < 3)
+  {
+    fprintf(stderr, "Usage: %s <heap address> <address>:<dump file>...\n",
+            argv[0]);
+    return 1;
+  }
+
+  for (int i = 2; i < argc; i++)
+  {
+    char *path;
+    uint32_t addr = strtoul(argv[i], &path, 16);
+
+    if (*path != ':' || !guest_map(addr, path + 1))
+    {
+      fprintf(stderr, "Could not map %s.\n", argv[i]);
+      return 1;
+    }
+  }
+  guest_set_heap(strtoul(argv[1], nullptr, 16));
+
+  cl_wups_dump_rom<scan_system_n64>("N64");
+  cl_wups_dump_rom<scan_system_nds>("NDS");
+  cl_wups_dump_rom<scan_system_nes>("NES");
+  cl_wups_dump_rom<scan_system_snes_lorom>("SNES LoROM");
+  cl_wups_dump_rom<scan_system_snes_hirom>("SNES HiROM");
+  cl_wups_dump_rom<scan_system_gba>("GBA");
+  cl_wups_dump_ram("GBA IWRAM", CL_WUPS_GBA_IWRAM_SIZE, scan_probe_gba_iwram);
+  cl_wups_dump_ram("MSX", CL_WUPS_MSX_RAM_SIZE, scan_probe_msx_ram);
+
+  return 0;
+}
@@ -0,0 +1,235 @@
+/**
+ * Runs ROM and RAM discovery against a synthetic memory dump mapped through
+ * guest_map(), laid out like the foreground process heap of a Virtual
+ * Console title: an expanded heap with a child heap carved out of it, ROM
+ * images inside and outside of heap blocks, and blocks of emulated RAM next
+ * to decoys of the same size.
+ *
+ * Usage: test_guest
+ */
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include <unistd.h>
+
+#include "guest.h"
+#include "scan.h"
+
+/* Where the dump is mapped, and the heap and blocks within it */
+#define CL_WUPS_TEST_BASE 0x10000000
+#define CL_WUPS_TEST_SIZE 0x1000000
+#define CL_WUPS_TEST_HEAP CL_WUPS_TEST_BASE
+#define CL_WUPS_TEST_CHILD (CL_WUPS_TEST_BASE + 0x100000)
+#define CL_WUPS_TEST_NES_BLOCK (CL_WUPS_TEST_BASE + 0x1000)
+#define CL_WUPS_TEST_DECOY_BLOCK (CL_WUPS_TEST_BASE + 0x20000)
+#define CL_WUPS_TEST_IWRAM_BLOCK (CL_WUPS_TEST_BASE + 0x30000)
+#define CL_WUPS_TEST_MSX_BLOCK (CL_WUPS_TEST_CHILD + 0x200)
+#define CL_WUPS_TEST_NES_LOOSE (CL_WUPS_TEST_BASE + 0x600010)
+
+/* Heap and block header fields, as laid out by Cafe OS */
+#define CL_WUPS_TEST_EXP_HEAP_TAG 0x45585048
+#define CL_WUPS_TEST_BLOCK_DATA 0x14
+
+/* PRG and CHR banks of the test NES images */
+#define CL_WUPS_TEST_NES_SIZE (16 + 2 * 16 * 1024 + 1 * 8 * 1024)
+
+static std::vector<uint8_t> cl_wups_test_dump(CL_WUPS_TEST_SIZE);
+static unsigned cl_wups_test_failures = 0;
+
+static uint8_t *cl_wups_test_at(uint32_t addr)
+{
+  return &cl_wups_test_dump[addr - CL_WUPS_TEST_BASE];
+}
+
+static void cl_wups_test_store16(uint32_t addr, uint16_t value)
+{
+  uint8_t *bytes = cl_wups_test_at(addr);
+
+  bytes[0] = value >> 8;
+  bytes[1] = value;
+}
+
+static void cl_wups_test_store32(uint32_t addr, uint32_t value)
+{
+  uint8_t *bytes = cl_wups_test_at(addr);
+
+  bytes[0] = value >> 24;
+  bytes[1] = value >> 16;
+  bytes[2] = value >> 8;
+  bytes[3] = value;
+}
+
+static void cl_wups_test_heap(uint32_t heap, uint32_t end, uint32_t first_block)
+{
+  cl_wups_test_store32(heap + 0x00, CL_WUPS_TEST_EXP_HEAP_TAG);
+  cl_wups_test_store32(heap + 0x18, heap + 0x100);
+  cl_wups_test_store32(heap + 0x1C, end);
+  cl_wups_test_store32(heap + 0x48, first_block);
+}
+
+/* Adds a used block holding size bytes, returning the address of the data */
+static uint32_t cl_wups_test_block(uint32_t block, uint32_t size, uint32_t next)
+{
+  cl_wups_test_store32(block + 0x04, size);
+  cl_wups_test_store32(block + 0x0C, next);
+
+  return block + CL_WUPS_TEST_BLOCK_DATA;
+}
+
+static void cl_wups_test_nes(uint32_t addr)
+{
+  uint8_t *rom = cl_wups_test_at(addr);
+
+  memcpy(rom, "NES", 4);
+  rom[4] = 2;
+  rom[5] = 1;
+  for (uint32_t i = 16; i < CL_WUPS_TEST_NES_SIZE; i++)
+    rom[i] = (uint8_t)(i * 7);
+}
+
+static void cl_wups_test_expect(bool ok, const char *what)
+{
+  if (!ok)
+  {
+    printf("test_guest: %s\n", what);
+    cl_wups_test_failures++;
+  }
+}
+
+int main(void)
+{
+  char path[] = "/tmp/test_guest.XXXXXX";
+  uint32_t nes, iwram, msx;
+  std::atomic<bool> cancel(true);
+  scan_cursor_t cursor = {};
+  FILE *file;
+  int fd;
+
+  /* Root heap, and a child heap linked through the word at 0x04 + 0x04 */
+  cl_wups_test_heap(CL_WUPS_TEST_HEAP, CL_WUPS_TEST_BASE + CL_WUPS_TEST_SIZE,
+                    CL_WUPS_TEST_NES_BLOCK);
+  cl_wups_test_store32(CL_WUPS_TEST_HEAP + 0x0C, CL_WUPS_TEST_CHILD);
+  cl_wups_test_store16(CL_WUPS_TEST_HEAP + 0x16, 0x04);
+  cl_wups_test_heap(CL_WUPS_TEST_CHILD, CL_WUPS_TEST_CHILD + 0x400000,
+                    CL_WUPS_TEST_MSX_BLOCK);
+
+  nes = cl_wups_test_block(CL_WUPS_TEST_NES_BLOCK, 0x10000,
+                           CL_WUPS_TEST_DECOY_BLOCK);
+  cl_wups_test_nes(nes);
+  cl_wups_test_nes(CL_WUPS_TEST_NES_LOOSE);
+
+  /* Two IWRAM-sized blocks, only one of which has an interrupt handler set */
+  cl_wups_test_block(CL_WUPS_TEST_DECOY_BLOCK, CL_WUPS_GBA_IWRAM_SIZE,
+                     CL_WUPS_TEST_IWRAM_BLOCK);
+  iwram = cl_wups_test_block(CL_WUPS_TEST_IWRAM_BLOCK, CL_WUPS_GBA_IWRAM_SIZE, 0);
+  memcpy(cl_wups_test_at(iwram + 0x7FFC), "\xF0\x7F\x00\x03", 4);
+
+  /* MSX main RAM with the BIOS hooks set to RET */
+  msx = cl_wups_test_block(CL_WUPS_TEST_MSX_BLOCK, CL_WUPS_MSX_RAM_SIZE, 0);
+  memset(cl_wups_test_at(msx + 0xFD9A), 0xC9, 0xFFB1 - 0xFD9A);
+
+  if ((fd = mkstemp(path)) < 0 || !(file = fdopen(fd, "wb")))
+  {
+    printf("test_guest: could not create %s\n", path);
+    return 1;
+  }
+  fwrite(cl_wups_test_dump.data(), 1, cl_wups_test_dump.size(), file);
+  fclose(file);
+  if (!guest_map(CL_WUPS_TEST_BASE, path))
+  {
+    printf("test_guest: could not map %s\n", path);
+    unlink(path);
+    return 1;
+  }
+  unlink(path);
+  guest_set_heap(CL_WUPS_TEST_HEAP);
+
+  /* Unmapped memory */
+  cl_wups_test_expect(!guest_ptr(CL_WUPS_TEST_BASE + CL_WUPS_TEST_SIZE),
+                      "guest_ptr past the dump is not nullptr");
+  cl_wups_test_expect(!guest_range(CL_WUPS_TEST_BASE + CL_WUPS_TEST_SIZE - 2, 4),
+                      "guest_range across the end of the dump is not nullptr");
+  cl_wups_test_expect(!guest_read32(CL_WUPS_TEST_BASE - 4),
+                      "guest_read32 before the dump is not 0");
+  cl_wups_test_expect(guest_read32(CL_WUPS_TEST_HEAP) == CL_WUPS_TEST_EXP_HEAP_TAG,
+                      "guest_read32 does not read the heap tag");
+
+  /* RAM, only where the probe recognizes it */
+  cl_wups_test_expect(scan_ram(CL_WUPS_MSX_RAM_SIZE, scan_probe_msx_ram) == msx,
+                      "MSX RAM not found in the child heap");
+  cl_wups_test_expect(scan_ram(CL_WUPS_GBA_IWRAM_SIZE, scan_probe_gba_iwram) == iwram,
+                      "GBA IWRAM not told apart from the decoy block");
+  cl_wups_test_expect(scan_ram_check(msx, CL_WUPS_MSX_RAM_SIZE, scan_probe_msx_ram),
+                      "MSX RAM location not confirmed");
+  cl_wups_test_expect(!scan_ram_check(CL_WUPS_TEST_DECOY_BLOCK + CL_WUPS_TEST_BLOCK_DATA,
+                                      CL_WUPS_GBA_IWRAM_SIZE, scan_probe_gba_iwram),
+                      "GBA IWRAM decoy confirmed");
+
+  /* A cancelled search finds nothing */
+  cursor.phase = 1;
+  cursor.cancel = &cancel;
+  cl_wups_test_expect(!scan_rom<scan_system_nes>(&cursor),
+                      "cancelled scan returned a ROM");
+
+  /* The image in the heap first, then the loose one once it is rejected */
+  cursor = {};
+  cl_wups_test_expect(scan_rom<scan_system_nes>(&cursor) &&
+                      guest_addr(cursor.rom) == nes &&
+                      cursor.size == CL_WUPS_TEST_NES_SIZE,
+                      "NES ROM not found in the heap");
+  scan_reject(&cursor, cursor.rom);
+  cursor.phase = 0;
+  cursor.rom = nullptr;
+  cl_wups_test_expect(scan_rom<scan_system_nes>(&cursor) &&
+                      guest_addr(cursor.rom) == CL_WUPS_TEST_NES_LOOSE,
+                      "rejected NES ROM returned again");
+  cl_wups_test_expect(scan_check<scan_system_nes>(guest_ptr(nes)) ==
+                      CL_WUPS_TEST_NES_SIZE,
+                      "NES ROM in the heap not checked");
+
+  /* GBA images padded with 0xFF, in allocations of a few sizes */
+  std::vector<uint8_t> gba(0x1000020, 0xFF);
+  gba[0x7FFFFF] = 0x12;
+  cl_wups_test_expect(scan_trim_gba(gba.data(), 0x1000000) == 0x1000000,
+                      "GBA image filling a power of two allocation trimmed");
+  cl_wups_test_expect(scan_trim_gba(gba.data(), 0x1000020) == 0x1000000,
+                      "GBA image not cut down to the dump size it holds");
+  gba[0xBFFFFF] = 0x34;
+  cl_wups_test_expect(scan_trim_gba(gba.data(), 0xC00020) == 0xC00000,
+                      "GBA image that is not a power of two not cut to 32 KB");
+
+  /**
+   * Every specialization main.cpp uses, so that one scan.cpp doesn't
+   * instantiate fails to link here too. Only NES has an image in the dump.
+   */
+  cl_wups_test_expect(scan_rom_loaded<scan_system_nes>(),
+                      "NES ROM in the heap not seen as loaded");
+  cl_wups_test_expect(!scan_rom_loaded<scan_system_snes_lorom>() &&
+                      !scan_rom_loaded<scan_system_snes_hirom>() &&
+                      !scan_rom_loaded<scan_system_gba>(),
+                      "ROM of another system seen as loaded");
+  cl_wups_test_expect(!scan_check<scan_system_n64>(guest_ptr(nes)) &&
+                      !scan_check<scan_system_nds>(guest_ptr(nes)) &&
+                      !scan_check<scan_system_snes_lorom>(guest_ptr(nes)) &&
+                      !scan_check<scan_system_snes_hirom>(guest_ptr(nes)) &&
+                      !scan_check<scan_system_gba>(guest_ptr(nes)),
+                      "NES ROM checked as another system");
+  cursor = {};
+  cl_wups_test_expect(!scan_rom<scan_system_n64>(&cursor) &&
+                      !scan_rom<scan_system_nds>(&cursor) &&
+                      !scan_rom<scan_system_snes_lorom>(&cursor) &&
+                      !scan_rom<scan_system_snes_hirom>(&cursor) &&
+                      !scan_rom<scan_system_gba>(&cursor),
+                      "ROM of another system found");
+
+  if (cl_wups_test_failures)
+  {
+    printf("test_guest: %u checks failed\n", cl_wups_test_failures);
+    return 1;
+  }
+  printf("test_guest: all checks passed\n");
+
+  return 0;
+}
@@ -0,0 +1,108 @@
+/**
+ * Checks the MD5 functions hash.cpp provides in place of libretro-common's
+ * against the RFC 1321 test suite, and that feeding the same data through
+ * MD5_Update in pieces of every size around the block and chunk boundaries
+ * gives the digest of a single call. A set cancel flag must stop MD5_Update
+ * early.
+ *
+ * Usage: test_md5
+ */
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "hash.h"
+
+static const char *cl_wups_test_vectors[][2] =
+{
+  { "", "d41d8cd98f00b204e9800998ecf8427e" },
+  { "a", "0cc175b9c0f1b6a831c399e269772661" },
+  { "abc", "900150983cd24fb0d6963f7d28e17f72" },
+  { "message digest", "f96b697d7cb7938d525a2f31aaf161d0" },
+  { "abcdefghijklmnopqrstuvwxyz", "c3fcd3d76192e4007dfb496cca67e13b" },
+  { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+    "d174ab98d277d9f5a5611c2c9f419d9f" },
+  { "1234567890123456789012345678901234567890"
+    "1234567890123456789012345678901234567890",
+    "57edf4a22be3c955ac49da2e2107b67a" }
+};
+
+static unsigned cl_wups_test_failures = 0;
+
+static std::string cl_wups_test_md5(const uint8_t *data, size_t size,
+                                    size_t piece)
+{
+  MD5_CTX ctx;
+  unsigned char digest[16];
+  char hex[33];
+
+  MD5_Init(&ctx);
+  for (size_t offset = 0; offset < size; offset += piece)
+    MD5_Update(&ctx, data + offset, size - offset < piece ? size - offset : piece);
+  MD5_Final(digest, &ctx);
+  for (unsigned i = 0; i < 16; i++)
+    snprintf(&hex[i * 2], 3, "%02x", digest[i]);
+
+  return hex;
+}
+
+static void cl_wups_test_expect(bool ok, const char *what, size_t value)
+{
+  if (!ok && cl_wups_test_failures++ < 10)
+    printf("test_md5: %s (%zu)\n", what, value);
+}
+
+int main(void)
+{
+  std::vector<uint8_t> data(0x30000 + 129);
+  std::atomic<bool> cancel(false);
+  uint32_t state = 0x2545F491;
+
+  for (auto &vector : cl_wups_test_vectors)
+    cl_wups_test_expect(cl_wups_test_md5((const uint8_t*)vector[0],
+                                         strlen(vector[0]), 1 << 20) == vector[1],
+                        "RFC 1321 vector does not match", strlen(vector[0]));
+
+  std::vector<uint8_t> million(1000000, 'a');
+  cl_wups_test_expect(cl_wups_test_md5(million.data(), million.size(), 1 << 20) ==
+                      "7707d6ae4e027c70eea2a935c2296f21",
+                      "a million 'a's do not match", million.size());
+
+  for (auto &byte : data)
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    byte = (uint8_t)state;
+  }
+
+  /* Every tail length, so the padding spills into a second block or not */
+  for (size_t size = 0; size <= 192; size++)
+    cl_wups_test_expect(cl_wups_test_md5(data.data(), size, 1) ==
+                        cl_wups_test_md5(data.data(), size, size + 1),
+                        "byte-wise updates differ at size", size);
+
+  /* Pieces that leave partial blocks, across the chunk size */
+  for (size_t piece : { 1, 7, 63, 64, 65, 1000, 0x10000 - 1, 0x10000, 0x10001 })
+    cl_wups_test_expect(cl_wups_test_md5(data.data(), data.size(), piece) ==
+                        cl_wups_test_md5(data.data(), data.size(), data.size()),
+                        "updates in pieces differ for piece size", piece);
+
+  /* A cancelled hash stops after the first chunk, so the digest is off */
+  std::string full = cl_wups_test_md5(data.data(), data.size(), data.size());
+  hash_set_cancel(&cancel);
+  cancel = true;
+  cl_wups_test_expect(cl_wups_test_md5(data.data(), data.size(), data.size()) != full,
+                      "cancel flag was ignored", data.size());
+  hash_set_cancel(nullptr);
+
+  if (cl_wups_test_failures)
+  {
+    printf("test_md5: %u checks failed\n", cl_wups_test_failures);
+    return 1;
+  }
+  printf("test_md5: all checks passed\n");
+
+  return 0;
+}
@@ -0,0 +1,82 @@
+/**
+ * Checks that the ROM scan kernel behind scan_block() finds the same first
+ * match as a plain word-by-word loop, over random ranges whose ends fall at
+ * every position within a cache line.
+ *
+ * Usage: test_scan
+ */
+#include <cstdio>
+#include <vector>
+
+#include "guest.h"
+#include "scan.h"
+
+#define CL_WUPS_TEST_MAGIC 0x80371240
+#define CL_WUPS_TEST_WORDS 0x1000
+#define CL_WUPS_TEST_CASES 20000
+
+static uint32_t cl_wups_test_state = 0x2545F491;
+
+static uint32_t cl_wups_test_random(void)
+{
+  cl_wups_test_state ^= cl_wups_test_state << 13;
+  cl_wups_test_state ^= cl_wups_test_state >> 17;
+  cl_wups_test_state ^= cl_wups_test_state << 5;
+
+  return cl_wups_test_state;
+}
+
+static void cl_wups_test_store(uint32_t *word, uint32_t value)
+{
+  auto bytes = (uint8_t*)word;
+
+  bytes[0] = value >> 24;
+  bytes[1] = value >> 16;
+  bytes[2] = value >> 8;
+  bytes[3] = value;
+}
+
+int main(void)
+{
+  std::vector<uint32_t> buffer(CL_WUPS_TEST_WORDS);
+  unsigned failures = 0;
+
+  for (unsigned test = 0; test < CL_WUPS_TEST_CASES; test++)
+  {
+    uint32_t first = cl_wups_test_random() % CL_WUPS_TEST_WORDS;
+    uint32_t last = first + cl_wups_test_random() % (CL_WUPS_TEST_WORDS - first + 1);
+    unsigned planted = cl_wups_test_random() % 4;
+    const uint32_t *start = buffer.data() + first;
+    const uint32_t *end = buffer.data() + last;
+    const uint32_t *expected = end;
+    const uint32_t *result;
+
+    for (auto &word : buffer)
+      if (guest_load32(&(word = cl_wups_test_random())) == CL_WUPS_TEST_MAGIC)
+        word = 0;
+    for (unsigned i = 0; i < planted; i++)
+      cl_wups_test_store(&buffer[cl_wups_test_random() % CL_WUPS_TEST_WORDS],
+                         CL_WUPS_TEST_MAGIC);
+
+    for (const uint32_t *i = start; i < end; i++)
+      if (guest_load32(i) == CL_WUPS_TEST_MAGIC)
+      {
+        expected = i;
+        break;
+      }
+
+    result = scan_block(start, end, CL_WUPS_TEST_MAGIC);
+    if (result != expected && failures++ < 10)
+      printf("Range [%u, %u): expected word %td, got %td\n", first, last,
+             expected - buffer.data(), result - buffer.data());
+  }
+
+  if (failures)
+  {
+    printf("test_scan: %u of %u cases failed\n", failures, CL_WUPS_TEST_CASES);
+    return 1;
+  }
+  printf("test_scan: %u cases passed\n", CL_WUPS_TEST_CASES);
+
+  return 0;
+}
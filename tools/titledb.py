@@ -0,0 +1,145 @@
+#!/usr/bin/env python3
+"""
+Builds a Classics Live title database blob from a tab-separated title list.
+
+Input lines are "<16-digit hex title ID>\t<system>\t<name>"; blank lines and
+lines starting with '#' are ignored. The output is read directly by
+source/title.cpp, so its layout and hash functions must be kept in sync:
+
+    uint32 magic            'CLTD'
+    uint32 version          1
+    uint32 id_high          high word shared by every title ID
+    uint32 count            number of titles
+    uint32 bucket_count     number of hash buckets
+    uint16 disps[bucket_count], padded to a multiple of 4 bytes
+    uint32 ids[count]       low word of each title ID, in hash slot order
+    uint8  types[(count + 1) / 2], two 4-bit title types per byte
+
+Integers are big-endian unless --little-endian is passed.
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = 0x434C5444
+VERSION = 1
+BUCKET_SIZE = 4
+
+# Must match the CL_WUPS_TITLE_* enum in source/title.h
+SYSTEMS = [
+    "UNKNOWN",
+    "WII_U",
+    "NES",
+    "SNES",
+    "N64",
+    "WII",
+    "GBA",
+    "NDS",
+    "TG16",
+    "MSX",
+    "SYSTEM",
+    "DEMO",
+]
+
+
+def title_hash(key, seed):
+    h = key ^ ((seed * 0x9E3779B9) & 0xFFFFFFFF)
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & 0xFFFFFFFF
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & 0xFFFFFFFF
+    h ^= h >> 16
+    return h
+
+
+def title_reduce(h, size):
+    return (h * size) >> 32
+
+
+def parse(path):
+    titles = {}
+    with open(path, encoding="utf-8") as f:
+        for number, line in enumerate(f, 1):
+            line = line.rstrip("\r\n")
+            if not line.strip() or line.startswith("#"):
+                continue
+            fields = line.split("\t")
+            where = "%s:%u" % (path, number)
+            if len(fields) < 2:
+                sys.exit("%s: expected an ID and a system" % where)
+            try:
+                title_id = int(fields[0], 16)
+            except ValueError:
+                sys.exit("%s: invalid title ID '%s'" % (where, fields[0]))
+            if fields[1] not in SYSTEMS[1:]:
+                sys.exit("%s: unknown system '%s'" % (where, fields[1]))
+            if title_id in titles:
+                sys.exit("%s: duplicate title ID %016X" % (where, title_id))
+            titles[title_id] = SYSTEMS.index(fields[1])
+    if not titles:
+        sys.exit("%s: no titles" % path)
+    return sorted(titles.items())
+
+
+def build(titles, endian):
+    id_high = titles[0][0] >> 32
+    count = len(titles)
+    bucket_count = (count + BUCKET_SIZE - 1) // BUCKET_SIZE
+    buckets = [[] for _ in range(bucket_count)]
+
+    for title_id, system in titles:
+        if title_id >> 32 != id_high:
+            sys.exit("title %016X is outside the %08X title range" % (title_id, id_high))
+        key = title_id & 0xFFFFFFFF
+        buckets[title_reduce(title_hash(key, 0), bucket_count)].append((key, system))
+
+    disps = [0] * bucket_count
+    ids = [0] * count
+    types = [0] * count
+    used = [False] * count
+
+    # Place the largest buckets first, while the table is still mostly empty
+    order = sorted(range(bucket_count), key=lambda b: -len(buckets[b]))
+    for bucket in order:
+        if not buckets[bucket]:
+            break
+        for disp in range(0x10000):
+            slots = [title_reduce(title_hash(key, disp + 1), count) for key, _ in buckets[bucket]]
+            if len(set(slots)) == len(slots) and not any(used[s] for s in slots):
+                break
+        else:
+            sys.exit("could not generate a perfect hash for %u titles" % count)
+        disps[bucket] = disp
+        for slot, (key, system) in zip(slots, buckets[bucket]):
+            used[slot] = True
+            ids[slot] = key
+            types[slot] = system
+
+    if len(disps) & 1:
+        disps.append(0)
+    if len(types) & 1:
+        types.append(0)
+
+    blob = struct.pack(endian + "5I", MAGIC, VERSION, id_high, count, bucket_count)
+    blob += struct.pack(endian + "%uH" % len(disps), *disps)
+    blob += struct.pack(endian + "%uI" % count, *ids)
+    blob += bytes(types[i] | (types[i + 1] << 4) for i in range(0, len(types), 2))
+    return blob
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0].strip())
+    parser.add_argument("input", help="tab-separated title list")
+    parser.add_argument("output", help="binary title database to write")
+    parser.add_argument("--little-endian", action="store_true",
+                                            help="write integers little-endian, for host builds")
+    args = parser.parse_args()
+
+    blob = build(parse(args.input), "<" if args.little_endian else ">")
+    with open(args.output, "wb") as f:
+        f.write(blob)
+
+
+if __name__ == "__main__":
+    main()